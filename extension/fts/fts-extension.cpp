@@ -1,4 +1,5 @@
 #include "fts-extension.hpp"
+#include "fts_index.hpp"
 #include "fts_indexing.hpp"
 #include "libstemmer.h"
 
@@ -8,6 +9,7 @@
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_pragma_function_info.hpp"
+#include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/catalog/catalog.hpp"
@@ -65,12 +67,15 @@ void FTSExtension::Load(DuckDB &db) {
 	    PragmaFunction::PragmaCall("drop_fts_index", drop_fts_index_query, {LogicalType::VARCHAR});
 	CreatePragmaFunctionInfo drop_fts_index_info(drop_fts_index_func);
 
+	CreateTableFunctionInfo search_info(GetFTSSearchFunction());
+
 	Connection conn(db);
 	conn.BeginTransaction();
 	auto &catalog = Catalog::GetCatalog(*conn.context);
 	catalog.CreateFunction(*conn.context, &stem_info);
 	catalog.CreatePragmaFunction(*conn.context, &create_fts_index_info);
 	catalog.CreatePragmaFunction(*conn.context, &drop_fts_index_info);
+	catalog.CreateTableFunction(*conn.context, &search_info);
 	conn.Commit();
 }
 
@@ -0,0 +1,637 @@
+#include "fts_index.hpp"
+#include "fts_indexing.hpp"
+#include "libstemmer.h"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
+#include "duckdb/parser/expression/function_expression.hpp"
+#include "duckdb/parser/qualified_name.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression_binder/constant_binder.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/transaction.hpp"
+
+#include <cmath>
+#include <functional>
+#include <queue>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Posting Lists
+//===--------------------------------------------------------------------===//
+static uint8_t RequiredBits(uint32_t value) {
+	uint8_t width = 0;
+	while (value > 0) {
+		width++;
+		value >>= 1;
+	}
+	return width;
+}
+
+static void WriteBits(vector<uint64_t> &data, idx_t &bit_pos, uint64_t value, uint8_t width) {
+	if (width == 0) {
+		return;
+	}
+	idx_t word = bit_pos / 64;
+	idx_t shift = bit_pos % 64;
+	idx_t required_words = (bit_pos + width + 63) / 64;
+	if (data.size() < required_words) {
+		data.resize(required_words, 0);
+	}
+	data[word] |= value << shift;
+	if (shift + width > 64) {
+		data[word + 1] |= value >> (64 - shift);
+	}
+	bit_pos += width;
+}
+
+static inline uint32_t ReadBits(const uint64_t *data, idx_t bit_pos, uint8_t width) {
+	if (width == 0) {
+		return 0;
+	}
+	idx_t word = bit_pos / 64;
+	idx_t shift = bit_pos % 64;
+	uint64_t value = data[word] >> shift;
+	if (shift + width > 64) {
+		value |= data[word + 1] << (64 - shift);
+	}
+	return (uint32_t)(value & ((uint64_t(1) << width) - 1));
+}
+
+void PostingList::Append(const uint32_t *docs, const uint32_t *tfs, idx_t append_count) {
+	idx_t bit_pos = data.size() * 64;
+	for (idx_t start = 0; start < append_count; start += BLOCK_SIZE) {
+		idx_t block_count = MinValue<idx_t>(BLOCK_SIZE, append_count - start);
+		Block block;
+		block.first_doc = docs[start];
+		block.last_doc = docs[start + block_count - 1];
+		block.count = block_count;
+		block.offset = bit_pos;
+		// gaps are stored minus one (documents are strictly increasing), term frequencies minus one (always >= 1)
+		uint32_t max_gap = 0;
+		uint32_t block_max_tf = 0;
+		for (idx_t i = 0; i < block_count; i++) {
+			if (i > 0) {
+				max_gap = MaxValue<uint32_t>(max_gap, docs[start + i] - docs[start + i - 1] - 1);
+			}
+			block_max_tf = MaxValue<uint32_t>(block_max_tf, tfs[start + i]);
+		}
+		block.doc_width = RequiredBits(max_gap);
+		block.tf_width = RequiredBits(block_max_tf - 1);
+		for (idx_t i = 1; i < block_count; i++) {
+			WriteBits(data, bit_pos, docs[start + i] - docs[start + i - 1] - 1, block.doc_width);
+		}
+		for (idx_t i = 0; i < block_count; i++) {
+			WriteBits(data, bit_pos, tfs[start + i] - 1, block.tf_width);
+		}
+		// every block starts at a word boundary
+		bit_pos = data.size() * 64;
+		blocks.push_back(block);
+		max_tf = MaxValue<uint32_t>(max_tf, block_max_tf);
+	}
+	count += append_count;
+}
+
+void PostingList::DecodeBlock(idx_t block_idx, uint32_t *docs, uint32_t *tfs) const {
+	auto &block = blocks[block_idx];
+	auto packed = data.data();
+	idx_t bit_pos = block.offset;
+	docs[0] = block.first_doc;
+	for (idx_t i = 1; i < block.count; i++) {
+		docs[i] = docs[i - 1] + 1 + ReadBits(packed, bit_pos, block.doc_width);
+		bit_pos += block.doc_width;
+	}
+	for (idx_t i = 0; i < block.count; i++) {
+		tfs[i] = 1 + ReadBits(packed, bit_pos, block.tf_width);
+		bit_pos += block.tf_width;
+	}
+}
+
+PostingIterator::PostingIterator(const PostingList &list) : list(list), block_idx(0), position(0) {
+	LoadBlock(0);
+}
+
+void PostingIterator::LoadBlock(idx_t block) {
+	block_idx = block;
+	position = 0;
+	if (!Done()) {
+		list.DecodeBlock(block_idx, docs, tfs);
+	}
+}
+
+void PostingIterator::Next() {
+	position++;
+	if (position >= list.blocks[block_idx].count) {
+		LoadBlock(block_idx + 1);
+	}
+}
+
+void PostingIterator::Advance(uint32_t target) {
+	if (Done() || Doc() >= target) {
+		return;
+	}
+	if (list.blocks[block_idx].last_doc < target) {
+		// skip all blocks that end before the target without decoding them
+		idx_t next_block = block_idx + 1;
+		while (next_block < list.blocks.size() && list.blocks[next_block].last_doc < target) {
+			next_block++;
+		}
+		LoadBlock(next_block);
+		if (Done()) {
+			return;
+		}
+	}
+	while (docs[position] < target) {
+		position++;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Index Construction
+//===--------------------------------------------------------------------===//
+static const vector<string> FTS_INDEX_TABLES = {"docs", "dict", "terms"};
+
+static TableCatalogEntry *GetFTSTable(ClientContext &context, const string &fts_schema, const string &table) {
+	auto &catalog = Catalog::GetCatalog(context);
+	auto entry = catalog.GetEntry<TableCatalogEntry>(context, fts_schema, table, true);
+	if (!entry) {
+		throw CatalogException("FTS index table '%s.%s' does not exist: re-create the index with "
+		                       "'PRAGMA create_fts_index()'",
+		                       fts_schema, table);
+	}
+	return entry;
+}
+
+//! Scans the given columns of a table of the FTS index in the current transaction
+static void ScanFTSTable(ClientContext &context, TableCatalogEntry &table, const vector<string> &columns,
+                         const std::function<void(DataChunk &)> &callback) {
+	vector<column_t> column_ids;
+	vector<LogicalType> types;
+	for (auto &column : columns) {
+		auto entry = table.name_map.find(column);
+		if (entry == table.name_map.end()) {
+			throw CatalogException("FTS index table '%s' does not have a column named '%s'", table.name, column);
+		}
+		column_ids.push_back(entry->second);
+		types.push_back(table.columns[entry->second].type);
+	}
+	auto &transaction = Transaction::GetTransaction(context);
+	TableScanState state;
+	table.storage->InitializeScan(transaction, state, column_ids);
+	DataChunk chunk;
+	chunk.Initialize(types);
+	while (true) {
+		chunk.Reset();
+		table.storage->Scan(transaction, chunk, state, column_ids);
+		if (chunk.size() == 0) {
+			break;
+		}
+		callback(chunk);
+	}
+}
+
+//! Casts a column of a scanned chunk to BIGINT, NULL values are returned as 0
+static int64_t *GetBigintColumn(DataChunk &chunk, idx_t column, Vector &result) {
+	VectorOperations::Cast(chunk.data[column], result, chunk.size());
+	result.Normalify(chunk.size());
+	auto data = FlatVector::GetData<int64_t>(result);
+	auto &nullmask = FlatVector::Nullmask(result);
+	if (nullmask.any()) {
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			if (nullmask[i]) {
+				data[i] = 0;
+			}
+		}
+	}
+	return data;
+}
+
+bool FTSIndex::IsValid(const vector<shared_ptr<DataTableInfo>> &current_tables, Transaction &transaction) const {
+	D_ASSERT(current_tables.size() == tables.size());
+	if (transaction.ChangesMade() || transaction.storage.ChangesMade()) {
+		// the transaction might see its own uncommitted changes to the tables
+		return false;
+	}
+	for (idx_t i = 0; i < tables.size(); i++) {
+		if (tables[i] != current_tables[i] || commit_ids[i] != current_tables[i]->last_commit_id ||
+		    commit_ids[i] >= transaction.start_time) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static shared_ptr<FTSIndex> BuildFTSIndex(ClientContext &context, vector<TableCatalogEntry *> &tables) {
+	auto index = make_shared<FTSIndex>();
+	for (auto &table : tables) {
+		index->tables.push_back(table->storage->info);
+		index->commit_ids.push_back(table->storage->info->last_commit_id);
+	}
+	auto &docs = *tables[0];
+	auto &dict = *tables[1];
+	auto &terms = *tables[2];
+
+	// number the documents
+	unordered_map<int64_t, uint32_t> doc_numbers;
+	idx_t total_length = 0;
+	ScanFTSTable(context, docs, {"docid", "name", "len"}, [&](DataChunk &chunk) {
+		Vector docids(LogicalType::BIGINT), lengths(LogicalType::BIGINT);
+		auto docid_data = GetBigintColumn(chunk, 0, docids);
+		auto length_data = GetBigintColumn(chunk, 2, lengths);
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			doc_numbers[docid_data[i]] = index->doc_names.size();
+			index->doc_names.push_back(chunk.GetValue(1, i));
+			index->doc_lengths.push_back(length_data[i]);
+			total_length += length_data[i];
+		}
+	});
+	if (!index->doc_lengths.empty()) {
+		index->avgdl = total_length / index->doc_lengths.size();
+		index->min_length = *std::min_element(index->doc_lengths.begin(), index->doc_lengths.end());
+		index->max_length = *std::max_element(index->doc_lengths.begin(), index->doc_lengths.end());
+	}
+
+	// collect the terms
+	unordered_map<int64_t, string> term_names;
+	ScanFTSTable(context, dict, {"termid", "term"}, [&](DataChunk &chunk) {
+		Vector termids(LogicalType::BIGINT);
+		auto termid_data = GetBigintColumn(chunk, 0, termids);
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			auto term = chunk.GetValue(1, i);
+			if (!term.is_null) {
+				term_names[termid_data[i]] = term.str_value;
+			}
+		}
+	});
+
+	// gather the occurrences of every term, then sort them and count the term frequencies
+	unordered_map<int64_t, vector<uint32_t>> occurrences;
+	ScanFTSTable(context, terms, {"termid", "docid"}, [&](DataChunk &chunk) {
+		Vector termids(LogicalType::BIGINT), docids(LogicalType::BIGINT);
+		auto termid_data = GetBigintColumn(chunk, 0, termids);
+		auto docid_data = GetBigintColumn(chunk, 1, docids);
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			auto doc = doc_numbers.find(docid_data[i]);
+			if (doc != doc_numbers.end()) {
+				occurrences[termid_data[i]].push_back(doc->second);
+			}
+		}
+	});
+	vector<uint32_t> docs_buffer, tfs_buffer;
+	for (auto &entry : occurrences) {
+		auto term = term_names.find(entry.first);
+		if (term == term_names.end()) {
+			continue;
+		}
+		auto &list = entry.second;
+		std::sort(list.begin(), list.end());
+		docs_buffer.clear();
+		tfs_buffer.clear();
+		for (idx_t i = 0; i < list.size(); i++) {
+			if (i > 0 && list[i] == list[i - 1]) {
+				tfs_buffer.back()++;
+			} else {
+				docs_buffer.push_back(list[i]);
+				tfs_buffer.push_back(1);
+			}
+		}
+		index->postings[term->second].Append(docs_buffer.data(), tfs_buffer.data(), docs_buffer.size());
+		// release the memory of the occurrences early
+		vector<uint32_t>().swap(list);
+	}
+	return index;
+}
+
+static string FTSIndexCacheKey(const string &fts_schema) {
+	return "fts_index:" + fts_schema;
+}
+
+static shared_ptr<FTSIndex> GetFTSIndex(ClientContext &context, const string &fts_schema) {
+	vector<TableCatalogEntry *> tables;
+	vector<shared_ptr<DataTableInfo>> table_infos;
+	for (auto &name : FTS_INDEX_TABLES) {
+		auto table = GetFTSTable(context, fts_schema, name);
+		tables.push_back(table);
+		table_infos.push_back(table->storage->info);
+	}
+	if (!DBConfig::GetConfig(context).object_cache_enable) {
+		// the index is only kept for the duration of the query
+		return BuildFTSIndex(context, tables);
+	}
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto cache_key = FTSIndexCacheKey(fts_schema);
+	auto entry = std::dynamic_pointer_cast<FTSIndex>(cache.Get(cache_key));
+	auto &transaction = Transaction::GetTransaction(context);
+	if (entry && entry->IsValid(table_infos, transaction)) {
+		return entry;
+	}
+	entry.reset();
+	auto index = BuildFTSIndex(context, tables);
+	// only share the index if it reflects the latest committed state of the tables, and the tables were not changed
+	// while it was being built
+	if (index->IsValid(table_infos, transaction)) {
+		cache.Delete(cache_key);
+		cache.Put(cache_key, index);
+	}
+	return index;
+}
+
+void EvictFTSIndex(ClientContext &context, const string &fts_schema) {
+	ObjectCache::GetObjectCache(context).Delete(FTSIndexCacheKey(fts_schema));
+}
+
+//===--------------------------------------------------------------------===//
+// BM25 Top-K Search
+//===--------------------------------------------------------------------===//
+struct BM25Parameters {
+	idx_t top_k = 10;
+	double k = 1.2;
+	double b = 0.75;
+	bool conjunctive = false;
+};
+
+struct QueryTerm {
+	QueryTerm(const PostingList &list, double idf, double upper_bound)
+	    : iterator(list), idf(idf), upper_bound(upper_bound) {
+	}
+
+	PostingIterator iterator;
+	double idf;
+	//! An upper bound of the score contribution of the term to any document
+	double upper_bound;
+};
+
+//! Computes the BM25 score contribution of a term to a document in the same way as the match_bm25 macro
+static inline double ScoreContribution(const FTSIndex &index, const BM25Parameters &params, double idf, uint32_t tf,
+                                       uint32_t length) {
+	// the match_bm25 macro divides the (integer) document length by the (integer) average document length
+	double length_ratio = index.avgdl == 0 ? 0 : double(length / index.avgdl);
+	return idf * (tf * (params.k + 1) / (tf + params.k * (1 - params.b + params.b * length_ratio)));
+}
+
+//! Evaluates a BM25 query using the MaxScore algorithm: query terms are ordered by their maximum score contribution,
+//! and the terms whose combined maximum contribution cannot lift a document into the current top-k only have to be
+//! probed for documents that occur in one of the other ("essential") terms.
+static vector<std::pair<double, uint32_t>> SearchBM25(const FTSIndex &index, const vector<string> &query_terms,
+                                                       const BM25Parameters &params) {
+	vector<std::pair<double, uint32_t>> results;
+	if (params.top_k == 0) {
+		return results;
+	}
+	double num_docs = index.doc_names.size();
+	// length normalization is monotonic in the document length: the extremes give the smallest normalization
+	double min_norm = 1 - params.b + params.b * (index.avgdl == 0 ? 0 : double(index.min_length / index.avgdl));
+	double max_norm = 1 - params.b + params.b * (index.avgdl == 0 ? 0 : double(index.max_length / index.avgdl));
+	min_norm = MinValue<double>(min_norm, max_norm);
+	bool can_prune = params.k >= 0 && min_norm > 0;
+
+	vector<unique_ptr<QueryTerm>> terms;
+	for (auto &term : query_terms) {
+		auto entry = index.postings.find(term);
+		if (entry == index.postings.end()) {
+			if (params.conjunctive) {
+				// no document contains all query terms
+				return results;
+			}
+			continue;
+		}
+		auto &list = entry->second;
+		double df = list.count;
+		double idf = std::log10((num_docs - df + 0.5) / (df + 0.5));
+		double upper_bound = NumericLimits<double>::Maximum();
+		if (can_prune) {
+			upper_bound = idf <= 0 ? 0 : idf * (list.max_tf * (params.k + 1) / (list.max_tf + params.k * min_norm));
+		}
+		terms.push_back(make_unique<QueryTerm>(list, idf, upper_bound));
+	}
+	if (terms.empty()) {
+		return results;
+	}
+	std::sort(terms.begin(), terms.end(),
+	          [](const unique_ptr<QueryTerm> &a, const unique_ptr<QueryTerm> &b) { return a->upper_bound < b->upper_bound; });
+	// prefix_bounds[i] is the maximum score a document can get from terms[0..i]
+	vector<double> prefix_bounds;
+	double bound_sum = 0;
+	for (auto &term : terms) {
+		bound_sum += term->upper_bound;
+		prefix_bounds.push_back(bound_sum);
+	}
+
+	// min-heap of the current top-k: the worst result is on top
+	auto worse = [](const std::pair<double, uint32_t> &a, const std::pair<double, uint32_t> &b) {
+		return a.first > b.first || (a.first == b.first && a.second < b.second);
+	};
+	std::priority_queue<std::pair<double, uint32_t>, vector<std::pair<double, uint32_t>>, decltype(worse)> heap(
+	    worse);
+	double threshold = -NumericLimits<double>::Maximum();
+	// terms[0..first_essential) are non-essential: their combined bound does not exceed the threshold
+	idx_t first_essential = 0;
+	while (true) {
+		// the next candidate is the smallest document in any of the essential terms
+		uint32_t candidate = NumericLimits<uint32_t>::Maximum();
+		bool found = false;
+		for (idx_t i = first_essential; i < terms.size(); i++) {
+			if (!terms[i]->iterator.Done() && terms[i]->iterator.Doc() <= candidate) {
+				candidate = terms[i]->iterator.Doc();
+				found = true;
+			}
+		}
+		if (!found) {
+			break;
+		}
+		auto length = index.doc_lengths[candidate];
+		double score = 0;
+		idx_t matches = 0;
+		for (idx_t i = first_essential; i < terms.size(); i++) {
+			auto &iterator = terms[i]->iterator;
+			if (!iterator.Done() && iterator.Doc() == candidate) {
+				score += ScoreContribution(index, params, terms[i]->idf, iterator.TermFrequency(), length);
+				matches++;
+				iterator.Next();
+			}
+		}
+		bool heap_full = heap.size() >= params.top_k;
+		bool pruned = false;
+		for (idx_t i = first_essential; i > 0; i--) {
+			if (heap_full && score + prefix_bounds[i - 1] <= threshold) {
+				// the remaining terms cannot lift the document into the top-k
+				pruned = true;
+				break;
+			}
+			auto &iterator = terms[i - 1]->iterator;
+			iterator.Advance(candidate);
+			if (!iterator.Done() && iterator.Doc() == candidate) {
+				score += ScoreContribution(index, params, terms[i - 1]->idf, iterator.TermFrequency(), length);
+				matches++;
+			}
+		}
+		if (pruned || (params.conjunctive && matches != terms.size())) {
+			continue;
+		}
+		if (!heap_full) {
+			heap.push(std::make_pair(score, candidate));
+		} else if (score > threshold) {
+			heap.pop();
+			heap.push(std::make_pair(score, candidate));
+		} else {
+			continue;
+		}
+		if (heap.size() >= params.top_k) {
+			threshold = heap.top().first;
+			while (first_essential < terms.size() && prefix_bounds[first_essential] <= threshold) {
+				first_essential++;
+			}
+		}
+	}
+	while (!heap.empty()) {
+		results.push_back(heap.top());
+		heap.pop();
+	}
+	std::reverse(results.begin(), results.end());
+	return results;
+}
+
+//===--------------------------------------------------------------------===//
+// Table Function
+//===--------------------------------------------------------------------===//
+struct FTSSearchFunctionData : public TableFunctionData {
+	string fts_schema;
+	vector<string> query_terms;
+	BM25Parameters params;
+};
+
+struct FTSSearchOperatorData : public FunctionOperatorData {
+	shared_ptr<FTSIndex> index;
+	vector<std::pair<double, uint32_t>> results;
+	idx_t offset = 0;
+};
+
+static string StemTerm(const string &term, const string &stemmer) {
+	if (stemmer == "none") {
+		return term;
+	}
+	struct sb_stemmer *s = sb_stemmer_new(stemmer.c_str(), "UTF_8");
+	if (!s) {
+		throw InvalidInputException("Unrecognized stemmer '%s'", stemmer);
+	}
+	auto output_data = (const char *)sb_stemmer_stem(s, (const sb_symbol *)term.c_str(), term.size());
+	string result(output_data, sb_stemmer_length(s));
+	sb_stemmer_delete(s);
+	return result;
+}
+
+//! Tokenizes and stems the query in the same way as the documents were, using the tokenize macro of the index
+static vector<string> TokenizeQuery(ClientContext &context, const string &fts_schema, const string &query) {
+	string stemmer = "porter";
+	auto config = GetFTSTable(context, fts_schema, "config");
+	ScanFTSTable(context, *config, {"stemmer"}, [&](DataChunk &chunk) { stemmer = chunk.GetValue(0, 0).str_value; });
+
+	vector<unique_ptr<ParsedExpression>> children;
+	children.push_back(make_unique<ConstantExpression>(Value(query)));
+	unique_ptr<ParsedExpression> tokenize = make_unique<FunctionExpression>(fts_schema, "tokenize", children);
+	Binder binder(context);
+	ConstantBinder constant_binder(binder, context, "FTS query");
+	auto expr = constant_binder.Bind(tokenize);
+	auto tokens = ExpressionExecutor::EvaluateScalar(*expr);
+
+	vector<string> result;
+	unordered_set<string> seen;
+	for (auto &token : tokens.list_value) {
+		if (token.is_null || token.str_value.empty()) {
+			continue;
+		}
+		auto term = StemTerm(token.str_value, stemmer);
+		if (seen.insert(term).second) {
+			result.push_back(term);
+		}
+	}
+	return result;
+}
+
+static unique_ptr<FunctionData> fts_search_bind(ClientContext &context, vector<Value> &inputs,
+                                                unordered_map<string, Value> &named_parameters,
+                                                vector<LogicalType> &return_types, vector<string> &names) {
+	auto result = make_unique<FTSSearchFunctionData>();
+	auto qname = QualifiedName::Parse(inputs[0].str_value);
+	qname.schema = qname.schema == INVALID_SCHEMA ? DEFAULT_SCHEMA : qname.schema;
+	result->fts_schema = fts_schema_name(qname.schema, qname.name);
+	if (!context.catalog.schemas->GetEntry(context, result->fts_schema)) {
+		throw CatalogException(
+		    "a FTS index does not exist on table '%s.%s'. Create one with 'PRAGMA create_fts_index()'.", qname.schema,
+		    qname.name);
+	}
+	for (auto &kv : named_parameters) {
+		if (kv.first == "top_k") {
+			auto top_k = kv.second.GetValue<int64_t>();
+			if (top_k < 0) {
+				throw BinderException("top_k must be a non-negative number");
+			}
+			result->params.top_k = top_k;
+		} else if (kv.first == "k") {
+			result->params.k = kv.second.GetValue<double>();
+		} else if (kv.first == "b") {
+			result->params.b = kv.second.GetValue<double>();
+		} else if (kv.first == "conjunctive") {
+			result->params.conjunctive = kv.second.GetValue<bool>();
+		}
+	}
+	if (!inputs[1].is_null) {
+		result->query_terms = TokenizeQuery(context, result->fts_schema, inputs[1].str_value);
+	}
+
+	auto docs = GetFTSTable(context, result->fts_schema, "docs");
+	auto name_entry = docs->name_map.find("name");
+	if (name_entry == docs->name_map.end()) {
+		throw CatalogException("FTS index table '%s.docs' does not have a column named 'name'", result->fts_schema);
+	}
+	return_types.push_back(docs->columns[name_entry->second].type);
+	names.push_back("name");
+	return_types.push_back(LogicalType::DOUBLE);
+	names.push_back("score");
+	return move(result);
+}
+
+static unique_ptr<FunctionOperatorData> fts_search_init(ClientContext &context, const FunctionData *bind_data_,
+                                                        vector<column_t> &column_ids, TableFilterSet *table_filters) {
+	auto &bind_data = (FTSSearchFunctionData &)*bind_data_;
+	auto result = make_unique<FTSSearchOperatorData>();
+	if (!bind_data.query_terms.empty()) {
+		result->index = GetFTSIndex(context, bind_data.fts_schema);
+		result->results = SearchBM25(*result->index, bind_data.query_terms, bind_data.params);
+	}
+	return move(result);
+}
+
+static void fts_search_function(ClientContext &context, const FunctionData *bind_data,
+                                FunctionOperatorData *operator_state, DataChunk &output) {
+	auto &state = (FTSSearchOperatorData &)*operator_state;
+	idx_t count = 0;
+	while (state.offset < state.results.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = state.results[state.offset++];
+		output.SetValue(0, count, state.index->doc_names[entry.second]);
+		output.SetValue(1, count, Value::DOUBLE(entry.first));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+TableFunction GetFTSSearchFunction() {
+	TableFunction search("fts_search_bm25", {LogicalType::VARCHAR, LogicalType::VARCHAR}, fts_search_function,
+	                     fts_search_bind, fts_search_init);
+	search.named_parameters["top_k"] = LogicalType::BIGINT;
+	search.named_parameters["k"] = LogicalType::DOUBLE;
+	search.named_parameters["b"] = LogicalType::DOUBLE;
+	search.named_parameters["conjunctive"] = LogicalType::BOOLEAN;
+	return search;
+}
+
+} // namespace duckdb
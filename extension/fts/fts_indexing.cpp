@@ -1,4 +1,5 @@
 #include "fts_indexing.hpp"
+#include "fts_index.hpp"
 
 #include "duckdb/main/connection.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
@@ -8,7 +9,7 @@
 
 namespace duckdb {
 
-static string fts_schema_name(string schema, string table) {
+string fts_schema_name(string schema, string table) {
 	return "fts_" + schema + "_" + table;
 }
 
@@ -22,6 +23,7 @@ string drop_fts_index_query(ClientContext &context, FunctionParameters parameter
 		    "a FTS index does not exist on table '%s.%s'. Create one with 'PRAGMA create_fts_index()'.", qname.schema,
 		    qname.name);
 	}
+	EvictFTSIndex(context, fts_schema);
 
 	return "DROP SCHEMA " + fts_schema + " CASCADE;";
 }
@@ -33,6 +35,7 @@ static string indexing_script(string input_schema, string input_table, string in
         DROP SCHEMA IF EXISTS %fts_schema% CASCADE;
         CREATE SCHEMA %fts_schema%;
         CREATE TABLE %fts_schema%.stopwords (sw VARCHAR);
+        CREATE TABLE %fts_schema%.config AS SELECT '%stemmer%' AS stemmer;
     )";
 	// clang-format on
 
@@ -275,6 +278,8 @@ string create_fts_index_query(ClientContext &context, FunctionParameters paramet
 		                       "drop the existing index with 'PRAGMA drop_fts_index()' before creating a new one.",
 		                       qname.schema, qname.name);
 	}
+	// the in-memory index of an overwritten FTS index is rebuilt on the next search
+	EvictFTSIndex(context, fts_schema);
 
 	// positional parameters
 	auto doc_id = parameters.values[1].str_value;
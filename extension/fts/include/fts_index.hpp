@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// fts_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+struct DataTableInfo;
+class Transaction;
+
+//! A compressed posting list: the (document, term frequency) pairs of a single term in increasing document order.
+//! Postings are stored in blocks of BLOCK_SIZE entries. Within a block the document gaps and the term frequencies are
+//! bit-packed using the minimal width required for that block.
+class PostingList {
+public:
+	static constexpr idx_t BLOCK_SIZE = 128;
+
+	struct Block {
+		//! The first and the last document of the block
+		uint32_t first_doc;
+		uint32_t last_doc;
+		//! The number of postings in the block
+		uint32_t count;
+		//! The offset (in bits) of the packed block data
+		idx_t offset;
+		//! The bit widths of the document gaps and the term frequencies
+		uint8_t doc_width;
+		uint8_t tf_width;
+	};
+
+	//! The total number of postings (i.e. the document frequency of the term)
+	idx_t count = 0;
+	//! The maximum term frequency in the list
+	uint32_t max_tf = 0;
+	vector<Block> blocks;
+	vector<uint64_t> data;
+
+public:
+	//! Appends postings to the list; documents have to be strictly increasing and larger than the last document
+	void Append(const uint32_t *docs, const uint32_t *tfs, idx_t count);
+	//! Decodes the postings of the given block into docs and tfs, which must hold at least BLOCK_SIZE entries
+	void DecodeBlock(idx_t block_idx, uint32_t *docs, uint32_t *tfs) const;
+};
+
+//! Iterates over the postings of a PostingList, decoding one block at a time
+class PostingIterator {
+public:
+	explicit PostingIterator(const PostingList &list);
+
+	bool Done() const {
+		return block_idx >= list.blocks.size();
+	}
+	uint32_t Doc() const {
+		return docs[position];
+	}
+	uint32_t TermFrequency() const {
+		return tfs[position];
+	}
+	//! Moves to the next posting
+	void Next();
+	//! Moves to the first posting with a document >= target, skipping over blocks without decoding them
+	void Advance(uint32_t target);
+
+private:
+	void LoadBlock(idx_t block);
+
+	const PostingList &list;
+	idx_t block_idx;
+	idx_t position;
+	uint32_t docs[PostingList::BLOCK_SIZE];
+	uint32_t tfs[PostingList::BLOCK_SIZE];
+};
+
+//! The in-memory inverted index built from the tables of a FTS index. It is cached in the ObjectCache and rebuilt
+//! when the FTS index is re-created or any of its tables is changed.
+class FTSIndex : public ObjectCacheEntry {
+public:
+	//! Maps every term to its posting list
+	unordered_map<string, PostingList> postings;
+	//! The name and length of every document; documents are numbered in the order of the docs table
+	vector<Value> doc_names;
+	vector<uint32_t> doc_lengths;
+	//! The average document length, computed with integer division like the stats table of the FTS index
+	idx_t avgdl = 0;
+	uint32_t min_length = 0;
+	uint32_t max_length = 0;
+
+	//! The tables the index was built from and the commit ids of their last changes at that time
+	vector<shared_ptr<DataTableInfo>> tables;
+	vector<transaction_t> commit_ids;
+
+public:
+	//! Whether or not the index matches the given tables as seen by the transaction, i.e. the tables have not been
+	//! changed since the index was built, and the transaction sees all of their changes and has none of its own
+	bool IsValid(const vector<shared_ptr<DataTableInfo>> &current_tables, Transaction &transaction) const;
+};
+
+//! Returns the fts_search_bm25 table function, which returns the top-k documents of a BM25 query on a FTS index
+TableFunction GetFTSSearchFunction();
+//! Removes the cached in-memory index of the FTS index in the given schema, if any
+void EvictFTSIndex(ClientContext &context, const string &fts_schema);
+
+} // namespace duckdb
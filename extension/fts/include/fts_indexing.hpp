@@ -12,6 +12,8 @@
 
 namespace duckdb {
 
+//! Returns the name of the schema that holds the FTS index of the given table
+string fts_schema_name(string schema, string table);
 string drop_fts_index_query(ClientContext &context, FunctionParameters parameters);
 string create_fts_index_query(ClientContext &context, FunctionParameters parameters);
 
@@ -71,6 +71,8 @@ struct ParquetReaderScanState {
 	bool finished;
 	TableFilterSet *filters;
 	SelectionVector sel;
+	//! The handle all column chunks of the scan are read from
+	unique_ptr<FileHandle> file_handle;
 };
 
 typedef nullmask_t parquet_filter_t;
@@ -110,6 +112,8 @@ private:
 	const parquet::format::RowGroup &GetGroup(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx, LogicalType &type);
 	bool PreparePageBuffers(ParquetReaderScanState &state, idx_t col_idx);
+	//! Hints the file system to read the column chunks of the given row group that the scan needs in the background
+	void PrefetchRowGroup(ParquetReaderScanState &state, idx_t group_idx);
 	void VerifyString(LogicalTypeId id, const char *str_data, idx_t str_len);
 
 	template <typename... Args> std::runtime_error FormatException(const string fmt_str, Args... params) {
@@ -22,6 +22,7 @@
 #include "duckdb/storage/statistics/base_statistics.hpp"
 
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/object_cache.hpp"
 #include "duckdb/catalog/catalog.hpp"
 
 namespace duckdb {
@@ -359,6 +360,9 @@ void parquet_write_finalize(ClientContext &context, FunctionData &bind_data, Glo
 	auto &global_state = (ParquetWriteGlobalState &)gstate;
 	// finalize: write any additional metadata to the file here
 	global_state.writer->Finalize();
+	// blocks of a previous version of the file that are cached must not be read anymore
+	auto &parquet_bind = (ParquetWriteBindData &)bind_data;
+	ObjectCache::GetObjectCache(context).block_cache.Invalidate(parquet_bind.file_name);
 }
 
 unique_ptr<LocalFunctionData> parquet_write_initialize_local(ClientContext &context, FunctionData &bind_data) {
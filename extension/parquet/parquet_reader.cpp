@@ -783,6 +783,16 @@ bool ParquetReader::PreparePageBuffers(ParquetReaderScanState &state, idx_t col_
 	return true;
 }
 
+static idx_t column_chunk_start(const ColumnChunk &chunk) {
+	// ugh. sometimes there is an extra offset for the dict. sometimes it's wrong.
+	auto chunk_start = chunk.meta_data.data_page_offset;
+	if (chunk.meta_data.__isset.dictionary_page_offset && chunk.meta_data.dictionary_page_offset >= 4) {
+		// this assumes the data pages follow the dict pages directly.
+		chunk_start = chunk.meta_data.dictionary_page_offset;
+	}
+	return chunk_start;
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx, LogicalType &type) {
 	auto &group = GetGroup(state);
 	auto &chunk = group.columns[col_idx];
@@ -837,26 +847,33 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 		}
 	}
 
-	// ugh. sometimes there is an extra offset for the dict. sometimes it's wrong.
-	auto chunk_start = chunk.meta_data.data_page_offset;
-	if (chunk.meta_data.__isset.dictionary_page_offset && chunk.meta_data.dictionary_page_offset >= 4) {
-		// this assumes the data pages follow the dict pages directly.
-		chunk_start = chunk.meta_data.dictionary_page_offset;
-	}
+	auto chunk_start = column_chunk_start(chunk);
 	auto chunk_len = chunk.meta_data.total_compressed_size;
 
 	auto &fs = FileSystem::GetFileSystem(context);
-	auto handle = fs.OpenFile(file_name, FileFlags::FILE_FLAGS_READ);
 
 	state.column_data[col_idx]->has_nulls =
 	    GetFileMetadata()->schema[col_idx + 1].repetition_type == FieldRepetitionType::OPTIONAL;
 
-	// read entire chunk into RAM
+	// read entire chunk into RAM, through the block cache so that hot column chunks are served from memory
+	auto &block_cache = ObjectCache::GetObjectCache(context).block_cache;
 	state.column_data[col_idx]->buf.resize(chunk_len);
-	fs.Read(*handle, state.column_data[col_idx]->buf.ptr, chunk_len, chunk_start);
+	block_cache.Read(fs, *state.file_handle, state.column_data[col_idx]->buf.ptr, chunk_len, chunk_start);
 	return;
 }
 
+void ParquetReader::PrefetchRowGroup(ParquetReaderScanState &state, idx_t group_idx) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto &group = GetFileMetadata()->row_groups[group_idx];
+	for (auto &file_col_idx : state.column_ids) {
+		if (file_col_idx == COLUMN_IDENTIFIER_ROW_ID) {
+			continue;
+		}
+		auto &chunk = group.columns[file_col_idx];
+		fs.Prefetch(*state.file_handle, chunk.meta_data.total_compressed_size, column_chunk_start(chunk));
+	}
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -873,6 +890,7 @@ void ParquetReader::Initialize(ParquetReaderScanState &state, vector<column_t> c
 	state.group_offset = 0;
 	state.group_idx_list = move(groups_to_read);
 	state.filters = filters;
+	state.file_handle = FileSystem::GetFileSystem(context).OpenFile(file_name, FileFlags::FILE_FLAGS_READ);
 	for (idx_t i = 0; i < return_types.size(); i++) {
 		state.column_data.push_back(make_unique<ParquetReaderColumnData>());
 	}
@@ -1170,6 +1188,14 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			state.finished = true;
 			return false;
 		}
+		// let the column chunks of this row group and the next one load in the background while we read and decode
+		// them one by one
+		if (state.current_group == 0) {
+			PrefetchRowGroup(state, state.group_idx_list[state.current_group]);
+		}
+		if ((idx_t)state.current_group + 1 < state.group_idx_list.size()) {
+			PrefetchRowGroup(state, state.group_idx_list[state.current_group + 1]);
+		}
 
 		for (idx_t out_col_idx = 0; out_col_idx < result.ColumnCount(); out_col_idx++) {
 			auto file_col_idx = state.column_ids[out_col_idx];
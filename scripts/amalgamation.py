@@ -26,6 +26,8 @@ utf8proc_include_dir = os.path.join('third_party', 'utf8proc', 'include')
 
 moodycamel_include_dir = os.path.join('third_party', 'concurrentqueue')
 
+zstd_dir = os.path.join('third_party', 'zstd')
+
 # files included in the amalgamated "duckdb.hpp" file
 main_header_files = [os.path.join(include_dir, 'duckdb.hpp'),
     os.path.join(include_dir, 'duckdb.h'),
@@ -65,9 +67,9 @@ if '--extended' in sys.argv:
     main_header_files += add_include_dir(os.path.join(include_dir, 'duckdb/parser/parsed_data'))
     main_header_files += add_include_dir(os.path.join(include_dir, 'duckdb/parser/tableref'))
 # include paths for where to search for include files during amalgamation
-include_paths = [include_dir, fmt_include_dir, re2_dir, miniz_dir, utf8proc_include_dir, utf8proc_dir, pg_query_include_dir, pg_query_dir, moodycamel_include_dir]
+include_paths = [include_dir, fmt_include_dir, re2_dir, miniz_dir, utf8proc_include_dir, utf8proc_dir, pg_query_include_dir, pg_query_dir, moodycamel_include_dir, zstd_dir]
 # paths of where to look for files to compile and include to the final amalgamation
-compile_directories = [src_dir, fmt_dir, miniz_dir, re2_dir, utf8proc_dir, pg_query_dir]
+compile_directories = [src_dir, fmt_dir, miniz_dir, re2_dir, utf8proc_dir, pg_query_dir, zstd_dir]
 
 # files always excluded
 always_excluded = ['src/amalgamation/duckdb.cpp', 'src/amalgamation/duckdb.hpp', 'src/amalgamation/parquet-extension.cpp', 'src/amalgamation/parquet-extension.hpp']
@@ -94,6 +96,12 @@ def get_includes(fpath, text):
                 include_files.append(ipath)
                 found = True
                 break
+        if not found:
+            # includes can also be relative to the including file (e.g. "../common/mem.h" in zstd)
+            ipath = os.path.normpath(os.path.join(os.path.dirname(fpath), included_file))
+            if os.path.isfile(ipath):
+                include_files.append(ipath)
+                found = True
         if not found:
             raise Exception('Could not find include file "' + included_file + '", included from file "' + fpath + '"')
     return ([x[0] for x in include_statements], include_files)
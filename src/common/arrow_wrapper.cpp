@@ -0,0 +1,73 @@
+#include "duckdb/common/arrow_wrapper.hpp"
+
+namespace duckdb {
+
+ResultArrowArrayStreamWrapper::ResultArrowArrayStreamWrapper(unique_ptr<QueryResult> result_p)
+    : result(move(result_p)) {
+	stream.get_schema = ResultArrowArrayStreamWrapper::MyStreamGetSchema;
+	stream.get_next = ResultArrowArrayStreamWrapper::MyStreamGetNext;
+	stream.release = ResultArrowArrayStreamWrapper::MyStreamRelease;
+	stream.get_last_error = ResultArrowArrayStreamWrapper::MyStreamGetLastError;
+	stream.private_data = this;
+}
+
+int ResultArrowArrayStreamWrapper::MyStreamGetSchema(struct ArrowArrayStream *stream, struct ArrowSchema *out) {
+	if (!stream->release) {
+		return -1;
+	}
+	auto my_stream = (ResultArrowArrayStreamWrapper *)stream->private_data;
+	if (!my_stream->result->success) {
+		my_stream->last_error = my_stream->result->error;
+		return -1;
+	}
+	try {
+		my_stream->result->ToArrowSchema(out);
+	} catch (std::exception &ex) {
+		my_stream->last_error = ex.what();
+		return -1;
+	}
+	return 0;
+}
+
+int ResultArrowArrayStreamWrapper::MyStreamGetNext(struct ArrowArrayStream *stream, struct ArrowArray *out) {
+	if (!stream->release) {
+		return -1;
+	}
+	auto my_stream = (ResultArrowArrayStreamWrapper *)stream->private_data;
+	auto &result = *my_stream->result;
+	if (!result.success) {
+		my_stream->last_error = result.error;
+		return -1;
+	}
+	try {
+		auto chunk = result.Fetch();
+		if (!chunk || chunk->size() == 0) {
+			// end of stream: return a released array
+			out->release = nullptr;
+			return 0;
+		}
+		chunk->ToArrowArray(out);
+	} catch (std::exception &ex) {
+		my_stream->last_error = ex.what();
+		return -1;
+	}
+	return 0;
+}
+
+void ResultArrowArrayStreamWrapper::MyStreamRelease(struct ArrowArrayStream *stream) {
+	if (!stream->release) {
+		return;
+	}
+	stream->release = nullptr;
+	delete (ResultArrowArrayStreamWrapper *)stream->private_data;
+}
+
+const char *ResultArrowArrayStreamWrapper::MyStreamGetLastError(struct ArrowArrayStream *stream) {
+	if (!stream->release) {
+		return "stream was released";
+	}
+	auto my_stream = (ResultArrowArrayStreamWrapper *)stream->private_data;
+	return my_stream->last_error.c_str();
+}
+
+} // namespace duckdb
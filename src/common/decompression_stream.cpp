@@ -0,0 +1,317 @@
+#include "duckdb/common/decompression_stream.hpp"
+
+#include "duckdb/common/exception.hpp"
+
+#include <cstring>
+
+namespace duckdb {
+
+constexpr idx_t DecompressionStreamBuf::INPUT_BUFFER_SIZE;
+constexpr idx_t DecompressionStreamBuf::OUTPUT_CHUNK_SIZE;
+constexpr idx_t DecompressionStreamBuf::MAXIMUM_UNIT_SIZE;
+
+DecompressionStreamBuf::DecompressionStreamBuf(string filename_p, idx_t thread_count_p)
+    : filename(move(filename_p)), thread_count(thread_count_p) {
+#ifdef DUCKDB_NO_THREADS
+	thread_count = 0;
+#endif
+}
+
+DecompressionStreamBuf::~DecompressionStreamBuf() {
+	{
+		lock_guard<mutex> guard(lock);
+		cancelled = true;
+	}
+	chunk_space.notify_all();
+	batch_available.notify_all();
+	for (auto &worker : threads) {
+		worker->join();
+	}
+}
+
+void DecompressionStreamBuf::Initialize() {
+	handle = fs.OpenFile(filename, FileFlags::FILE_FLAGS_READ);
+	input_capacity = INPUT_BUFFER_SIZE;
+	input = unique_ptr<data_t[]>(new data_t[input_capacity]);
+	decompressor = CreateDecompressor();
+	is_initialized = true;
+#ifndef DUCKDB_NO_THREADS
+	// the decompressors are created up front: the threads can outlive the derived class during destruction
+	for (idx_t i = 0; i < thread_count; i++) {
+		worker_decompressors.push_back(CreateDecompressor());
+	}
+	reader_thread = true;
+	for (auto &worker_decompressor : worker_decompressors) {
+		threads.push_back(make_unique<thread>(&DecompressionStreamBuf::RunWorker, this, worker_decompressor.get()));
+	}
+	threads.push_back(make_unique<thread>(&DecompressionStreamBuf::RunReader, this));
+#endif
+}
+
+void DecompressionStreamBuf::ReadInput() {
+	D_ASSERT(!end_of_input);
+	if (input_start > 0) {
+		// move the input that is not consumed yet to the front of the buffer
+		memmove(input.get(), input.get() + input_start, input_end - input_start);
+		input_end -= input_start;
+		input_start = 0;
+	}
+	if (input_end == input_capacity) {
+		// the buffer is full: the unit at the front of the buffer needs more input, so grow the buffer
+		auto new_input = unique_ptr<data_t[]>(new data_t[input_capacity * 2]);
+		memcpy(new_input.get(), input.get(), input_end);
+		input = move(new_input);
+		input_capacity *= 2;
+	}
+	auto bytes_read = fs.Read(*handle, input.get() + input_end, input_capacity - input_end);
+	if (bytes_read == 0) {
+		end_of_input = true;
+	}
+	input_end += bytes_read;
+}
+
+bool DecompressionStreamBuf::ProduceChunks() {
+	if (in_streaming_unit) {
+		// decompress the next chunk of the streaming unit
+		auto chunk = make_shared<DecompressedChunk>();
+		chunk->data.resize(OUTPUT_CHUNK_SIZE);
+		auto output = chunk->data.data();
+		auto output_end = output + chunk->data.size();
+		while (output < output_end) {
+			if (input_start == input_end && !end_of_input) {
+				ReadInput();
+				continue;
+			}
+			const_data_ptr_t input_ptr = input.get() + input_start;
+			auto previous_input = input_ptr;
+			auto previous_output = output;
+			bool end_of_unit = decompressor->Decompress(input_ptr, input.get() + input_end, output, output_end);
+			input_start = input_ptr - input.get();
+			if (end_of_unit) {
+				in_streaming_unit = false;
+				break;
+			}
+			if (input_ptr == previous_input && output == previous_output) {
+				// no progress can be made without more input
+				if (end_of_input) {
+					throw Exception("Unexpected end of compressed file \"" + filename + "\"");
+				}
+				ReadInput();
+			}
+		}
+		chunk->data.resize(output - chunk->data.data());
+		chunk->ready = true;
+		return AddChunk(move(chunk));
+	}
+	// find the next units in the input
+	while (true) {
+		if (input_start == input_end && !end_of_input) {
+			ReadInput();
+			continue;
+		}
+		auto unit = decompressor->NextUnit(input.get() + input_start, input_end - input_start, end_of_input);
+		switch (unit.type) {
+		case CompressedUnitType::NEED_MORE_INPUT:
+			D_ASSERT(!end_of_input);
+			ReadInput();
+			break;
+		case CompressedUnitType::INDEPENDENT: {
+			// add the unit to the batch that is decompressed by one of the workers
+			D_ASSERT(unit.size > 0 && input_start + unit.size <= input_end);
+			auto unit_start = input.get() + input_start;
+			// the decompressed size of the batch is only known if it is known for all of its units
+			auto unit_output_size = decompressor->DecompressedSize(unit_start, unit.size);
+			bool size_known = batch_input.empty() || batch_output_size > 0;
+			batch_output_size = size_known && unit_output_size > 0 ? batch_output_size + unit_output_size : 0;
+			batch_input.insert(batch_input.end(), unit_start, unit_start + unit.size);
+			input_start += unit.size;
+			if (batch_input.size() >= INPUT_BUFFER_SIZE) {
+				return FlushBatch();
+			}
+			break;
+		}
+		case CompressedUnitType::STREAMING:
+			// the units in the batch precede the streaming unit
+			if (!FlushBatch()) {
+				return false;
+			}
+			input_start += decompressor->BeginUnit(input.get() + input_start, input_end - input_start);
+			in_streaming_unit = true;
+			return true;
+		default:
+			D_ASSERT(unit.type == CompressedUnitType::END_OF_STREAM);
+			FlushBatch();
+			return false;
+		}
+	}
+}
+
+bool DecompressionStreamBuf::FlushBatch() {
+	if (batch_input.empty()) {
+		return true;
+	}
+	DecompressionBatch batch;
+	batch.chunk = make_shared<DecompressedChunk>();
+	batch.input = move(batch_input);
+	batch.output_size = batch_output_size;
+	batch_input.clear();
+	batch_output_size = 0;
+	if (!AddChunk(batch.chunk)) {
+		return false;
+	}
+	if (worker_decompressors.empty()) {
+		// no worker threads: decompress the batch right away
+		DecompressBatch(*decompressor, batch);
+		return true;
+	}
+	{
+		lock_guard<mutex> guard(lock);
+		batches.push_back(move(batch));
+	}
+	batch_available.notify_one();
+	return true;
+}
+
+bool DecompressionStreamBuf::AddChunk(shared_ptr<DecompressedChunk> chunk) {
+	{
+		std::unique_lock<mutex> guard(lock);
+		if (reader_thread) {
+			chunk_space.wait(guard, [&] { return cancelled || chunks.size() < MaximumChunks(); });
+		}
+		if (cancelled) {
+			return false;
+		}
+		chunks.push_back(move(chunk));
+	}
+	chunk_ready.notify_all();
+	return true;
+}
+
+void DecompressionStreamBuf::MarkReady(DecompressedChunk &chunk) {
+	{
+		lock_guard<mutex> guard(lock);
+		chunk.ready = true;
+	}
+	chunk_ready.notify_all();
+}
+
+void DecompressionStreamBuf::DecompressBatch(StreamDecompressor &batch_decompressor, DecompressionBatch &batch) {
+	auto &chunk = *batch.chunk;
+	try {
+		const_data_ptr_t input_ptr = batch.input.data();
+		auto input_end = input_ptr + batch.input.size();
+		idx_t output_size = 0;
+		// if the decompressed size is known, reserve one extra byte: the end of the last unit can then be detected
+		// without growing the output
+		chunk.data.resize(batch.output_size > 0 ? batch.output_size + 1 : batch.input.size() * 4);
+		while (input_ptr < input_end) {
+			input_ptr += batch_decompressor.BeginUnit(input_ptr, input_end - input_ptr);
+			while (true) {
+				if (output_size == chunk.data.size()) {
+					chunk.data.resize(chunk.data.size() * 2);
+				}
+				auto output = chunk.data.data() + output_size;
+				auto output_end = chunk.data.data() + chunk.data.size();
+				bool end_of_unit = batch_decompressor.Decompress(input_ptr, input_end, output, output_end);
+				output_size = output - chunk.data.data();
+				if (end_of_unit) {
+					break;
+				}
+				if (input_ptr == input_end && output < output_end) {
+					throw Exception("Unexpected end of compressed file \"" + filename + "\"");
+				}
+			}
+		}
+		chunk.data.resize(output_size);
+	} catch (std::exception &ex) {
+		chunk.error = ex.what();
+	}
+	MarkReady(chunk);
+}
+
+void DecompressionStreamBuf::RunReader() {
+	try {
+		while (ProduceChunks()) {
+		}
+	} catch (std::exception &ex) {
+		// hand the error to the stream, after the chunks that precede it
+		auto chunk = make_shared<DecompressedChunk>();
+		chunk->error = ex.what();
+		chunk->ready = true;
+		lock_guard<mutex> guard(lock);
+		chunks.push_back(move(chunk));
+	}
+	{
+		lock_guard<mutex> guard(lock);
+		finished = true;
+	}
+	chunk_ready.notify_all();
+	batch_available.notify_all();
+}
+
+void DecompressionStreamBuf::RunWorker(StreamDecompressor *worker_decompressor) {
+	while (true) {
+		DecompressionBatch batch;
+		{
+			std::unique_lock<mutex> guard(lock);
+			batch_available.wait(guard, [&] { return cancelled || finished || !batches.empty(); });
+			if (cancelled || batches.empty()) {
+				return;
+			}
+			batch = move(batches.front());
+			batches.pop_front();
+		}
+		DecompressBatch(*worker_decompressor, batch);
+	}
+}
+
+std::streambuf::int_type DecompressionStreamBuf::underflow() {
+	if (!is_initialized) {
+		Initialize();
+	}
+	if (gptr() < egptr()) {
+		return traits_type::to_int_type(*gptr());
+	}
+	std::unique_lock<mutex> guard(lock);
+	if (reading_chunk) {
+		// the chunk at the front has been read entirely
+		chunks.pop_front();
+		reading_chunk = false;
+		chunk_space.notify_one();
+	}
+	while (true) {
+		if (!reader_thread) {
+			// there is no reader thread: decompress the next chunks on this thread
+			while (chunks.empty() && !finished) {
+				guard.unlock();
+				bool has_more = ProduceChunks();
+				guard.lock();
+				finished = !has_more;
+			}
+		} else {
+			chunk_ready.wait(guard, [&] {
+				return chunks.empty() ? finished : chunks.front()->ready;
+			});
+		}
+		if (chunks.empty()) {
+			// all chunks have been read
+			setg(nullptr, nullptr, nullptr);
+			return traits_type::eof();
+		}
+		auto &chunk = *chunks.front();
+		if (!chunk.error.empty()) {
+			throw Exception(chunk.error);
+		}
+		if (chunk.data.empty()) {
+			chunks.pop_front();
+			chunk_space.notify_one();
+			continue;
+		}
+		reading_chunk = true;
+		auto data = (char *)chunk.data.data();
+		setg(data, data, data + chunk.data.size());
+		return traits_type::to_int_type(*gptr());
+	}
+}
+
+} // namespace duckdb
@@ -60,6 +60,10 @@ string PhysicalOperatorToString(PhysicalOperatorType type) {
 		return "INDEX_JOIN";
 	case PhysicalOperatorType::PIECEWISE_MERGE_JOIN:
 		return "PIECEWISE_MERGE_JOIN";
+	case PhysicalOperatorType::IE_JOIN:
+		return "IE_JOIN";
+	case PhysicalOperatorType::ASOF_JOIN:
+		return "ASOF_JOIN";
 	case PhysicalOperatorType::CROSS_PRODUCT:
 		return "CROSS_PRODUCT";
 	case PhysicalOperatorType::UNION:
@@ -96,6 +100,8 @@ string PhysicalOperatorToString(PhysicalOperatorType type) {
 		return "INVALID";
 	case PhysicalOperatorType::EXPRESSION_SCAN:
 		return "EXPRESSION_SCAN";
+	case PhysicalOperatorType::TABLE_FETCH:
+		return "TABLE_FETCH";
 	case PhysicalOperatorType::ALTER:
 		return "ALTER";
 	case PhysicalOperatorType::CREATE_SEQUENCE:
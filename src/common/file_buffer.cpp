@@ -37,6 +37,12 @@ FileBuffer::FileBuffer(FileBufferType type, uint64_t bufsiz) : type(type) {
 	size = internal_size - Storage::BLOCK_HEADER_SIZE;
 }
 
+FileBuffer::FileBuffer(FileBufferType type, data_ptr_t internal_buffer_p, uint64_t bufsiz)
+    : type(type), internal_buffer(internal_buffer_p), internal_size(bufsiz), malloced_buffer(nullptr) {
+	buffer = internal_buffer + Storage::BLOCK_HEADER_SIZE;
+	size = internal_size - Storage::BLOCK_HEADER_SIZE;
+}
+
 FileBuffer::~FileBuffer() {
 	free(malloced_buffer);
 }
@@ -44,6 +50,10 @@ FileBuffer::~FileBuffer() {
 void FileBuffer::Read(FileHandle &handle, uint64_t location) {
 	// read the buffer from disk
 	handle.Read(internal_buffer, internal_size, location);
+	VerifyChecksum();
+}
+
+void FileBuffer::VerifyChecksum() {
 	// compute the checksum
 	auto stored_checksum = Load<uint64_t>(internal_buffer);
 	uint64_t computed_checksum = Checksum(buffer, size);
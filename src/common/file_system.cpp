@@ -15,6 +15,7 @@
 #include <dirent.h>
 #include <fcntl.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -161,6 +162,34 @@ int64_t FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	return bytes_read;
 }
 
+void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	int fd = ((UnixFileHandle &)handle).fd;
+	auto read_buffer = (char *)buffer;
+	while (nr_bytes > 0) {
+		int64_t bytes_read = pread(fd, read_buffer, nr_bytes, location);
+		if (bytes_read == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			throw IOException("Could not read from file \"%s\": %s", handle.path, strerror(errno));
+		}
+		if (bytes_read == 0) {
+			throw IOException("Could not read sufficient bytes from file \"%s\"", handle.path);
+		}
+		read_buffer += bytes_read;
+		nr_bytes -= bytes_read;
+		location += bytes_read;
+	}
+}
+
+void LocalFileSystem::Prefetch(FileHandle &handle, int64_t nr_bytes, idx_t location) {
+#if defined(POSIX_FADV_WILLNEED)
+	int fd = ((UnixFileHandle &)handle).fd;
+	// the kernel starts reading the range into the page cache without blocking us
+	posix_fadvise(fd, location, nr_bytes, POSIX_FADV_WILLNEED);
+#endif
+}
+
 int64_t FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	int fd = ((UnixFileHandle &)handle).fd;
 	int64_t bytes_written = write(fd, buffer, nr_bytes);
@@ -170,6 +199,26 @@ int64_t FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	return bytes_written;
 }
 
+void LocalFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	int fd = ((UnixFileHandle &)handle).fd;
+	auto write_buffer = (char *)buffer;
+	while (nr_bytes > 0) {
+		int64_t bytes_written = pwrite(fd, write_buffer, nr_bytes, location);
+		if (bytes_written == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+			throw IOException("Could not write file \"%s\": %s", handle.path, strerror(errno));
+		}
+		if (bytes_written == 0) {
+			throw IOException("Could not write sufficient bytes from file \"%s\"", handle.path);
+		}
+		write_buffer += bytes_written;
+		nr_bytes -= bytes_written;
+		location += bytes_written;
+	}
+}
+
 int64_t FileSystem::GetFileSize(FileHandle &handle) {
 	int fd = ((UnixFileHandle &)handle).fd;
 	struct stat s;
@@ -195,6 +244,19 @@ void FileSystem::Truncate(FileHandle &handle, int64_t new_size) {
 	}
 }
 
+data_ptr_t LocalFileSystem::MapFile(FileHandle &handle, idx_t nr_bytes) {
+	int fd = ((UnixFileHandle &)handle).fd;
+	void *mapping = mmap(nullptr, nr_bytes, PROT_READ, MAP_SHARED, fd, 0);
+	if (mapping == MAP_FAILED) {
+		return nullptr;
+	}
+	return (data_ptr_t)mapping;
+}
+
+void LocalFileSystem::UnmapFile(data_ptr_t mapping, idx_t nr_bytes) {
+	munmap(mapping, nr_bytes);
+}
+
 bool FileSystem::DirectoryExists(const string &directory) {
 	if (!directory.empty()) {
 		if (access(directory.c_str(), 0) == 0) {
@@ -449,6 +511,48 @@ void FileSystem::SetFilePointer(FileHandle &handle, idx_t location) {
 	}
 }
 
+//! The OVERLAPPED offset makes ReadFile/WriteFile positional, so concurrent reads on one handle do not race on the
+//! file pointer
+static OVERLAPPED WindowsFileOffset(idx_t location) {
+	OVERLAPPED overlapped;
+	memset(&overlapped, 0, sizeof(OVERLAPPED));
+	overlapped.Offset = (DWORD)(location & 0xFFFFFFFF);
+	overlapped.OffsetHigh = (DWORD)(location >> 32);
+	return overlapped;
+}
+
+void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	HANDLE hFile = ((WindowsFileHandle &)handle).fd;
+	auto overlapped = WindowsFileOffset(location);
+	DWORD bytes_read;
+	auto rc = ReadFile(hFile, buffer, (DWORD)nr_bytes, &bytes_read, &overlapped);
+	if (rc == 0) {
+		auto error = GetLastErrorAsString();
+		throw IOException("Could not read file \"%s\": %s", handle.path, error);
+	}
+	if (bytes_read != nr_bytes) {
+		throw IOException("Could not read sufficient bytes from file \"%s\"", handle.path);
+	}
+}
+
+void LocalFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	HANDLE hFile = ((WindowsFileHandle &)handle).fd;
+	auto overlapped = WindowsFileOffset(location);
+	DWORD bytes_written;
+	auto rc = WriteFile(hFile, buffer, (DWORD)nr_bytes, &bytes_written, &overlapped);
+	if (rc == 0) {
+		auto error = GetLastErrorAsString();
+		throw IOException("Could not write file \"%s\": %s", handle.path, error);
+	}
+	if (bytes_written != nr_bytes) {
+		throw IOException("Could not write sufficient bytes from file \"%s\"", handle.path);
+	}
+}
+
+void LocalFileSystem::Prefetch(FileHandle &handle, int64_t nr_bytes, idx_t location) {
+	// no read-ahead hint is issued on Windows
+}
+
 int64_t FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	HANDLE hFile = ((WindowsFileHandle &)handle).fd;
 	DWORD bytes_read;
@@ -517,6 +621,22 @@ void FileSystem::Truncate(FileHandle &handle, int64_t new_size) {
 	}
 }
 
+data_ptr_t LocalFileSystem::MapFile(FileHandle &handle, idx_t nr_bytes) {
+	HANDLE hFile = ((WindowsFileHandle &)handle).fd;
+	HANDLE file_mapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (!file_mapping) {
+		return nullptr;
+	}
+	// the view keeps the file mapping alive: the handle can be closed right away
+	auto mapping = MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, nr_bytes);
+	CloseHandle(file_mapping);
+	return (data_ptr_t)mapping;
+}
+
+void LocalFileSystem::UnmapFile(data_ptr_t mapping, idx_t nr_bytes) {
+	UnmapViewOfFile(mapping);
+}
+
 bool FileSystem::DirectoryExists(const string &directory) {
 	DWORD attrs = GetFileAttributesA(directory.c_str());
 	return (attrs != INVALID_FILE_ATTRIBUTES && (attrs & FILE_ATTRIBUTE_DIRECTORY));
@@ -670,6 +790,8 @@ string FileSystem::GetHomeDirectory() {
 }
 
 void FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	// the file pointer is shared by all users of the handle: seek and read without interruption
+	lock_guard<mutex> guard(handle.file_pointer_lock);
 	// seek to the location
 	SetFilePointer(handle, location);
 	// now read from the location
@@ -680,6 +802,7 @@ void FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t
 }
 
 void FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	lock_guard<mutex> guard(handle.file_pointer_lock);
 	// seek to the location
 	SetFilePointer(handle, location);
 	// now write to the location
@@ -689,6 +812,19 @@ void FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t
 	}
 }
 
+void FileSystem::Prefetch(FileHandle &handle, int64_t nr_bytes, idx_t location) {
+	// read-ahead hints are specific to the file system: none are issued by default
+}
+
+data_ptr_t FileSystem::MapFile(FileHandle &handle, idx_t nr_bytes) {
+	// memory mapping is specific to the file system: the file has to be read instead
+	return nullptr;
+}
+
+void FileSystem::UnmapFile(data_ptr_t mapping, idx_t nr_bytes) {
+	throw InternalException("UnmapFile called on a file system that does not map files");
+}
+
 string FileSystem::JoinPath(const string &a, const string &b) {
 	// FIXME: sanitize paths
 	return a + PathSeparator() + b;
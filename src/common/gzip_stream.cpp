@@ -1,12 +1,13 @@
 #include "duckdb/common/gzip_stream.hpp"
 
 #include "duckdb/common/exception.hpp"
-#include "duckdb/common/file_system.hpp"
-#include "duckdb/common/fstream_util.hpp"
 
 #include "miniz.hpp"
 
 #include "duckdb/common/limits.hpp"
+
+#include <cstring>
+
 using namespace duckdb_miniz;
 
 namespace duckdb {
@@ -54,14 +55,6 @@ namespace duckdb {
 
  */
 
-static idx_t consume_string(fstream &input) {
-	idx_t size = 1; // terminator
-	while (input.get() != '\0') {
-		size++;
-	}
-	return size;
-}
-
 static const uint8_t GZIP_COMPRESSION_DEFLATE = 0x08;
 
 static const uint8_t GZIP_FLAG_ASCII = 0x1;
@@ -72,140 +65,170 @@ static const uint8_t GZIP_FLAG_COMMENT = 0x10;
 static const uint8_t GZIP_FLAG_ENCRYPT = 0x20;
 
 static const uint8_t GZIP_HEADER_MINSIZE = 10;
+//! The crc32 and the uncompressed size that follow the compressed data of a member
+static const uint8_t GZIP_FOOTER_SIZE = 8;
 
-static const unsigned char GZIP_FLAG_UNSUPPORTED =
-    GZIP_FLAG_ASCII | GZIP_FLAG_MULTIPART | GZIP_FLAG_EXTRA | GZIP_FLAG_COMMENT | GZIP_FLAG_ENCRYPT;
+static const unsigned char GZIP_FLAG_UNSUPPORTED = GZIP_FLAG_ASCII | GZIP_FLAG_MULTIPART | GZIP_FLAG_ENCRYPT;
 
-void GzipStreamBuf::initialize() {
-	if (is_initialized) {
-		return;
+//! Parses the header of the member at the start of the input. Returns false if more input is needed to parse the
+//! header; otherwise sets the size of the header and, for BGZF members, the compressed size of the member (or 0).
+static bool ParseGzipHeader(const_data_ptr_t input, idx_t size, idx_t &header_size, idx_t &member_size) {
+	if (size < GZIP_HEADER_MINSIZE) {
+		return false;
 	}
-	D_ASSERT(BUFFER_SIZE >= 3); // found to work fine with 3
-	uint8_t gzip_hdr[10];
-	data_start = GZIP_HEADER_MINSIZE;
-
-	in_buff = new data_t[BUFFER_SIZE];
-	in_buff_start = in_buff;
-	in_buff_end = in_buff;
-	out_buff = new data_t[BUFFER_SIZE];
-
-	mz_stream_ptr = new mz_stream();
-	// TODO use custom alloc/free methods in miniz to throw exceptions on OOM
-
-	FstreamUtil::OpenFile(filename, input, ios::in | ios::binary);
-
-	input.read((char *)gzip_hdr, GZIP_HEADER_MINSIZE);
-	if (!input) {
-		throw Exception("Input is not a GZIP stream");
-	}
-	if (gzip_hdr[0] != 0x1F || gzip_hdr[1] != 0x8B) { // magic header
+	if (input[0] != 0x1F || input[1] != 0x8B) { // magic header
 		throw Exception("Input is not a GZIP stream");
 	}
-	if (gzip_hdr[2] != GZIP_COMPRESSION_DEFLATE) { // compression method
+	if (input[2] != GZIP_COMPRESSION_DEFLATE) { // compression method
 		throw Exception("Unsupported GZIP compression method");
 	}
-	if (gzip_hdr[3] & GZIP_FLAG_UNSUPPORTED) {
+	auto flags = input[3];
+	if (flags & GZIP_FLAG_UNSUPPORTED) {
 		throw Exception("Unsupported GZIP archive");
 	}
-
-	if (gzip_hdr[3] & GZIP_FLAG_NAME) {
-		input.seekg(data_start, input.beg);
-		data_start += consume_string(input);
+	idx_t position = GZIP_HEADER_MINSIZE;
+	member_size = 0;
+	if (flags & GZIP_FLAG_EXTRA) {
+		if (size < position + 2) {
+			return false;
+		}
+		idx_t extra_size = input[position] | (input[position + 1] << 8);
+		position += 2;
+		if (size < position + extra_size) {
+			return false;
+		}
+		// the extra field consists of subfields; the "BC" subfield of BGZF holds the size of the member minus one
+		idx_t extra_end = position + extra_size;
+		idx_t subfield = position;
+		while (subfield + 4 <= extra_end) {
+			idx_t subfield_size = input[subfield + 2] | (input[subfield + 3] << 8);
+			if (input[subfield] == 'B' && input[subfield + 1] == 'C' && subfield_size == 2 &&
+			    subfield + 6 <= extra_end) {
+				member_size = (input[subfield + 4] | (input[subfield + 5] << 8)) + 1;
+			}
+			subfield += 4 + subfield_size;
+		}
+		position = extra_end;
 	}
-	input.seekg(data_start, input.beg);
-	// stream is now set to beginning of payload data
-
-	auto ret = mz_inflateInit2((mz_streamp)mz_stream_ptr, -MZ_DEFAULT_WINDOW_BITS);
-	if (ret != MZ_OK) {
-		throw Exception("Failed to initialize miniz");
+	for (auto string_flag : {GZIP_FLAG_NAME, GZIP_FLAG_COMMENT}) {
+		if (!(flags & string_flag)) {
+			continue;
+		}
+		// skip the zero terminated string
+		auto terminator = (const_data_ptr_t)memchr(input + position, '\0', size - position);
+		if (!terminator) {
+			return false;
+		}
+		position = terminator - input + 1;
 	}
-	// initialize eback, gptr, egptr
-	setg((char *)out_buff, (char *)out_buff, (char *)out_buff);
-	is_initialized = true;
+	header_size = position;
+	return true;
 }
 
-std::streambuf::int_type GzipStreamBuf::underflow() {
-	if (!is_initialized) {
-		initialize();
+class GzipStreamDecompressor : public StreamDecompressor {
+public:
+	GzipStreamDecompressor() {
+		memset(&stream, 0, sizeof(mz_stream));
 	}
-
-	// adapted from https://github.com/mateidavid/zstr
-	auto zstrm_p = (mz_streamp)mz_stream_ptr;
-	if (!zstrm_p) {
-		return traits_type::eof();
+	~GzipStreamDecompressor() override {
+		if (stream_initialized) {
+			mz_inflateEnd(&stream);
+		}
 	}
 
-	if (gptr() == egptr()) {
-		// pointers for free region in output buffer
-		auto out_buff_free_start = out_buff;
-		do {
-			D_ASSERT(in_buff_start <= in_buff_end);
-			D_ASSERT(in_buff_end <= in_buff_start + BUFFER_SIZE);
-
-			// read more input if none available
-			if (in_buff_start == in_buff_end) {
-				// empty input buffer: refill from the start
-				in_buff_start = in_buff;
-				std::streamsize sz = input.rdbuf()->sgetn((char *)in_buff, BUFFER_SIZE);
-				if (sz == 0) {
-					break; // end of input
-				}
-				in_buff_end = in_buff + sz;
+	CompressedUnit NextUnit(const_data_ptr_t input, idx_t input_size, bool end_of_input) override {
+		if (member_count > 0) {
+			// like gzip, ignore anything that follows the last member (e.g. zero padding)
+			if (input_size == 0 || input[0] != 0x1F || (input_size > 1 && input[1] != 0x8B)) {
+				return CompressedUnit(CompressedUnitType::END_OF_STREAM);
 			}
-
-			// actually decompress
-			D_ASSERT(zstrm_p);
-			zstrm_p->next_in = (data_ptr_t)in_buff_start;
-			D_ASSERT(in_buff_end - in_buff_start < NumericLimits<int32_t>::Maximum());
-			zstrm_p->avail_in = (uint32_t)(in_buff_end - in_buff_start);
-			zstrm_p->next_out = (data_ptr_t)out_buff_free_start;
-			D_ASSERT((out_buff + BUFFER_SIZE) - out_buff_free_start < NumericLimits<int32_t>::Maximum());
-			zstrm_p->avail_out = (uint32_t)((out_buff + BUFFER_SIZE) - out_buff_free_start);
-			auto ret = mz_inflate(zstrm_p, MZ_NO_FLUSH);
-			if (ret != MZ_OK && ret != MZ_STREAM_END) {
-				throw Exception(mz_error(ret));
+		}
+		idx_t header_size, member_size;
+		if (!ParseGzipHeader(input, input_size, header_size, member_size)) {
+			if (end_of_input) {
+				throw Exception("Input is not a GZIP stream");
+			}
+			return CompressedUnit(CompressedUnitType::NEED_MORE_INPUT);
+		}
+		member_count++;
+		if (member_size > 0) {
+			// the size of the member is known (BGZF): it can be decompressed independently
+			if (member_size <= input_size) {
+				return CompressedUnit(CompressedUnitType::INDEPENDENT, member_size);
 			}
-			// update pointers following inflate()
-			in_buff_start = (data_ptr_t)zstrm_p->next_in;
-			in_buff_end = in_buff_start + zstrm_p->avail_in;
-			out_buff_free_start = (data_ptr_t)zstrm_p->next_out;
-			D_ASSERT(out_buff_free_start + zstrm_p->avail_out == out_buff + BUFFER_SIZE);
-			// if stream ended, deallocate inflator
-			if (ret == MZ_STREAM_END) {
-				mz_inflateEnd(zstrm_p);
-				delete zstrm_p;
-				mz_stream_ptr = nullptr;
-				break;
+			if (!end_of_input) {
+				return CompressedUnit(CompressedUnitType::NEED_MORE_INPUT);
 			}
+		}
+		return CompressedUnit(CompressedUnitType::STREAMING);
+	}
 
-		} while (out_buff_free_start == out_buff);
-		// 2 exit conditions:
-		// - end of input: there might or might not be output available
-		// - out_buff_free_start != out_buff: output available
-		setg((char *)out_buff, (char *)out_buff, (char *)out_buff_free_start);
+	idx_t DecompressedSize(const_data_ptr_t input, idx_t unit_size) override {
+		// the footer ends with the decompressed size of the member (modulo 2^32)
+		D_ASSERT(unit_size >= GZIP_FOOTER_SIZE);
+		auto size_ptr = input + unit_size - 4;
+		return size_ptr[0] | (size_ptr[1] << 8) | (size_ptr[2] << 16) | ((idx_t)size_ptr[3] << 24);
 	}
 
-	// ensure all those pointers point at something sane
-	D_ASSERT(out_buff);
-	D_ASSERT(gptr() <= egptr());
-	D_ASSERT(eback() == (char *)out_buff);
-	D_ASSERT(gptr() >= (char *)out_buff);
-	D_ASSERT(gptr() <= (char *)out_buff + BUFFER_SIZE);
-	D_ASSERT(egptr() >= (char *)out_buff);
-	D_ASSERT(egptr() <= (char *)out_buff + BUFFER_SIZE);
-	D_ASSERT(gptr() <= egptr());
-
-	return this->gptr() == this->egptr() ? traits_type::eof() : traits_type::to_int_type(*this->gptr());
-}
+	idx_t BeginUnit(const_data_ptr_t input, idx_t input_size) override {
+		idx_t header_size, member_size;
+		if (!ParseGzipHeader(input, input_size, header_size, member_size)) {
+			throw Exception("Input is not a GZIP stream");
+		}
+		if (stream_initialized) {
+			mz_inflateEnd(&stream);
+			stream_initialized = false;
+		}
+		memset(&stream, 0, sizeof(mz_stream));
+		// TODO use custom alloc/free methods in miniz to throw exceptions on OOM
+		auto ret = mz_inflateInit2(&stream, -MZ_DEFAULT_WINDOW_BITS);
+		if (ret != MZ_OK) {
+			throw Exception("Failed to initialize miniz");
+		}
+		stream_initialized = true;
+		footer_remaining = 0;
+		return header_size;
+	}
 
-GzipStreamBuf::~GzipStreamBuf() {
-	delete[] in_buff;
-	delete[] out_buff;
-	auto zstrm_p = (mz_streamp)mz_stream_ptr;
-	if (zstrm_p) {
-		mz_inflateEnd(zstrm_p);
+	bool Decompress(const_data_ptr_t &input, const_data_ptr_t input_end, data_ptr_t &output,
+	                data_ptr_t output_end) override {
+		if (stream_initialized) {
+			stream.next_in = input;
+			stream.avail_in = (uint32_t)MinValue<idx_t>(input_end - input, NumericLimits<int32_t>::Maximum());
+			stream.next_out = output;
+			stream.avail_out = (uint32_t)MinValue<idx_t>(output_end - output, NumericLimits<int32_t>::Maximum());
+			auto ret = mz_inflate(&stream, MZ_NO_FLUSH);
+			// MZ_BUF_ERROR signals that no progress can be made without more input
+			if (ret != MZ_OK && ret != MZ_STREAM_END && ret != MZ_BUF_ERROR) {
+				throw Exception(mz_error(ret));
+			}
+			input = stream.next_in;
+			output = stream.next_out;
+			if (ret != MZ_STREAM_END) {
+				return false;
+			}
+			mz_inflateEnd(&stream);
+			stream_initialized = false;
+			footer_remaining = GZIP_FOOTER_SIZE;
+		}
+		// skip the footer of the member
+		auto skip = MinValue<idx_t>(footer_remaining, input_end - input);
+		input += skip;
+		footer_remaining -= skip;
+		return footer_remaining == 0;
 	}
-	delete zstrm_p;
+
+private:
+	mz_stream stream;
+	bool stream_initialized = false;
+	//! The amount of bytes of the footer of the current member that still have to be skipped
+	idx_t footer_remaining = 0;
+	//! The amount of members found in the input
+	idx_t member_count = 0;
+};
+
+unique_ptr<StreamDecompressor> GzipStreamBuf::CreateDecompressor() {
+	return make_unique<GzipStreamDecompressor>();
 }
 
 } // namespace duckdb
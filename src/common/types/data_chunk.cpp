@@ -202,6 +202,8 @@ struct DuckDBArrowArrayHolder {
 	Vector vector;
 	unique_ptr<data_t[]> string_offsets;
 	unique_ptr<data_t[]> string_data;
+	//! The timestamps converted to nanoseconds
+	unique_ptr<data_t[]> timestamp_data;
 };
 
 static void release_duckdb_arrow_array(ArrowArray *array) {
@@ -209,6 +211,13 @@ static void release_duckdb_arrow_array(ArrowArray *array) {
 		return;
 	}
 	array->release = nullptr;
+	// the consumer only releases the root array: it releases its children
+	for (int64_t child_idx = 0; child_idx < array->n_children; child_idx++) {
+		auto child = array->children[child_idx];
+		if (child->release) {
+			child->release(child);
+		}
+	}
 	auto holder = (DuckDBArrowArrayHolder *)array->private_data;
 	delete holder;
 }
@@ -279,11 +288,14 @@ void DataChunk::ToArrowArray(ArrowArray *out_array) {
 			}
 			case LogicalTypeId::TIMESTAMP: {
 				// convert timestamp from microseconds to nanoseconds
+				// the data buffer might be shared with other vectors, so convert into a separate buffer
 				child.n_buffers = 2;
-				child.buffers[1] = (void *)FlatVector::GetData(vector);
+				holder->timestamp_data = unique_ptr<data_t[]>(new data_t[sizeof(timestamp_t) * size()]);
+				child.buffers[1] = (void *)holder->timestamp_data.get();
+				auto source_ptr = FlatVector::GetData<timestamp_t>(vector);
 				auto target_ptr = (timestamp_t *)child.buffers[1];
 				for (idx_t row_idx = 0; row_idx < size(); row_idx++) {
-					target_ptr[row_idx] = Timestamp::GetEpochNanoSeconds(target_ptr[row_idx]);
+					target_ptr[row_idx] = Timestamp::GetEpochNanoSeconds(source_ptr[row_idx]);
 				}
 				break;
 			}
@@ -329,18 +341,18 @@ void DataChunk::ToArrowArray(ArrowArray *out_array) {
 			}
 
 			auto &nullmask = FlatVector::Nullmask(vector);
+			if (!nullmask.any()) {
+				// no nulls: the validity buffer can be omitted entirely
+				child.null_count = 0;
+				child.buffers[0] = nullptr;
+				break;
+			}
 			if (child.length == STANDARD_VECTOR_SIZE) {
 				// vector is completely full; null count is equal to the number of bits set in the mask
 				child.null_count = nullmask.count();
 			} else {
 				// vector is not completely full; we cannot easily figure out the exact null count
-				if (nullmask.any()) {
-					// any bits are set: might have nulls
-					child.null_count = -1;
-				} else {
-					// no bits are set; we know there are no nulls
-					child.null_count = 0;
-				}
+				child.null_count = -1;
 			}
 			child.buffers[0] = (void *)&nullmask.flip();
 			break;
@@ -18,9 +18,33 @@ private:
 		BinaryExecutor::Execute<T, T, bool, OP, IGNORE_NULL>(left, right, result, count);
 	}
 
+	//! Evaluate the comparison once per dictionary entry and broadcast the results through the selection vector
+	template <class OP>
+	static void ExecuteDictionary(Vector &dictionary, Vector &constant, bool dictionary_is_left, Vector &result,
+	                              idx_t count) {
+		auto dict_size = DictionaryVector::DictionarySize(dictionary);
+		auto &child = DictionaryVector::Child(dictionary);
+		Vector dict_result(result.type);
+		if (dictionary_is_left) {
+			Execute<OP>(child, constant, dict_result, dict_size);
+		} else {
+			Execute<OP>(constant, child, dict_result, dict_size);
+		}
+		result.Slice(dict_result, DictionaryVector::SelVector(dictionary), count);
+		result.Normalify(count);
+	}
+
 public:
 	template <class OP> static inline void Execute(Vector &left, Vector &right, Vector &result, idx_t count) {
 		D_ASSERT(left.type == right.type && result.type == LogicalType::BOOLEAN);
+		if (right.vector_type == VectorType::CONSTANT_VECTOR && DictionaryVector::CanExecuteOnDictionary(left, count)) {
+			ExecuteDictionary<OP>(left, right, true, result, count);
+			return;
+		}
+		if (left.vector_type == VectorType::CONSTANT_VECTOR && DictionaryVector::CanExecuteOnDictionary(right, count)) {
+			ExecuteDictionary<OP>(right, left, false, result, count);
+			return;
+		}
 		// the inplace loops take the result as the last parameter
 		switch (left.type.InternalType()) {
 		case PhysicalType::BOOL:
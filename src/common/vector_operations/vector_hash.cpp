@@ -89,11 +89,43 @@ static inline void hash_type_switch(Vector &input, Vector &result, const Selecti
 	}
 }
 
+//! Hash every entry of the dictionary of the input exactly once
+static void hash_dictionary(Vector &input, Vector &dict_hashes, VectorData &hdata) {
+	auto dict_size = DictionaryVector::DictionarySize(input);
+	hash_type_switch<false>(DictionaryVector::Child(input), dict_hashes, nullptr, dict_size);
+	dict_hashes.Orrify(dict_size, hdata);
+}
+
+template <bool HAS_RSEL>
+static void dictionary_hash(Vector &input, Vector &result, const SelectionVector *rsel, idx_t count) {
+	// hash the dictionary entries and broadcast the hashes through the selection vector
+	Vector dict_hashes(LogicalType::HASH);
+	VectorData hdata;
+	hash_dictionary(input, dict_hashes, hdata);
+
+	auto &dict_sel = DictionaryVector::SelVector(input);
+	auto dict_hash_data = (hash_t *)hdata.data;
+	result.vector_type = VectorType::FLAT_VECTOR;
+	auto result_data = FlatVector::GetData<hash_t>(result);
+	for (idx_t i = 0; i < count; i++) {
+		auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+		result_data[ridx] = dict_hash_data[hdata.sel->get_index(dict_sel.get_index(ridx))];
+	}
+}
+
 void VectorOperations::Hash(Vector &input, Vector &result, idx_t count) {
+	if (DictionaryVector::CanExecuteOnDictionary(input, count)) {
+		dictionary_hash<false>(input, result, nullptr, count);
+		return;
+	}
 	hash_type_switch<false>(input, result, nullptr, count);
 }
 
 void VectorOperations::Hash(Vector &input, Vector &result, const SelectionVector &sel, idx_t count) {
+	if (DictionaryVector::CanExecuteOnDictionary(input, count)) {
+		dictionary_hash<true>(input, result, &sel, count);
+		return;
+	}
 	hash_type_switch<true>(input, result, &sel, count);
 }
 
@@ -208,11 +240,48 @@ static inline void combine_hash_type_switch(Vector &hashes, Vector &input, const
 	}
 }
 
+template <bool HAS_RSEL>
+static void dictionary_combine_hash(Vector &hashes, Vector &input, const SelectionVector *rsel, idx_t count) {
+	// hash the dictionary entries and combine the broadcasted hashes with the existing hashes
+	Vector dict_hashes(LogicalType::HASH);
+	VectorData hdata;
+	hash_dictionary(input, dict_hashes, hdata);
+
+	auto &dict_sel = DictionaryVector::SelVector(input);
+	auto dict_hash_data = (hash_t *)hdata.data;
+	if (hashes.vector_type == VectorType::CONSTANT_VECTOR) {
+		auto constant_hash = *ConstantVector::GetData<hash_t>(hashes);
+		hashes.Initialize(hashes.type);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+			auto other_hash = dict_hash_data[hdata.sel->get_index(dict_sel.get_index(ridx))];
+			hash_data[ridx] = combine_hash(constant_hash, other_hash);
+		}
+	} else {
+		D_ASSERT(hashes.vector_type == VectorType::FLAT_VECTOR);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+			auto other_hash = dict_hash_data[hdata.sel->get_index(dict_sel.get_index(ridx))];
+			hash_data[ridx] = combine_hash(hash_data[ridx], other_hash);
+		}
+	}
+}
+
 void VectorOperations::CombineHash(Vector &hashes, Vector &input, idx_t count) {
+	if (DictionaryVector::CanExecuteOnDictionary(input, count)) {
+		dictionary_combine_hash<false>(hashes, input, nullptr, count);
+		return;
+	}
 	combine_hash_type_switch<false>(hashes, input, nullptr, count);
 }
 
 void VectorOperations::CombineHash(Vector &hashes, Vector &input, const SelectionVector &rsel, idx_t count) {
+	if (DictionaryVector::CanExecuteOnDictionary(input, count)) {
+		dictionary_combine_hash<true>(hashes, input, &rsel, count);
+		return;
+	}
 	combine_hash_type_switch<true>(hashes, input, &rsel, count);
 }
 
@@ -0,0 +1,92 @@
+#include "duckdb/common/zstd_stream.hpp"
+
+#include "duckdb/common/exception.hpp"
+
+// zstd.h is only included once in the amalgamation, so it has to include the declarations used by zstd itself
+#define ZSTD_STATIC_LINKING_ONLY
+#include "zstd.h"
+
+namespace duckdb {
+
+static const idx_t ZSTD_MAGIC_SIZE = 4;
+
+class ZstdStreamDecompressor : public StreamDecompressor {
+public:
+	ZstdStreamDecompressor() {
+		stream = duckdb_zstd::ZSTD_createDStream();
+		if (!stream) {
+			throw Exception("Failed to initialize zstd");
+		}
+	}
+	~ZstdStreamDecompressor() override {
+		duckdb_zstd::ZSTD_freeDStream(stream);
+	}
+
+	CompressedUnit NextUnit(const_data_ptr_t input, idx_t input_size, bool end_of_input) override {
+		if (input_size == 0 && frame_count > 0) {
+			return CompressedUnit(CompressedUnitType::END_OF_STREAM);
+		}
+		if (input_size < ZSTD_MAGIC_SIZE) {
+			if (end_of_input) {
+				throw Exception("Input is not a ZSTD stream");
+			}
+			return CompressedUnit(CompressedUnitType::NEED_MORE_INPUT);
+		}
+		uint32_t magic = input[0] | (input[1] << 8) | (input[2] << 16) | ((uint32_t)input[3] << 24);
+		if (magic != ZSTD_MAGICNUMBER && (magic & ZSTD_MAGIC_SKIPPABLE_MASK) != ZSTD_MAGIC_SKIPPABLE_START) {
+			throw Exception("Input is not a ZSTD stream");
+		}
+		frame_count++;
+		// the compressed size of a frame is only known once the entire frame is buffered
+		auto frame_size = duckdb_zstd::ZSTD_findFrameCompressedSize(input, input_size);
+		if (!duckdb_zstd::ZSTD_isError(frame_size)) {
+			return CompressedUnit(CompressedUnitType::INDEPENDENT, frame_size);
+		}
+		if (!end_of_input && input_size < DecompressionStreamBuf::MAXIMUM_UNIT_SIZE) {
+			return CompressedUnit(CompressedUnitType::NEED_MORE_INPUT);
+		}
+		// the frame is too large to buffer (or it is truncated): decompress it in order
+		return CompressedUnit(CompressedUnitType::STREAMING);
+	}
+
+	idx_t DecompressedSize(const_data_ptr_t input, idx_t unit_size) override {
+		auto content_size = duckdb_zstd::ZSTD_getFrameContentSize(input, unit_size);
+		if (content_size == ZSTD_CONTENTSIZE_UNKNOWN || content_size == ZSTD_CONTENTSIZE_ERROR) {
+			return 0;
+		}
+		return content_size;
+	}
+
+	idx_t BeginUnit(const_data_ptr_t input, idx_t input_size) override {
+		auto ret = duckdb_zstd::ZSTD_initDStream(stream);
+		if (duckdb_zstd::ZSTD_isError(ret)) {
+			throw Exception(duckdb_zstd::ZSTD_getErrorName(ret));
+		}
+		return 0;
+	}
+
+	bool Decompress(const_data_ptr_t &input, const_data_ptr_t input_end, data_ptr_t &output,
+	                data_ptr_t output_end) override {
+		duckdb_zstd::ZSTD_inBuffer in_buffer = {input, (size_t)(input_end - input), 0};
+		duckdb_zstd::ZSTD_outBuffer out_buffer = {output, (size_t)(output_end - output), 0};
+		// decompression stops at the end of the frame
+		auto ret = duckdb_zstd::ZSTD_decompressStream(stream, &out_buffer, &in_buffer);
+		if (duckdb_zstd::ZSTD_isError(ret)) {
+			throw Exception(duckdb_zstd::ZSTD_getErrorName(ret));
+		}
+		input += in_buffer.pos;
+		output += out_buffer.pos;
+		return ret == 0;
+	}
+
+private:
+	duckdb_zstd::ZSTD_DStream *stream;
+	//! The amount of frames found in the input
+	idx_t frame_count = 0;
+};
+
+unique_ptr<StreamDecompressor> ZstdStreamBuf::CreateDecompressor() {
+	return make_unique<ZstdStreamDecompressor>();
+}
+
+} // namespace duckdb
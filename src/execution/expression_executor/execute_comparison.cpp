@@ -82,6 +82,54 @@ static idx_t templated_select_operation(Vector &left, Vector &right, const Selec
 	}
 }
 
+template <class OP>
+static idx_t dictionary_select_operation(Vector &dictionary, Vector &constant, bool dictionary_is_left,
+                                         const SelectionVector *sel, idx_t count, SelectionVector *true_sel,
+                                         SelectionVector *false_sel) {
+	// evaluate the comparison once for every entry in the dictionary
+	auto dict_size = DictionaryVector::DictionarySize(dictionary);
+	auto &child = DictionaryVector::Child(dictionary);
+	SelectionVector dict_true_sel(dict_size);
+	idx_t dict_true_count;
+	if (dictionary_is_left) {
+		dict_true_count = templated_select_operation<OP>(child, constant, nullptr, dict_size, &dict_true_sel, nullptr);
+	} else {
+		dict_true_count = templated_select_operation<OP>(constant, child, nullptr, dict_size, &dict_true_sel, nullptr);
+	}
+	bool dict_matches[STANDARD_VECTOR_SIZE];
+	memset(dict_matches, 0, sizeof(bool) * dict_size);
+	for (idx_t i = 0; i < dict_true_count; i++) {
+		dict_matches[dict_true_sel.get_index(i)] = true;
+	}
+	// now broadcast the results through the selection vector of the dictionary
+	auto &dict_sel = DictionaryVector::SelVector(dictionary);
+	idx_t true_count = 0, false_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto result_idx = sel ? sel->get_index(i) : i;
+		if (dict_matches[dict_sel.get_index(i)]) {
+			if (true_sel) {
+				true_sel->set_index(true_count, result_idx);
+			}
+			true_count++;
+		} else if (false_sel) {
+			false_sel->set_index(false_count++, result_idx);
+		}
+	}
+	return true_count;
+}
+
+template <class OP>
+static idx_t comparison_select_operation(Vector &left, Vector &right, const SelectionVector *sel, idx_t count,
+                                         SelectionVector *true_sel, SelectionVector *false_sel) {
+	if (right.vector_type == VectorType::CONSTANT_VECTOR && DictionaryVector::CanExecuteOnDictionary(left, count)) {
+		return dictionary_select_operation<OP>(left, right, true, sel, count, true_sel, false_sel);
+	}
+	if (left.vector_type == VectorType::CONSTANT_VECTOR && DictionaryVector::CanExecuteOnDictionary(right, count)) {
+		return dictionary_select_operation<OP>(right, left, false, sel, count, true_sel, false_sel);
+	}
+	return templated_select_operation<OP>(left, right, sel, count, true_sel, false_sel);
+}
+
 idx_t ExpressionExecutor::Select(BoundComparisonExpression &expr, ExpressionState *state, const SelectionVector *sel,
                                  idx_t count, SelectionVector *true_sel, SelectionVector *false_sel) {
 	// resolve the children
@@ -94,17 +142,17 @@ idx_t ExpressionExecutor::Select(BoundComparisonExpression &expr, ExpressionStat
 
 	switch (expr.type) {
 	case ExpressionType::COMPARE_EQUAL:
-		return templated_select_operation<duckdb::Equals>(left, right, sel, count, true_sel, false_sel);
+		return comparison_select_operation<duckdb::Equals>(left, right, sel, count, true_sel, false_sel);
 	case ExpressionType::COMPARE_NOTEQUAL:
-		return templated_select_operation<duckdb::NotEquals>(left, right, sel, count, true_sel, false_sel);
+		return comparison_select_operation<duckdb::NotEquals>(left, right, sel, count, true_sel, false_sel);
 	case ExpressionType::COMPARE_LESSTHAN:
-		return templated_select_operation<duckdb::LessThan>(left, right, sel, count, true_sel, false_sel);
+		return comparison_select_operation<duckdb::LessThan>(left, right, sel, count, true_sel, false_sel);
 	case ExpressionType::COMPARE_GREATERTHAN:
-		return templated_select_operation<duckdb::GreaterThan>(left, right, sel, count, true_sel, false_sel);
+		return comparison_select_operation<duckdb::GreaterThan>(left, right, sel, count, true_sel, false_sel);
 	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
-		return templated_select_operation<duckdb::LessThanEquals>(left, right, sel, count, true_sel, false_sel);
+		return comparison_select_operation<duckdb::LessThanEquals>(left, right, sel, count, true_sel, false_sel);
 	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
-		return templated_select_operation<duckdb::GreaterThanEquals>(left, right, sel, count, true_sel, false_sel);
+		return comparison_select_operation<duckdb::GreaterThanEquals>(left, right, sel, count, true_sel, false_sel);
 	case ExpressionType::COMPARE_DISTINCT_FROM:
 		throw NotImplementedException("Unimplemented compare: COMPARE_DISTINCT_FROM");
 	default:
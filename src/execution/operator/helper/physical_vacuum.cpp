@@ -1,10 +1,56 @@
 #include "duckdb/execution/operator/helper/physical_vacuum.hpp"
 
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/transaction.hpp"
+
 namespace duckdb {
 
 void PhysicalVacuum::GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state) {
-	// NOP
+	auto &client = context.client;
 	state->finished = true;
+	if (!info->vacuum) {
+		// ANALYZE: NOP
+		return;
+	}
+	// gather the tables to vacuum
+	auto &catalog = Catalog::GetCatalog(client);
+	vector<TableCatalogEntry *> tables;
+	if (info->table.empty()) {
+		catalog.schemas->Scan(client, [&](CatalogEntry *schema) {
+			((SchemaCatalogEntry *)schema)->Scan(client, CatalogType::TABLE_ENTRY, [&](CatalogEntry *entry) {
+				if (entry->type == CatalogType::TABLE_ENTRY) {
+					tables.push_back((TableCatalogEntry *)entry);
+				}
+			});
+		});
+	} else {
+		tables.push_back(catalog.GetEntry<TableCatalogEntry>(client, info->schema, info->table));
+	}
+
+	// the deleted rows are removed by the checkpoint, which writes only the rows that are still visible and gives them
+	// new row ids. A running database is not checkpointed: request a checkpoint on the next startup instead.
+	auto &transaction = Transaction::GetTransaction(client);
+	for (auto &table : tables) {
+		if (table->temporary) {
+			// temporary tables are not checkpointed
+			continue;
+		}
+		auto &storage = *table->storage;
+		idx_t deleted_rows = storage.CountDeletedRows(transaction);
+		if (deleted_rows == 0) {
+			continue;
+		}
+		if (info->table.empty() && deleted_rows < storage.GetTotalRows() * MIN_DELETED_FRACTION) {
+			// not worth rewriting the table
+			continue;
+		}
+		transaction.checkpoint_requested = true;
+		break;
+	}
 }
 
 } // namespace duckdb
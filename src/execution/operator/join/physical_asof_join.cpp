@@ -0,0 +1,356 @@
+#include "duckdb/execution/operator/join/physical_asof_join.hpp"
+
+#include "duckdb/common/types/chunk_collection.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+
+namespace duckdb {
+
+PhysicalAsOfJoin::PhysicalAsOfJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left,
+                                   unique_ptr<PhysicalOperator> right, vector<JoinCondition> cond, JoinType join_type)
+    : PhysicalComparisonJoin(op, PhysicalOperatorType::ASOF_JOIN, move(cond), join_type) {
+	D_ASSERT(join_type == JoinType::INNER || join_type == JoinType::LEFT);
+	D_ASSERT(!conditions.empty());
+	// the binder places the inequality condition last
+	for (idx_t i = 0; i + 1 < conditions.size(); i++) {
+		D_ASSERT(conditions[i].comparison == ExpressionType::COMPARE_EQUAL);
+		key_orders.push_back(OrderType::ASCENDING);
+		null_orders.push_back(OrderByNullType::NULLS_LAST);
+	}
+	equality_orders = key_orders;
+
+	// for "l >= r" the matches of a LHS row are the RHS rows with a smaller key, of which the largest is the closest
+	// for "l <= r" the matches are the RHS rows with a larger key, of which the smallest is the closest
+	auto comparison = conditions.back().comparison;
+	switch (comparison) {
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+	case ExpressionType::COMPARE_GREATERTHAN:
+		key_orders.push_back(OrderType::ASCENDING);
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+	case ExpressionType::COMPARE_LESSTHAN:
+		key_orders.push_back(OrderType::DESCENDING);
+		break;
+	default:
+		throw InternalException("Unsupported inequality for ASOF join");
+	}
+	null_orders.push_back(OrderByNullType::NULLS_LAST);
+	match_equal_keys = comparison == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
+	                   comparison == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+
+	children.push_back(move(left));
+	children.push_back(move(right));
+}
+
+//! The materialized rows of one side of the ASOF join, together with their join keys and sort order
+struct AsOfSortedTable {
+	//! The materialized rows
+	ChunkCollection rows;
+	//! The join keys of the rows
+	ChunkCollection keys;
+	//! The row indices in the order of the join keys
+	unique_ptr<idx_t[]> order;
+
+	void Sort(vector<OrderType> &key_orders, vector<OrderByNullType> &null_orders) {
+		if (keys.Count() == 0) {
+			return;
+		}
+		order = unique_ptr<idx_t[]>(new idx_t[keys.Count()]);
+		keys.Sort(key_orders, null_orders, order.get());
+	}
+};
+
+//! Returns whether or not any of the join keys of a materialized row is NULL
+static bool HasNullKey(ChunkCollection &keys, idx_t row) {
+	auto &chunk = keys.GetChunk(row / STANDARD_VECTOR_SIZE);
+	for (idx_t k = 0; k < chunk.ColumnCount(); k++) {
+		if (FlatVector::IsNull(chunk.data[k], row % STANDARD_VECTOR_SIZE)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class AsOfLocalState : public LocalSinkState {
+public:
+	AsOfLocalState(vector<JoinCondition> &conditions, vector<LogicalType> &types) : sel(STANDARD_VECTOR_SIZE) {
+		vector<LogicalType> condition_types;
+		for (auto &cond : conditions) {
+			rhs_executor.AddExpression(*cond.right);
+			condition_types.push_back(cond.right->return_type);
+		}
+		join_keys.Initialize(condition_types);
+		payload.InitializeEmpty(types);
+	}
+
+	//! The chunk holding the right condition
+	DataChunk join_keys;
+	//! The executor of the RHS condition
+	ExpressionExecutor rhs_executor;
+	//! The rows of the input chunk that have no NULL keys
+	SelectionVector sel;
+	DataChunk payload;
+	//! The rows and join keys materialized by this thread
+	ChunkCollection right_chunks;
+	ChunkCollection right_conditions;
+};
+
+class AsOfGlobalState : public GlobalOperatorState {
+public:
+	mutex lock;
+	//! The materialized and sorted RHS
+	AsOfSortedTable right;
+};
+
+unique_ptr<GlobalOperatorState> PhysicalAsOfJoin::GetGlobalState(ClientContext &context) {
+	return make_unique<AsOfGlobalState>();
+}
+
+unique_ptr<LocalSinkState> PhysicalAsOfJoin::GetLocalSinkState(ExecutionContext &context) {
+	return make_unique<AsOfLocalState>(conditions, children[1]->types);
+}
+
+void PhysicalAsOfJoin::Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate,
+                            DataChunk &input) {
+	auto &asof_state = (AsOfLocalState &)lstate;
+
+	// resolve the join keys for this chunk
+	asof_state.rhs_executor.SetChunk(input);
+
+	auto &join_keys = asof_state.join_keys;
+	join_keys.Reset();
+	join_keys.SetCardinality(input);
+	for (idx_t k = 0; k < conditions.size(); k++) {
+		asof_state.rhs_executor.ExecuteExpression(k, join_keys.data[k]);
+	}
+
+	// RHS rows with a NULL key can never match: filter them out
+	auto key_data = join_keys.Orrify();
+	idx_t valid_count = 0;
+	for (idx_t i = 0; i < input.size(); i++) {
+		bool has_null = false;
+		for (idx_t k = 0; k < conditions.size(); k++) {
+			auto &vdata = key_data[k];
+			if ((*vdata.nullmask)[vdata.sel->get_index(i)]) {
+				has_null = true;
+				break;
+			}
+		}
+		if (!has_null) {
+			asof_state.sel.set_index(valid_count++, i);
+		}
+	}
+	if (valid_count == input.size()) {
+		asof_state.right_chunks.Append(input);
+		asof_state.right_conditions.Append(join_keys);
+	} else if (valid_count > 0) {
+		asof_state.payload.Slice(input, asof_state.sel, valid_count);
+		join_keys.Slice(asof_state.sel, valid_count);
+		asof_state.right_chunks.Append(asof_state.payload);
+		asof_state.right_conditions.Append(join_keys);
+	}
+}
+
+void PhysicalAsOfJoin::Combine(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate) {
+	auto &gstate = (AsOfGlobalState &)state;
+	auto &asof_state = (AsOfLocalState &)lstate;
+	lock_guard<mutex> glock(gstate.lock);
+	// the rows and keys are merged in the same way, so their positions keep lining up
+	gstate.right.rows.Merge(asof_state.right_chunks);
+	gstate.right.keys.Merge(asof_state.right_conditions);
+}
+
+//===--------------------------------------------------------------------===//
+// Finalize
+//===--------------------------------------------------------------------===//
+void PhysicalAsOfJoin::Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> state) {
+	auto &gstate = (AsOfGlobalState &)*state;
+	// sort the RHS once; the LHS is sorted and merged with it by every thread that probes the join
+	gstate.right.Sort(key_orders, null_orders);
+	PhysicalSink::Finalize(pipeline, context, move(state));
+}
+
+//===--------------------------------------------------------------------===//
+// GetChunkInternal
+//===--------------------------------------------------------------------===//
+class PhysicalAsOfJoinState : public PhysicalOperatorState {
+public:
+	PhysicalAsOfJoinState(PhysicalOperator &op, PhysicalOperator *left, vector<JoinCondition> &conditions)
+	    : PhysicalOperatorState(op, left), initialized(false), left_position(0), right_position(0) {
+		vector<LogicalType> condition_types;
+		for (auto &cond : conditions) {
+			lhs_executor.AddExpression(*cond.left);
+			condition_types.push_back(cond.left->return_type);
+		}
+		join_keys.Initialize(condition_types);
+	}
+
+	//! Whether or not the LHS has been materialized and sorted
+	bool initialized;
+	//! The materialized LHS of this thread
+	AsOfSortedTable left;
+	DataChunk join_keys;
+	//! The executor of the LHS condition
+	ExpressionExecutor lhs_executor;
+
+	//! The position in the sorted LHS
+	idx_t left_position;
+	//! The amount of sorted RHS rows that precede the current LHS row; the last of these is the candidate match
+	idx_t right_position;
+
+	//! The LHS and RHS rows of the current output chunk
+	idx_t left_rows[STANDARD_VECTOR_SIZE];
+	idx_t right_rows[STANDARD_VECTOR_SIZE];
+	//! Whether or not the LHS rows of the current output chunk found a match (only used for LEFT joins)
+	bool found_match[STANDARD_VECTOR_SIZE];
+	DataChunk left_result;
+	DataChunk right_result;
+};
+
+void PhysicalAsOfJoin::InitializeJoin(ExecutionContext &context, PhysicalOperatorState *state_) {
+	auto state = reinterpret_cast<PhysicalAsOfJoinState *>(state_);
+	auto &left = state->left;
+
+	// materialize the LHS (or the part of it that is assigned to this thread)
+	while (true) {
+		children[0]->GetChunk(context, state->child_chunk, state->child_state.get());
+		if (state->child_chunk.size() == 0) {
+			break;
+		}
+		state->join_keys.Reset();
+		state->lhs_executor.SetChunk(state->child_chunk);
+		state->join_keys.SetCardinality(state->child_chunk);
+		for (idx_t k = 0; k < conditions.size(); k++) {
+			state->lhs_executor.ExecuteExpression(k, state->join_keys.data[k]);
+		}
+		left.rows.Append(state->child_chunk);
+		left.keys.Append(state->join_keys);
+	}
+	state->left_result.Initialize(children[0]->types);
+	state->right_result.Initialize(children[1]->types);
+	// sorting the LHS in the same order as the RHS allows us to find all matches in a single merge pass
+	left.Sort(key_orders, null_orders);
+}
+
+idx_t PhysicalAsOfJoin::FindMatch(PhysicalOperatorState *state_, idx_t left_row) {
+	auto state = reinterpret_cast<PhysicalAsOfJoinState *>(state_);
+	auto &right = ((AsOfGlobalState &)*sink_state).right;
+	auto &left = state->left;
+	if (HasNullKey(left.keys, left_row)) {
+		return INVALID_INDEX;
+	}
+	// the RHS rows that precede the LHS row form a prefix of the sorted RHS, which only grows as the LHS advances
+	auto precedes = [&](idx_t position) {
+		auto cmp = ChunkCollection::CompareRows(right.keys, right.order[position], left.keys, left_row, key_orders,
+		                                        null_orders);
+		return match_equal_keys ? cmp <= 0 : cmp < 0;
+	};
+	// gallop over the RHS to find the end of the prefix, so that gaps between the LHS keys are skipped quickly
+	idx_t right_count = right.keys.Count();
+	idx_t begin = state->right_position;
+	idx_t end = begin;
+	idx_t step = 1;
+	while (end < right_count && precedes(end)) {
+		begin = end + 1;
+		end = begin + step;
+		step *= 2;
+	}
+	end = MinValue<idx_t>(end, right_count);
+	while (begin < end) {
+		idx_t middle = begin + (end - begin) / 2;
+		if (precedes(middle)) {
+			begin = middle + 1;
+		} else {
+			end = middle;
+		}
+	}
+	state->right_position = begin;
+	if (begin == 0) {
+		return INVALID_INDEX;
+	}
+	// the last preceding RHS row is the closest match, provided that its equality keys match as well
+	auto candidate = right.order[begin - 1];
+	if (ChunkCollection::CompareRows(right.keys, candidate, left.keys, left_row, equality_orders, null_orders) != 0) {
+		return INVALID_INDEX;
+	}
+	return candidate;
+}
+
+void PhysicalAsOfJoin::GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state_) {
+	auto state = reinterpret_cast<PhysicalAsOfJoinState *>(state_);
+	auto &right = ((AsOfGlobalState &)*sink_state).right;
+
+	if (right.rows.Count() == 0) {
+		// empty RHS: construct empty result
+		if (join_type == JoinType::INNER) {
+			return;
+		}
+		children[0]->GetChunk(context, state->child_chunk, state->child_state.get());
+		if (state->child_chunk.size() == 0) {
+			return;
+		}
+		ConstructEmptyJoinResult(join_type, false, state->child_chunk, chunk);
+		return;
+	}
+	if (!state->initialized) {
+		InitializeJoin(context, state_);
+		state->initialized = true;
+	}
+	auto &left = state->left;
+
+	// merge the sorted LHS with the sorted RHS
+	idx_t result_count = 0;
+	bool has_unmatched = false;
+	while (state->left_position < left.rows.Count() && result_count < STANDARD_VECTOR_SIZE) {
+		auto left_row = left.order[state->left_position++];
+		auto right_row = FindMatch(state_, left_row);
+		if (right_row == INVALID_INDEX) {
+			if (join_type == JoinType::INNER) {
+				continue;
+			}
+			// LEFT join: the RHS columns of this row are set to NULL below
+			has_unmatched = true;
+		}
+		state->left_rows[result_count] = left_row;
+		state->right_rows[result_count] = right_row;
+		result_count++;
+	}
+	if (result_count == 0) {
+		return;
+	}
+
+	state->left_result.Reset();
+	state->right_result.Reset();
+	left.rows.MaterializeSortedChunk(state->left_result, state->left_rows, 0, result_count);
+	for (idx_t i = 0; has_unmatched && i < result_count; i++) {
+		state->found_match[i] = state->right_rows[i] != INVALID_INDEX;
+		if (!state->found_match[i]) {
+			// materialize an arbitrary RHS row, and set it to NULL afterwards
+			state->right_rows[i] = 0;
+		}
+	}
+	right.rows.MaterializeSortedChunk(state->right_result, state->right_rows, 0, result_count);
+	for (idx_t i = 0; has_unmatched && i < result_count; i++) {
+		if (!state->found_match[i]) {
+			for (idx_t col_idx = 0; col_idx < state->right_result.ColumnCount(); col_idx++) {
+				FlatVector::SetNull(state->right_result.data[col_idx], i, true);
+			}
+		}
+	}
+	chunk.SetCardinality(result_count);
+	idx_t left_column_count = state->left_result.ColumnCount();
+	for (idx_t i = 0; i < left_column_count; i++) {
+		chunk.data[i].Reference(state->left_result.data[i]);
+	}
+	for (idx_t i = 0; i < state->right_result.ColumnCount(); i++) {
+		chunk.data[left_column_count + i].Reference(state->right_result.data[i]);
+	}
+}
+
+unique_ptr<PhysicalOperatorState> PhysicalAsOfJoin::GetOperatorState() {
+	return make_unique<PhysicalAsOfJoinState>(*this, children[0].get(), conditions);
+}
+
+} // namespace duckdb
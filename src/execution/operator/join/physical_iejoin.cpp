@@ -0,0 +1,779 @@
+#include "duckdb/execution/operator/join/physical_iejoin.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/chunk_collection.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+PhysicalIEJoin::PhysicalIEJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left,
+                               unique_ptr<PhysicalOperator> right, vector<JoinCondition> cond, JoinType join_type)
+    : PhysicalComparisonJoin(op, PhysicalOperatorType::IE_JOIN, move(cond), join_type) {
+	D_ASSERT(CanUseIEJoin(conditions, join_type));
+	for (auto &cond : conditions) {
+		D_ASSERT(cond.left->return_type == cond.right->return_type);
+		join_key_types.push_back(cond.left->return_type);
+	}
+	children.push_back(move(left));
+	children.push_back(move(right));
+}
+
+static bool IsRangeComparison(ExpressionType comparison) {
+	switch (comparison) {
+	case ExpressionType::COMPARE_LESSTHAN:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsStrictComparison(ExpressionType comparison) {
+	return comparison == ExpressionType::COMPARE_LESSTHAN || comparison == ExpressionType::COMPARE_GREATERTHAN;
+}
+
+bool PhysicalIEJoin::CanUseIEJoin(const vector<JoinCondition> &conditions, JoinType join_type) {
+	if (join_type != JoinType::INNER && join_type != JoinType::LEFT) {
+		return false;
+	}
+	if (conditions.size() != 2) {
+		return false;
+	}
+	for (auto &cond : conditions) {
+		if (!IsRangeComparison(cond.comparison) || cond.null_values_are_equal) {
+			return false;
+		}
+		if (cond.left->return_type != cond.right->return_type) {
+			return false;
+		}
+		switch (cond.left->return_type.InternalType()) {
+		case PhysicalType::INT8:
+		case PhysicalType::INT16:
+		case PhysicalType::INT32:
+		case PhysicalType::INT64:
+		case PhysicalType::INT128:
+		case PhysicalType::FLOAT:
+		case PhysicalType::DOUBLE:
+		case PhysicalType::VARCHAR:
+			break;
+		default:
+			return false;
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Sorted Tables
+//===--------------------------------------------------------------------===//
+// The IEJoin visits the rows of both sides in two orders:
+// * L1 is the order on the first join key, in which the RHS rows that match the first condition of a LHS row are
+//   exactly the RHS rows positioned after it.
+// * L2 is the order on the second join key, in which the RHS rows that match the second condition of a LHS row are
+//   exactly the RHS rows visited before it.
+// Ties between the LHS and the RHS are broken so that equal keys only match for non-strict comparisons.
+struct IEJoinOrder {
+	//! Whether or not the keys are sorted in descending order
+	bool desc;
+	//! Whether or not RHS rows come before LHS rows with an equal key
+	bool right_first;
+};
+
+static IEJoinOrder GetJoinOrder(const JoinCondition &cond, idx_t cond_idx) {
+	IEJoinOrder order;
+	bool less_than = cond.comparison == ExpressionType::COMPARE_LESSTHAN ||
+	                 cond.comparison == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+	bool strict = IsStrictComparison(cond.comparison);
+	if (cond_idx == 0) {
+		order.desc = !less_than;
+		order.right_first = strict;
+	} else {
+		order.desc = less_than;
+		order.right_first = !strict;
+	}
+	return order;
+}
+
+//! The amount of rows in a block. Both sides are split into blocks that are joined pairwise, so the memory that a
+//! thread needs to join a pair of blocks does not depend on the size of either side.
+static constexpr idx_t IEJOIN_BLOCK_SIZE = 64 * STANDARD_VECTOR_SIZE;
+
+//! A block of rows (without NULL keys) of one side of the IEJoin, sorted on both join keys
+struct IEJoinBlock {
+	//! The rows of the block, sorted on the first join key
+	vector<idx_t> rows;
+	//! The positions in "rows", sorted on the second join key
+	vector<idx_t> second_order;
+};
+
+//! The materialized rows of one side of the IEJoin (or of the part of it that was collected by a single thread),
+//! together with their join keys and the blocks they are split into
+struct IEJoinSortedTable {
+	//! The materialized rows
+	ChunkCollection rows;
+	//! The join keys of the rows
+	ChunkCollection keys;
+	//! The join keys, stored contiguously per condition
+	unique_ptr<data_t[]> key_data[2];
+	//! The rows without NULL keys, sorted on the first join key and cut into blocks
+	vector<unique_ptr<IEJoinBlock>> blocks;
+
+	//! Gathers the join keys, sorts the rows without NULL keys on the first join key and splits them into blocks that
+	//! are sorted on the second join key
+	void Sort(const IEJoinOrder join_orders[]);
+};
+
+//! Sorts the given positions on their keys. A position refers to keys[rows[position]], or to keys[position] if rows is
+//! a nullptr.
+template <class T>
+static void TemplatedSortKeys(data_ptr_t key_data, const idx_t *rows, vector<idx_t> &order, bool desc) {
+	auto keys = (T *)key_data;
+	if (!rows) {
+		if (desc) {
+			std::sort(order.begin(), order.end(),
+			          [&](const idx_t &a, const idx_t &b) { return GreaterThan::Operation<T>(keys[a], keys[b]); });
+		} else {
+			std::sort(order.begin(), order.end(),
+			          [&](const idx_t &a, const idx_t &b) { return LessThan::Operation<T>(keys[a], keys[b]); });
+		}
+		return;
+	}
+	if (desc) {
+		std::sort(order.begin(), order.end(), [&](const idx_t &a, const idx_t &b) {
+			return GreaterThan::Operation<T>(keys[rows[a]], keys[rows[b]]);
+		});
+	} else {
+		std::sort(order.begin(), order.end(), [&](const idx_t &a, const idx_t &b) {
+			return LessThan::Operation<T>(keys[rows[a]], keys[rows[b]]);
+		});
+	}
+}
+
+static void SortKeys(PhysicalType type, data_ptr_t key_data, const idx_t *rows, vector<idx_t> &order, bool desc) {
+	switch (type) {
+	case PhysicalType::INT8:
+		TemplatedSortKeys<int8_t>(key_data, rows, order, desc);
+		break;
+	case PhysicalType::INT16:
+		TemplatedSortKeys<int16_t>(key_data, rows, order, desc);
+		break;
+	case PhysicalType::INT32:
+		TemplatedSortKeys<int32_t>(key_data, rows, order, desc);
+		break;
+	case PhysicalType::INT64:
+		TemplatedSortKeys<int64_t>(key_data, rows, order, desc);
+		break;
+	case PhysicalType::INT128:
+		TemplatedSortKeys<hugeint_t>(key_data, rows, order, desc);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedSortKeys<float>(key_data, rows, order, desc);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedSortKeys<double>(key_data, rows, order, desc);
+		break;
+	case PhysicalType::VARCHAR:
+		TemplatedSortKeys<string_t>(key_data, rows, order, desc);
+		break;
+	default:
+		throw NotImplementedException("Unimplemented type for IEJoin");
+	}
+}
+
+void IEJoinSortedTable::Sort(const IEJoinOrder join_orders[]) {
+	D_ASSERT(keys.ColumnCount() == 2);
+	// copy the keys into contiguous arrays, and gather the rows that have no NULL keys
+	for (idx_t k = 0; k < 2; k++) {
+		auto type = keys.Types()[k].InternalType();
+		auto width = GetTypeIdSize(type);
+		key_data[k] = unique_ptr<data_t[]>(new data_t[MaxValue<idx_t>(keys.Count(), 1) * width]);
+		for (idx_t chunk_idx = 0; chunk_idx < keys.ChunkCount(); chunk_idx++) {
+			auto &chunk = keys.GetChunk(chunk_idx);
+			memcpy(key_data[k].get() + chunk_idx * STANDARD_VECTOR_SIZE * width, FlatVector::GetData(chunk.data[k]),
+			       chunk.size() * width);
+		}
+	}
+	vector<idx_t> valid_rows;
+	for (idx_t chunk_idx = 0; chunk_idx < keys.ChunkCount(); chunk_idx++) {
+		auto &chunk = keys.GetChunk(chunk_idx);
+		auto &first_nullmask = FlatVector::Nullmask(chunk.data[0]);
+		auto &second_nullmask = FlatVector::Nullmask(chunk.data[1]);
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			if (!first_nullmask[i] && !second_nullmask[i]) {
+				valid_rows.push_back(chunk_idx * STANDARD_VECTOR_SIZE + i);
+			}
+		}
+	}
+	auto key_types = keys.Types();
+
+	// sort the rows on the first key, and cut them into blocks that are sorted on the second key
+	SortKeys(key_types[0].InternalType(), key_data[0].get(), nullptr, valid_rows, join_orders[0].desc);
+	for (idx_t start = 0; start < valid_rows.size(); start += IEJOIN_BLOCK_SIZE) {
+		idx_t end = MinValue<idx_t>(start + IEJOIN_BLOCK_SIZE, valid_rows.size());
+		auto block = make_unique<IEJoinBlock>();
+		block->rows.insert(block->rows.end(), valid_rows.begin() + start, valid_rows.begin() + end);
+		block->second_order.resize(block->rows.size());
+		for (idx_t i = 0; i < block->second_order.size(); i++) {
+			block->second_order[i] = i;
+		}
+		SortKeys(key_types[1].InternalType(), key_data[1].get(), block->rows.data(), block->second_order,
+		         join_orders[1].desc);
+		blocks.push_back(move(block));
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Block Pairs
+//===--------------------------------------------------------------------===//
+//! Merges the orders of a RHS block and a LHS block on one join key into a single order. RHS rows are identified by
+//! their position in the RHS block, LHS rows by their position in the LHS block plus the size of the RHS block.
+template <class T>
+static void TemplatedMergeBlocks(data_ptr_t right_data, const IEJoinBlock &right, data_ptr_t left_data,
+                                 const IEJoinBlock &left, idx_t cond_idx, IEJoinOrder join_order,
+                                 vector<idx_t> &result) {
+	auto right_keys = (T *)right_data;
+	auto left_keys = (T *)left_data;
+	idx_t right_count = right.rows.size(), left_count = left.rows.size();
+	// the blocks are sorted on the first key, and have a separate order on the second key
+	auto right_order = cond_idx == 0 ? nullptr : right.second_order.data();
+	auto left_order = cond_idx == 0 ? nullptr : left.second_order.data();
+
+	result.clear();
+	result.reserve(right_count + left_count);
+	idx_t right_idx = 0, left_idx = 0;
+	while (right_idx < right_count && left_idx < left_count) {
+		auto right_position = right_order ? right_order[right_idx] : right_idx;
+		auto left_position = left_order ? left_order[left_idx] : left_idx;
+		auto &right_key = right_keys[right.rows[right_position]];
+		auto &left_key = left_keys[left.rows[left_position]];
+		bool take_right;
+		if (Equals::Operation<T>(right_key, left_key)) {
+			take_right = join_order.right_first;
+		} else if (join_order.desc) {
+			take_right = GreaterThan::Operation<T>(right_key, left_key);
+		} else {
+			take_right = LessThan::Operation<T>(right_key, left_key);
+		}
+		if (take_right) {
+			result.push_back(right_position);
+			right_idx++;
+		} else {
+			result.push_back(right_count + left_position);
+			left_idx++;
+		}
+	}
+	for (; right_idx < right_count; right_idx++) {
+		result.push_back(right_order ? right_order[right_idx] : right_idx);
+	}
+	for (; left_idx < left_count; left_idx++) {
+		result.push_back(right_count + (left_order ? left_order[left_idx] : left_idx));
+	}
+}
+
+static void MergeBlocks(PhysicalType type, data_ptr_t right_data, const IEJoinBlock &right, data_ptr_t left_data,
+                        const IEJoinBlock &left, idx_t cond_idx, IEJoinOrder join_order, vector<idx_t> &result) {
+	switch (type) {
+	case PhysicalType::INT8:
+		TemplatedMergeBlocks<int8_t>(right_data, right, left_data, left, cond_idx, join_order, result);
+		break;
+	case PhysicalType::INT16:
+		TemplatedMergeBlocks<int16_t>(right_data, right, left_data, left, cond_idx, join_order, result);
+		break;
+	case PhysicalType::INT32:
+		TemplatedMergeBlocks<int32_t>(right_data, right, left_data, left, cond_idx, join_order, result);
+		break;
+	case PhysicalType::INT64:
+		TemplatedMergeBlocks<int64_t>(right_data, right, left_data, left, cond_idx, join_order, result);
+		break;
+	case PhysicalType::INT128:
+		TemplatedMergeBlocks<hugeint_t>(right_data, right, left_data, left, cond_idx, join_order, result);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedMergeBlocks<float>(right_data, right, left_data, left, cond_idx, join_order, result);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedMergeBlocks<double>(right_data, right, left_data, left, cond_idx, join_order, result);
+		break;
+	case PhysicalType::VARCHAR:
+		TemplatedMergeBlocks<string_t>(right_data, right, left_data, left, cond_idx, join_order, result);
+		break;
+	default:
+		throw NotImplementedException("Unimplemented type for IEJoin");
+	}
+}
+
+//! Returns whether or not any LHS key in [left_min, left_max] can satisfy the comparison with any RHS key in
+//! [right_min, right_max]
+template <class T>
+static bool TemplatedKeyRangesOverlap(data_ptr_t left_data, idx_t left_min, idx_t left_max, data_ptr_t right_data,
+                                      idx_t right_min, idx_t right_max, ExpressionType comparison) {
+	auto left_keys = (T *)left_data;
+	auto right_keys = (T *)right_data;
+	switch (comparison) {
+	case ExpressionType::COMPARE_LESSTHAN:
+		return LessThan::Operation<T>(left_keys[left_min], right_keys[right_max]);
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return LessThanEquals::Operation<T>(left_keys[left_min], right_keys[right_max]);
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return GreaterThan::Operation<T>(left_keys[left_max], right_keys[right_min]);
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return GreaterThanEquals::Operation<T>(left_keys[left_max], right_keys[right_min]);
+	default:
+		throw InternalException("Unsupported comparison for IEJoin");
+	}
+}
+
+static bool KeyRangesOverlap(PhysicalType type, data_ptr_t left_data, idx_t left_min, idx_t left_max,
+                             data_ptr_t right_data, idx_t right_min, idx_t right_max, ExpressionType comparison) {
+	switch (type) {
+	case PhysicalType::INT8:
+		return TemplatedKeyRangesOverlap<int8_t>(left_data, left_min, left_max, right_data, right_min, right_max,
+		                                         comparison);
+	case PhysicalType::INT16:
+		return TemplatedKeyRangesOverlap<int16_t>(left_data, left_min, left_max, right_data, right_min, right_max,
+		                                          comparison);
+	case PhysicalType::INT32:
+		return TemplatedKeyRangesOverlap<int32_t>(left_data, left_min, left_max, right_data, right_min, right_max,
+		                                          comparison);
+	case PhysicalType::INT64:
+		return TemplatedKeyRangesOverlap<int64_t>(left_data, left_min, left_max, right_data, right_min, right_max,
+		                                          comparison);
+	case PhysicalType::INT128:
+		return TemplatedKeyRangesOverlap<hugeint_t>(left_data, left_min, left_max, right_data, right_min, right_max,
+		                                            comparison);
+	case PhysicalType::FLOAT:
+		return TemplatedKeyRangesOverlap<float>(left_data, left_min, left_max, right_data, right_min, right_max,
+		                                        comparison);
+	case PhysicalType::DOUBLE:
+		return TemplatedKeyRangesOverlap<double>(left_data, left_min, left_max, right_data, right_min, right_max,
+		                                         comparison);
+	case PhysicalType::VARCHAR:
+		return TemplatedKeyRangesOverlap<string_t>(left_data, left_min, left_max, right_data, right_min, right_max,
+		                                           comparison);
+	default:
+		throw NotImplementedException("Unimplemented type for IEJoin");
+	}
+}
+
+//! Returns the rows with the smallest and the largest key of a block on the given join key
+static void GetKeyRange(const IEJoinBlock &block, idx_t cond_idx, IEJoinOrder join_order, idx_t &min_row,
+                        idx_t &max_row) {
+	D_ASSERT(!block.rows.empty());
+	idx_t first_row, last_row;
+	if (cond_idx == 0) {
+		first_row = block.rows.front();
+		last_row = block.rows.back();
+	} else {
+		first_row = block.rows[block.second_order.front()];
+		last_row = block.rows[block.second_order.back()];
+	}
+	min_row = join_order.desc ? last_row : first_row;
+	max_row = join_order.desc ? first_row : last_row;
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class IEJoinLocalState : public LocalSinkState {
+public:
+	explicit IEJoinLocalState(vector<JoinCondition> &conditions) : right(make_unique<IEJoinSortedTable>()) {
+		vector<LogicalType> condition_types;
+		for (auto &cond : conditions) {
+			rhs_executor.AddExpression(*cond.right);
+			condition_types.push_back(cond.right->return_type);
+		}
+		join_keys.Initialize(condition_types);
+	}
+
+	//! The chunk holding the right condition
+	DataChunk join_keys;
+	//! The executor of the RHS condition
+	ExpressionExecutor rhs_executor;
+	//! The rows and join keys materialized by this thread
+	unique_ptr<IEJoinSortedTable> right;
+};
+
+//! A block of the RHS, together with the table that it refers to
+struct IEJoinRightBlock {
+	IEJoinSortedTable *table;
+	IEJoinBlock *block;
+};
+
+class IEJoinGlobalState : public GlobalOperatorState {
+public:
+	IEJoinGlobalState() : right_count(0) {
+	}
+
+	mutex lock;
+	//! The materialized and sorted parts of the RHS, one per thread
+	vector<unique_ptr<IEJoinSortedTable>> right_tables;
+	//! The amount of rows in the RHS
+	idx_t right_count;
+	//! The blocks of all parts of the RHS
+	vector<IEJoinRightBlock> right_blocks;
+};
+
+unique_ptr<GlobalOperatorState> PhysicalIEJoin::GetGlobalState(ClientContext &context) {
+	return make_unique<IEJoinGlobalState>();
+}
+
+unique_ptr<LocalSinkState> PhysicalIEJoin::GetLocalSinkState(ExecutionContext &context) {
+	return make_unique<IEJoinLocalState>(conditions);
+}
+
+void PhysicalIEJoin::Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate,
+                          DataChunk &input) {
+	auto &ie_state = (IEJoinLocalState &)lstate;
+
+	// resolve the join keys for this chunk
+	ie_state.rhs_executor.SetChunk(input);
+
+	ie_state.join_keys.Reset();
+	ie_state.join_keys.SetCardinality(input);
+	for (idx_t k = 0; k < conditions.size(); k++) {
+		ie_state.rhs_executor.ExecuteExpression(k, ie_state.join_keys.data[k]);
+	}
+	// append the join keys and the chunk to the thread-local chunk collections
+	ie_state.right->rows.Append(input);
+	ie_state.right->keys.Append(ie_state.join_keys);
+}
+
+void PhysicalIEJoin::Combine(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate) {
+	auto &gstate = (IEJoinGlobalState &)state;
+	auto &ie_state = (IEJoinLocalState &)lstate;
+	if (ie_state.right->rows.Count() == 0) {
+		return;
+	}
+	// every thread sorts and splits its own part of the RHS: the parts are never merged, as the LHS is joined with
+	// each of their blocks separately
+	IEJoinOrder join_orders[] = {GetJoinOrder(conditions[0], 0), GetJoinOrder(conditions[1], 1)};
+	ie_state.right->Sort(join_orders);
+
+	lock_guard<mutex> glock(gstate.lock);
+	gstate.right_count += ie_state.right->rows.Count();
+	gstate.right_tables.push_back(move(ie_state.right));
+}
+
+//===--------------------------------------------------------------------===//
+// Finalize
+//===--------------------------------------------------------------------===//
+void PhysicalIEJoin::Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> state) {
+	auto &gstate = (IEJoinGlobalState &)*state;
+	for (auto &table : gstate.right_tables) {
+		for (auto &block : table->blocks) {
+			gstate.right_blocks.push_back(IEJoinRightBlock {table.get(), block.get()});
+		}
+	}
+	PhysicalSink::Finalize(pipeline, context, move(state));
+}
+
+//===--------------------------------------------------------------------===//
+// GetChunkInternal
+//===--------------------------------------------------------------------===//
+class PhysicalIEJoinState : public PhysicalOperatorState {
+public:
+	PhysicalIEJoinState(PhysicalOperator &op, PhysicalOperator *left, vector<JoinCondition> &conditions)
+	    : PhysicalOperatorState(op, left), initialized(false), left_block_idx(0), right_block_idx(0),
+	      pair_initialized(false), order_position(0), scanning(false), current_left(0), scan_position(0),
+	      left_outer_position(0) {
+		vector<LogicalType> condition_types;
+		for (auto &cond : conditions) {
+			lhs_executor.AddExpression(*cond.left);
+			condition_types.push_back(cond.left->return_type);
+		}
+		join_keys.Initialize(condition_types);
+	}
+
+	//! Whether or not the LHS has been materialized and sorted
+	bool initialized;
+	//! The materialized LHS of this thread
+	IEJoinSortedTable left;
+	DataChunk join_keys;
+	//! The executor of the LHS condition
+	ExpressionExecutor lhs_executor;
+
+	//! The pair of blocks that is being joined
+	idx_t left_block_idx;
+	idx_t right_block_idx;
+	//! Whether or not the orders of the current pair of blocks have been merged
+	bool pair_initialized;
+
+	//! The merged L1 order of the current pair of blocks, and the position of every row in it
+	vector<idx_t> first_order;
+	vector<idx_t> first_position;
+	//! The merged L2 order of the current pair of blocks
+	vector<idx_t> second_order;
+	//! The bit array over L1 marking the RHS rows that match the second condition of the current LHS row
+	vector<uint64_t> bits;
+	//! One bit per word of the bit array, marking the non-empty words
+	vector<uint64_t> summary;
+
+	//! The position in the L2 order
+	idx_t order_position;
+	//! Whether or not we are scanning the bit array for the matches of a LHS row
+	bool scanning;
+	//! The LHS row that is being matched, and the next bit to check for it
+	idx_t current_left;
+	idx_t scan_position;
+
+	//! Whether or not every LHS row found a match (only used for LEFT joins)
+	unique_ptr<bool[]> left_found_match;
+	//! The position in the LHS in the final scan of the LEFT join
+	idx_t left_outer_position;
+
+	//! The matching LHS and RHS rows of the current output chunk
+	idx_t left_rows[STANDARD_VECTOR_SIZE];
+	idx_t right_rows[STANDARD_VECTOR_SIZE];
+	DataChunk left_result;
+	DataChunk right_result;
+};
+
+static constexpr idx_t IEJOIN_WORD_BITS = 64;
+
+static inline idx_t CountTrailingZeros(uint64_t word) {
+	D_ASSERT(word != 0);
+#if (__GNUC__ >= 4) || defined(__clang__)
+	return __builtin_ctzll(word);
+#else
+	idx_t result = 0;
+	while (!(word & 1)) {
+		word >>= 1;
+		result++;
+	}
+	return result;
+#endif
+}
+
+static inline void SetBit(PhysicalIEJoinState &state, idx_t position) {
+	idx_t word_idx = position / IEJOIN_WORD_BITS;
+	state.bits[word_idx] |= uint64_t(1) << (position % IEJOIN_WORD_BITS);
+	state.summary[word_idx / IEJOIN_WORD_BITS] |= uint64_t(1) << (word_idx % IEJOIN_WORD_BITS);
+}
+
+//! Returns the position of the first set bit at or after "position", or INVALID_INDEX if there is none
+static idx_t NextSetBit(PhysicalIEJoinState &state, idx_t position) {
+	idx_t word_idx = position / IEJOIN_WORD_BITS;
+	if (word_idx >= state.bits.size()) {
+		return INVALID_INDEX;
+	}
+	uint64_t word = state.bits[word_idx] & (~uint64_t(0) << (position % IEJOIN_WORD_BITS));
+	if (word) {
+		return word_idx * IEJOIN_WORD_BITS + CountTrailingZeros(word);
+	}
+	// use the summary to skip over the empty words
+	idx_t next_word = word_idx + 1;
+	idx_t summary_idx = next_word / IEJOIN_WORD_BITS;
+	if (summary_idx >= state.summary.size()) {
+		return INVALID_INDEX;
+	}
+	uint64_t summary_word = state.summary[summary_idx] & (~uint64_t(0) << (next_word % IEJOIN_WORD_BITS));
+	while (!summary_word) {
+		summary_idx++;
+		if (summary_idx >= state.summary.size()) {
+			return INVALID_INDEX;
+		}
+		summary_word = state.summary[summary_idx];
+	}
+	word_idx = summary_idx * IEJOIN_WORD_BITS + CountTrailingZeros(summary_word);
+	return word_idx * IEJOIN_WORD_BITS + CountTrailingZeros(state.bits[word_idx]);
+}
+
+
+void PhysicalIEJoin::InitializeJoin(ExecutionContext &context, PhysicalOperatorState *state_) {
+	auto state = reinterpret_cast<PhysicalIEJoinState *>(state_);
+	auto &left = state->left;
+
+	// materialize the LHS (or the part of it that is assigned to this thread)
+	while (true) {
+		children[0]->GetChunk(context, state->child_chunk, state->child_state.get());
+		if (state->child_chunk.size() == 0) {
+			break;
+		}
+		state->join_keys.Reset();
+		state->lhs_executor.SetChunk(state->child_chunk);
+		state->join_keys.SetCardinality(state->child_chunk);
+		for (idx_t k = 0; k < conditions.size(); k++) {
+			state->lhs_executor.ExecuteExpression(k, state->join_keys.data[k]);
+		}
+		left.rows.Append(state->child_chunk);
+		left.keys.Append(state->join_keys);
+	}
+	if (join_type == JoinType::LEFT) {
+		state->left_found_match = unique_ptr<bool[]>(new bool[MaxValue<idx_t>(left.rows.Count(), 1)]);
+		memset(state->left_found_match.get(), 0, sizeof(bool) * left.rows.Count());
+	}
+	state->left_result.Initialize(children[0]->types);
+	state->right_result.Initialize(children[1]->types);
+	if (left.rows.Count() == 0) {
+		return;
+	}
+
+	// sort the LHS and split it into blocks
+	IEJoinOrder join_orders[] = {GetJoinOrder(conditions[0], 0), GetJoinOrder(conditions[1], 1)};
+	left.Sort(join_orders);
+}
+
+bool PhysicalIEJoin::NextBlockPair(PhysicalOperatorState *state_) {
+	auto state = reinterpret_cast<PhysicalIEJoinState *>(state_);
+	auto &gstate = (IEJoinGlobalState &)*sink_state;
+	auto &left = state->left;
+
+	IEJoinOrder join_orders[] = {GetJoinOrder(conditions[0], 0), GetJoinOrder(conditions[1], 1)};
+	for (; state->left_block_idx < left.blocks.size(); state->left_block_idx++, state->right_block_idx = 0) {
+		auto &left_block = *left.blocks[state->left_block_idx];
+		for (; state->right_block_idx < gstate.right_blocks.size(); state->right_block_idx++) {
+			auto &right_table = *gstate.right_blocks[state->right_block_idx].table;
+			auto &right_block = *gstate.right_blocks[state->right_block_idx].block;
+			// skip the pair if the key ranges of the blocks cannot satisfy one of the conditions
+			bool can_match = true;
+			for (idx_t k = 0; k < 2 && can_match; k++) {
+				idx_t left_min, left_max, right_min, right_max;
+				GetKeyRange(left_block, k, join_orders[k], left_min, left_max);
+				GetKeyRange(right_block, k, join_orders[k], right_min, right_max);
+				can_match = KeyRangesOverlap(join_key_types[k].InternalType(), left.key_data[k].get(), left_min,
+				                             left_max, right_table.key_data[k].get(), right_min, right_max,
+				                             conditions[k].comparison);
+			}
+			if (!can_match) {
+				continue;
+			}
+			// merge the orders of both blocks, and compute the permutation from the L2 order to the L1 order
+			for (idx_t k = 0; k < 2; k++) {
+				MergeBlocks(join_key_types[k].InternalType(), right_table.key_data[k].get(), right_block,
+				            left.key_data[k].get(), left_block, k, join_orders[k],
+				            k == 0 ? state->first_order : state->second_order);
+			}
+			idx_t count = state->first_order.size();
+			state->first_position.resize(count);
+			for (idx_t i = 0; i < count; i++) {
+				state->first_position[state->first_order[i]] = i;
+			}
+			idx_t word_count = (count + IEJOIN_WORD_BITS - 1) / IEJOIN_WORD_BITS;
+			state->bits.assign(word_count, 0);
+			state->summary.assign((word_count + IEJOIN_WORD_BITS - 1) / IEJOIN_WORD_BITS, 0);
+			state->order_position = 0;
+			state->scanning = false;
+			return true;
+		}
+	}
+	return false;
+}
+
+void PhysicalIEJoin::GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state_) {
+	auto state = reinterpret_cast<PhysicalIEJoinState *>(state_);
+	auto &gstate = (IEJoinGlobalState &)*sink_state;
+
+	if (gstate.right_count == 0) {
+		// empty RHS: construct empty result
+		if (join_type == JoinType::INNER) {
+			return;
+		}
+		children[0]->GetChunk(context, state->child_chunk, state->child_state.get());
+		if (state->child_chunk.size() == 0) {
+			return;
+		}
+		ConstructEmptyJoinResult(join_type, false, state->child_chunk, chunk);
+		return;
+	}
+	if (!state->initialized) {
+		InitializeJoin(context, state_);
+		state->initialized = true;
+	}
+	auto &left = state->left;
+
+	// join the pairs of LHS and RHS blocks, every output chunk holds the matches of a single pair
+	while (state->pair_initialized || NextBlockPair(state_)) {
+		state->pair_initialized = true;
+		auto &left_block = *left.blocks[state->left_block_idx];
+		auto &right_table = *gstate.right_blocks[state->right_block_idx].table;
+		auto &right_block = *gstate.right_blocks[state->right_block_idx].block;
+		idx_t right_count = right_block.rows.size();
+
+		// walk the L2 order: RHS rows are marked in the bit array, and every LHS row matches all marked RHS rows that
+		// are positioned after it in the L1 order
+		idx_t result_count = 0;
+		while (result_count < STANDARD_VECTOR_SIZE) {
+			if (!state->scanning) {
+				if (state->order_position >= state->second_order.size()) {
+					// this pair is exhausted: move on to the next pair
+					state->pair_initialized = false;
+					state->right_block_idx++;
+					break;
+				}
+				auto row = state->second_order[state->order_position++];
+				if (row < right_count) {
+					SetBit(*state, state->first_position[row]);
+					continue;
+				}
+				state->current_left = row - right_count;
+				state->scan_position = state->first_position[row] + 1;
+				state->scanning = true;
+			}
+			auto position = NextSetBit(*state, state->scan_position);
+			if (position == INVALID_INDEX) {
+				state->scanning = false;
+				continue;
+			}
+			D_ASSERT(state->first_order[position] < right_count);
+			state->left_rows[result_count] = left_block.rows[state->current_left];
+			state->right_rows[result_count] = right_block.rows[state->first_order[position]];
+			result_count++;
+			state->scan_position = position + 1;
+		}
+		if (result_count == 0) {
+			continue;
+		}
+		if (state->left_found_match) {
+			for (idx_t i = 0; i < result_count; i++) {
+				state->left_found_match[state->left_rows[i]] = true;
+			}
+		}
+		state->left_result.Reset();
+		state->right_result.Reset();
+		left.rows.MaterializeSortedChunk(state->left_result, state->left_rows, 0, result_count);
+		right_table.rows.MaterializeSortedChunk(state->right_result, state->right_rows, 0, result_count);
+		chunk.SetCardinality(result_count);
+		idx_t left_column_count = state->left_result.ColumnCount();
+		for (idx_t i = 0; i < left_column_count; i++) {
+			chunk.data[i].Reference(state->left_result.data[i]);
+		}
+		for (idx_t i = 0; i < state->right_result.ColumnCount(); i++) {
+			chunk.data[left_column_count + i].Reference(state->right_result.data[i]);
+		}
+		return;
+	}
+	if (state->left_found_match) {
+		// LEFT join: output the LHS rows that found no match (including the rows with NULL keys)
+		idx_t result_count = 0;
+		while (state->left_outer_position < left.rows.Count() && result_count < STANDARD_VECTOR_SIZE) {
+			auto row = state->left_outer_position++;
+			if (!state->left_found_match[row]) {
+				state->left_rows[result_count++] = row;
+			}
+		}
+		if (result_count == 0) {
+			return;
+		}
+		state->left_result.Reset();
+		left.rows.MaterializeSortedChunk(state->left_result, state->left_rows, 0, result_count);
+		chunk.SetCardinality(result_count);
+		idx_t left_column_count = state->left_result.ColumnCount();
+		for (idx_t i = 0; i < left_column_count; i++) {
+			chunk.data[i].Reference(state->left_result.data[i]);
+		}
+		for (idx_t i = left_column_count; i < chunk.ColumnCount(); i++) {
+			chunk.data[i].vector_type = VectorType::CONSTANT_VECTOR;
+			ConstantVector::SetNull(chunk.data[i], true);
+		}
+	}
+}
+
+unique_ptr<PhysicalOperatorState> PhysicalIEJoin::GetOperatorState() {
+	return make_unique<PhysicalIEJoinState>(*this, children[0].get(), conditions);
+}
+
+} // namespace duckdb
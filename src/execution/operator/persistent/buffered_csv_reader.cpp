@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/gzip_stream.hpp"
+#include "duckdb/common/zstd_stream.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/to_string.hpp"
 #include "duckdb/common/types/cast_helpers.hpp"
@@ -10,6 +11,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/scalar/strftime.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/column_definition.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "utf8proc_wrapper.hpp"
@@ -164,10 +166,10 @@ unique_ptr<std::istream> BufferedCSVReader::OpenCSV(ClientContext &context, Buff
 	if (!FileSystem::GetFileSystem(context).FileExists(options.file_path)) {
 		throw IOException("File \"%s\" not found", options.file_path.c_str());
 	}
-	unique_ptr<std::istream> result;
+	decompression_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
 	// decide based on the extension which stream to use
-	if (StringUtil::EndsWith(StringUtil::Lower(options.file_path), ".gz")) {
-		result = make_unique<GzipStream>(options.file_path);
+	auto result = OpenCompressedCSV();
+	if (result) {
 		plain_file_source = false;
 	} else {
 		auto csv_local = make_unique<std::ifstream>();
@@ -184,6 +186,16 @@ unique_ptr<std::istream> BufferedCSVReader::OpenCSV(ClientContext &context, Buff
 	return result;
 }
 
+unique_ptr<std::istream> BufferedCSVReader::OpenCompressedCSV() {
+	auto file_path = StringUtil::Lower(options.file_path);
+	if (StringUtil::EndsWith(file_path, ".gz")) {
+		return make_unique<GzipStream>(options.file_path, decompression_threads);
+	} else if (StringUtil::EndsWith(file_path, ".zst")) {
+		return make_unique<ZstdStream>(options.file_path, decompression_threads);
+	}
+	return nullptr;
+}
+
 void BufferedCSVReader::SkipRowsAndReadHeader(idx_t skip_rows, bool skip_header) {
 	for (idx_t i = 0; i < skip_rows; i++) {
 		// ignore skip rows
@@ -217,10 +229,13 @@ void BufferedCSVReader::ResetBuffer() {
 }
 
 void BufferedCSVReader::ResetStream() {
-	if (!plain_file_source && StringUtil::EndsWith(StringUtil::Lower(options.file_path), ".gz")) {
-		// seeking to the beginning appears to not be supported in all compiler/os-scenarios,
-		// so we have to create a new stream source here for now
-		source = make_unique<GzipStream>(options.file_path);
+	unique_ptr<std::istream> compressed_source;
+	if (!plain_file_source) {
+		compressed_source = OpenCompressedCSV();
+	}
+	if (compressed_source) {
+		// seeking to the beginning of a compressed stream is not supported, so we create a new stream source
+		source = move(compressed_source);
 	} else {
 		source->clear();
 		source->seekg(0, source->beg);
@@ -5,6 +5,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/morsel_info.hpp"
 
 namespace duckdb {
 
@@ -29,8 +30,20 @@ public:
 
 	DataChunk insert_chunk;
 	ExpressionExecutor default_executor;
+	//! Verified chunks that have not been handed to the transaction-local storage yet
+	ChunkCollection local_collection;
 };
 
+static void FlushLocalCollection(ExecutionContext &context, TableCatalogEntry &table, InsertGlobalState &gstate,
+                                 InsertLocalState &istate) {
+	if (istate.local_collection.Count() == 0) {
+		return;
+	}
+	lock_guard<mutex> glock(gstate.lock);
+	gstate.insert_count += istate.local_collection.Count();
+	table.storage->LocalAppend(context.client, istate.local_collection);
+}
+
 void PhysicalInsert::Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate,
                           DataChunk &chunk) {
 	auto &gstate = (InsertGlobalState &)state;
@@ -62,9 +75,24 @@ void PhysicalInsert::Sink(ExecutionContext &context, GlobalOperatorState &state,
 		}
 	}
 
-	lock_guard<mutex> glock(gstate.lock);
-	table->storage->Append(*table, context.client, istate.insert_chunk);
-	gstate.insert_count += chunk.size();
+	auto &storage = *table->storage;
+	if (!storage.info->indexes.empty()) {
+		// the table has indexes: verify and append the chunk while holding the lock
+		lock_guard<mutex> glock(gstate.lock);
+		storage.Append(*table, context.client, istate.insert_chunk);
+		gstate.insert_count += chunk.size();
+		return;
+	}
+	// no indexes: verify the constraints and buffer the chunk thread-locally, the lock is only taken per morsel
+	storage.VerifyAppendConstraints(*table, istate.insert_chunk);
+	istate.local_collection.Append(istate.insert_chunk);
+	if (istate.local_collection.Count() >= MorselInfo::MORSEL_SIZE) {
+		FlushLocalCollection(context, *table, gstate, istate);
+	}
+}
+
+void PhysicalInsert::Combine(ExecutionContext &context, GlobalOperatorState &gstate, LocalSinkState &lstate) {
+	FlushLocalCollection(context, *table, (InsertGlobalState &)gstate, (InsertLocalState &)lstate);
 }
 
 unique_ptr<GlobalOperatorState> PhysicalInsert::GetGlobalState(ClientContext &context) {
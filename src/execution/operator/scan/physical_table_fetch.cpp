@@ -0,0 +1,63 @@
+#include "duckdb/execution/operator/scan/physical_table_fetch.hpp"
+
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/transaction.hpp"
+
+namespace duckdb {
+
+class PhysicalTableFetchState : public PhysicalOperatorState {
+public:
+	PhysicalTableFetchState(PhysicalOperator &op, PhysicalOperator *child, vector<LogicalType> &fetch_types)
+	    : PhysicalOperatorState(op, child) {
+		fetch_chunk.Initialize(fetch_types);
+	}
+
+	DataChunk fetch_chunk;
+	ColumnFetchState fetch_state;
+};
+
+PhysicalTableFetch::PhysicalTableFetch(vector<LogicalType> types, DataTable &table, idx_t row_id_index,
+                                       vector<column_t> fetch_ids, vector<LogicalType> fetch_types,
+                                       vector<idx_t> projection_map)
+    : PhysicalOperator(PhysicalOperatorType::TABLE_FETCH, move(types)), table(table), row_id_index(row_id_index),
+      fetch_ids(move(fetch_ids)), fetch_types(move(fetch_types)), projection_map(move(projection_map)) {
+}
+
+void PhysicalTableFetch::GetChunkInternal(ExecutionContext &context, DataChunk &chunk,
+                                          PhysicalOperatorState *state_) {
+	auto state = reinterpret_cast<PhysicalTableFetchState *>(state_);
+	auto &transaction = Transaction::GetTransaction(context.client);
+
+	// get the next chunk from the child
+	children[0]->GetChunk(context, state->child_chunk, state->child_state.get());
+	if (state->child_chunk.size() == 0) {
+		return;
+	}
+	idx_t count = state->child_chunk.size();
+
+	// fetch the remaining columns of the rows
+	auto &row_ids = state->child_chunk.data[row_id_index];
+	row_ids.Normalify(count);
+	state->fetch_chunk.Reset();
+	table.Fetch(transaction, state->fetch_chunk, fetch_ids, row_ids, count, state->fetch_state);
+	if (state->fetch_chunk.size() != count) {
+		throw InternalException("Late materialization could not fetch all rows emitted by the scan");
+	}
+
+	idx_t input_count = state->child_chunk.ColumnCount();
+	for (idx_t i = 0; i < projection_map.size(); i++) {
+		auto index = projection_map[i];
+		if (index < input_count) {
+			chunk.data[i].Reference(state->child_chunk.data[index]);
+		} else {
+			chunk.data[i].Reference(state->fetch_chunk.data[index - input_count]);
+		}
+	}
+	chunk.SetCardinality(count);
+}
+
+unique_ptr<PhysicalOperatorState> PhysicalTableFetch::GetOperatorState() {
+	return make_unique<PhysicalTableFetchState>(*this, children[0].get(), fetch_types);
+}
+
+} // namespace duckdb
@@ -31,6 +31,8 @@ void PhysicalCreateIndex::GetChunkInternal(ExecutionContext &context, DataChunk
 	}
 	index_entry->index = index.get();
 	index_entry->info = table.storage->info;
+	// read the data of the table first, so the index is filled (and checked for duplicates) right away
+	table.storage->LoadPersistentData();
 	table.storage->AddIndex(move(index), expressions);
 
 	chunk.SetCardinality(0);
@@ -1,8 +1,10 @@
 #include "duckdb/execution/operator/schema/physical_create_table_as.hpp"
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/types/chunk_collection.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/morsel_info.hpp"
 
 namespace duckdb {
 
@@ -24,6 +26,12 @@ public:
 	int64_t inserted_count;
 };
 
+class CreateTableAsLocalState : public LocalSinkState {
+public:
+	//! Chunks that have not been handed to the transaction-local storage yet
+	ChunkCollection local_collection;
+};
+
 unique_ptr<GlobalOperatorState> PhysicalCreateTableAs::GetGlobalState(ClientContext &context) {
 	auto sink = make_unique<CreateTableAsGlobalState>();
 	auto &catalog = Catalog::GetCatalog(context);
@@ -31,13 +39,37 @@ unique_ptr<GlobalOperatorState> PhysicalCreateTableAs::GetGlobalState(ClientCont
 	return move(sink);
 }
 
+unique_ptr<LocalSinkState> PhysicalCreateTableAs::GetLocalSinkState(ExecutionContext &context) {
+	return make_unique<CreateTableAsLocalState>();
+}
+
+static void FlushLocalCollection(ExecutionContext &context, CreateTableAsGlobalState &sink,
+                                 CreateTableAsLocalState &lstate) {
+	if (lstate.local_collection.Count() == 0) {
+		return;
+	}
+	lock_guard<mutex> client_guard(sink.append_lock);
+	sink.inserted_count += lstate.local_collection.Count();
+	sink.table->storage->LocalAppend(context.client, lstate.local_collection);
+}
+
 void PhysicalCreateTableAs::Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate_,
                                  DataChunk &input) {
 	auto &sink = (CreateTableAsGlobalState &)state;
+	auto &lstate = (CreateTableAsLocalState &)lstate_;
+	if (sink.table) {
+		// the new table has no constraints or indexes: buffer the chunk thread-locally and append it per morsel
+		lstate.local_collection.Append(input);
+		if (lstate.local_collection.Count() >= MorselInfo::MORSEL_SIZE) {
+			FlushLocalCollection(context, sink, lstate);
+		}
+	}
+}
+
+void PhysicalCreateTableAs::Combine(ExecutionContext &context, GlobalOperatorState &gstate, LocalSinkState &lstate) {
+	auto &sink = (CreateTableAsGlobalState &)gstate;
 	if (sink.table) {
-		lock_guard<mutex> client_guard(sink.append_lock);
-		sink.table->storage->Append(*sink.table, context.client, input);
-		sink.inserted_count += input.size();
+		FlushLocalCollection(context, sink, (CreateTableAsLocalState &)lstate);
 	}
 }
 
@@ -1,14 +1,21 @@
 #include "duckdb/execution/operator/set/physical_union.hpp"
 
+#include "duckdb/parallel/task_context.hpp"
+
 namespace duckdb {
 
 class PhysicalUnionOperatorState : public PhysicalOperatorState {
 public:
-	PhysicalUnionOperatorState(PhysicalOperator &op) : PhysicalOperatorState(op, nullptr), top_done(false) {
+	PhysicalUnionOperatorState(PhysicalOperator &op)
+	    : PhysicalOperatorState(op, nullptr), top_done(false), initialized(false), single_branch(false) {
 	}
 	unique_ptr<PhysicalOperatorState> top_state;
 	unique_ptr<PhysicalOperatorState> bottom_state;
 	bool top_done = false;
+	//! Whether or not the task info has been checked for a branch to execute
+	bool initialized;
+	//! Whether or not only a single branch of the union is executed (because the branches are executed in parallel)
+	bool single_branch;
 };
 
 PhysicalUnion::PhysicalUnion(vector<LogicalType> types, unique_ptr<PhysicalOperator> top,
@@ -21,10 +28,24 @@ PhysicalUnion::PhysicalUnion(vector<LogicalType> types, unique_ptr<PhysicalOpera
 // first exhaust top, then exhaust bottom. state to remember which.
 void PhysicalUnion::GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state_) {
 	auto state = reinterpret_cast<PhysicalUnionOperatorState *>(state_);
+	if (!state->initialized) {
+		// check if this task only executes one of the branches
+		auto task_info = context.task.task_info.find(this);
+		if (task_info != context.task.task_info.end()) {
+			auto &branch_state = (UnionBranchState &)*task_info->second;
+			state->single_branch = true;
+			state->top_done = branch_state.branch == 1;
+		}
+		state->initialized = true;
+	}
 	if (!state->top_done) {
 		children[0]->GetChunk(context, chunk, state->top_state.get());
 		if (chunk.size() == 0) {
 			state->top_done = true;
+			if (state->single_branch) {
+				state->finished = true;
+				return;
+			}
 		}
 	}
 	if (state->top_done) {
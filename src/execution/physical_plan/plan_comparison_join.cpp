@@ -1,5 +1,7 @@
+#include "duckdb/execution/operator/join/physical_asof_join.hpp"
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/join/physical_iejoin.hpp"
 #include "duckdb/execution/operator/join/physical_index_join.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
@@ -42,6 +44,8 @@ void TransformIndexJoin(ClientContext &context, LogicalComparisonJoin &op, Index
 			if (can_plan_index_join(transaction, tbl, tbl_scan)) {
 				for (auto &index : tbl->table->storage->info->indexes) {
 					if (index->unbound_expressions[0]->alias == op.conditions[0].left->alias) {
+						// the index is only filled once the data of the table has been read
+						tbl->table->storage->LoadPersistentData();
 						*left_index = index.get();
 						break;
 					}
@@ -54,6 +58,8 @@ void TransformIndexJoin(ClientContext &context, LogicalComparisonJoin &op, Index
 			if (can_plan_index_join(transaction, tbl, tbl_scan)) {
 				for (auto &index : tbl->table->storage->info->indexes) {
 					if (index->unbound_expressions[0]->alias == op.conditions[0].right->alias) {
+						// the index is only filled once the data of the table has been read
+						tbl->table->storage->LoadPersistentData();
 						*right_index = index.get();
 						break;
 					}
@@ -72,6 +78,9 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalComparison
 	auto right = CreatePlan(*op.children[1]);
 	D_ASSERT(left && right);
 
+	if (op.type == LogicalOperatorType::LOGICAL_ASOF_JOIN) {
+		return make_unique<PhysicalAsOfJoin>(op, move(left), move(right), move(op.conditions), op.join_type);
+	}
 	if (op.conditions.size() == 0) {
 		// no conditions: insert a cross product
 		return make_unique<PhysicalCrossProduct>(op.types, move(left), move(right));
@@ -120,6 +129,9 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalComparison
 			// range join: use piecewise merge join
 			plan =
 			    make_unique<PhysicalPiecewiseMergeJoin>(op, move(left), move(right), move(op.conditions), op.join_type);
+		} else if (PhysicalIEJoin::CanUseIEJoin(op.conditions, op.join_type)) {
+			// two range conditions: use an inequality join
+			plan = make_unique<PhysicalIEJoin>(op, move(left), move(right), move(op.conditions), op.join_type);
 		} else {
 			// inequality join: use nested loop
 			plan = make_unique<PhysicalNestedLoopJoin>(op, move(left), move(right), move(op.conditions), op.join_type);
@@ -1,13 +1,186 @@
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/operator/order/physical_top_n.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_fetch.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
+#include "duckdb/planner/table_filter.hpp"
 
 namespace duckdb {
 
+static void ExtractReferences(Expression &expr, vector<bool> &referenced) {
+	if (expr.type == ExpressionType::BOUND_REF) {
+		referenced[((BoundReferenceExpression &)expr).index] = true;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { ExtractReferences(child, referenced); });
+}
+
+static void RemapReferences(Expression &expr, const vector<idx_t> &map) {
+	if (expr.type == ExpressionType::BOUND_REF) {
+		auto &ref = (BoundReferenceExpression &)expr;
+		ref.index = map[ref.index];
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { RemapReferences(child, map); });
+}
+
+//! Plans a TopN on top of a (projection of a) filtered table scan with late materialization: the scan only emits the
+//! columns required for filtering and ordering plus the row identifiers, and the remaining columns of the rows that
+//! survive the TopN are fetched afterwards. Returns nullptr if the plan does not have this shape.
+static unique_ptr<PhysicalOperator> PlanLateMaterialization(LogicalTopN &op, unique_ptr<PhysicalOperator> &plan) {
+	// match PROJECTION -> FILTER -> TABLE_SCAN, where the projection and the filter are optional
+	PhysicalProjection *projection = nullptr;
+	unique_ptr<PhysicalOperator> *filter_ptr = nullptr;
+	unique_ptr<PhysicalOperator> *scan_ptr = &plan;
+	if ((*scan_ptr)->type == PhysicalOperatorType::PROJECTION) {
+		projection = (PhysicalProjection *)scan_ptr->get();
+		scan_ptr = &(*scan_ptr)->children[0];
+	}
+	if ((*scan_ptr)->type == PhysicalOperatorType::FILTER) {
+		filter_ptr = scan_ptr;
+		scan_ptr = &(*scan_ptr)->children[0];
+	}
+	if ((*scan_ptr)->type != PhysicalOperatorType::TABLE_SCAN) {
+		return nullptr;
+	}
+	auto &scan = (PhysicalTableScan &)**scan_ptr;
+	if (scan.function.name != "seq_scan") {
+		return nullptr;
+	}
+	auto &table = *((TableScanBindData &)*scan.bind_data).table->storage;
+	idx_t scan_count = scan.column_ids.size();
+
+	// figure out which scan column every column of the TopN input refers to
+	vector<idx_t> input_map;
+	if (projection) {
+		for (auto &expr : projection->select_list) {
+			if (expr->type != ExpressionType::BOUND_REF) {
+				return nullptr;
+			}
+			input_map.push_back(((BoundReferenceExpression &)*expr).index);
+		}
+	} else {
+		for (idx_t i = 0; i < scan_count; i++) {
+			input_map.push_back(i);
+		}
+	}
+
+	// the columns used by filters, orders and row identifiers have to be scanned
+	vector<bool> early(scan_count, false);
+	if (scan.table_filters) {
+		for (auto &entry : scan.table_filters->filters) {
+			early[entry.first] = true;
+		}
+	}
+	if (filter_ptr) {
+		ExtractReferences(*((PhysicalFilter &)**filter_ptr).expression, early);
+	}
+	vector<bool> input_referenced(input_map.size(), false);
+	for (auto &order : op.orders) {
+		ExtractReferences(*order.expression, input_referenced);
+	}
+	for (idx_t i = 0; i < input_map.size(); i++) {
+		if (input_referenced[i]) {
+			early[input_map[i]] = true;
+		}
+	}
+	vector<column_t> column_ids;
+	vector<LogicalType> types;
+	vector<string> names;
+	vector<column_t> fetch_ids;
+	vector<LogicalType> fetch_types;
+	// scan_map maps the original scan columns to the new scan columns, fetch_map to the fetched columns
+	vector<idx_t> scan_map(scan_count, INVALID_INDEX);
+	vector<idx_t> fetch_map(scan_count, INVALID_INDEX);
+	for (idx_t i = 0; i < scan_count; i++) {
+		if (early[i] || scan.column_ids[i] == COLUMN_IDENTIFIER_ROW_ID) {
+			scan_map[i] = column_ids.size();
+			column_ids.push_back(scan.column_ids[i]);
+			types.push_back(scan.types[i]);
+			names.push_back(i < scan.names.size() ? scan.names[i] : string());
+		}
+	}
+	for (idx_t i = 0; i < input_map.size(); i++) {
+		auto scan_idx = input_map[i];
+		if (scan_map[scan_idx] == INVALID_INDEX && fetch_map[scan_idx] == INVALID_INDEX) {
+			fetch_map[scan_idx] = fetch_ids.size();
+			fetch_ids.push_back(scan.column_ids[scan_idx]);
+			fetch_types.push_back(scan.types[scan_idx]);
+		}
+	}
+	if (fetch_ids.empty()) {
+		// all columns are required by the TopN anyway
+		return nullptr;
+	}
+	idx_t row_id_index = column_ids.size();
+	column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	types.push_back(LOGICAL_ROW_TYPE);
+	names.push_back("rowid");
+
+	// create the narrow scan
+	unique_ptr<TableFilterSet> table_filters;
+	if (scan.table_filters) {
+		table_filters = make_unique<TableFilterSet>();
+		for (auto &entry : scan.table_filters->filters) {
+			auto column_index = scan_map[entry.first];
+			auto filters = entry.second;
+			for (auto &filter : filters) {
+				filter.column_index = column_index;
+			}
+			table_filters->filters.insert(make_pair(column_index, move(filters)));
+		}
+	}
+	unique_ptr<PhysicalOperator> narrow = make_unique<PhysicalTableScan>(
+	    types, scan.function, move(scan.bind_data), move(column_ids), move(names), move(table_filters));
+	if (filter_ptr) {
+		auto filter = move(*filter_ptr);
+		RemapReferences(*((PhysicalFilter &)*filter).expression, scan_map);
+		filter->types = types;
+		filter->children[0] = move(narrow);
+		narrow = move(filter);
+	}
+
+	// the TopN now refers to the columns of the narrow scan
+	vector<idx_t> order_map;
+	for (auto &scan_idx : input_map) {
+		order_map.push_back(scan_map[scan_idx]);
+	}
+	for (auto &order : op.orders) {
+		RemapReferences(*order.expression, order_map);
+	}
+	auto top_n = make_unique<PhysicalTopN>(types, move(op.orders), op.limit, op.offset);
+	top_n->children.push_back(move(narrow));
+
+	// finally fetch the remaining columns of the surviving rows
+	vector<idx_t> projection_map;
+	for (auto &scan_idx : input_map) {
+		if (scan_map[scan_idx] != INVALID_INDEX) {
+			projection_map.push_back(scan_map[scan_idx]);
+		} else {
+			projection_map.push_back(types.size() + fetch_map[scan_idx]);
+		}
+	}
+	auto fetch = make_unique<PhysicalTableFetch>(op.types, table, row_id_index, move(fetch_ids), move(fetch_types),
+	                                             move(projection_map));
+	fetch->children.push_back(move(top_n));
+	return move(fetch);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op) {
 	D_ASSERT(op.children.size() == 1);
 
 	auto plan = CreatePlan(*op.children[0]);
+	if (context.enable_late_materialization) {
+		auto late_plan = PlanLateMaterialization(op, plan);
+		if (late_plan) {
+			return late_plan;
+		}
+	}
 
 	auto top_n = make_unique<PhysicalTopN>(op.types, move(op.orders), op.limit, op.offset);
 	top_n->children.push_back(move(plan));
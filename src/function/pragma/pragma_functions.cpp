@@ -3,9 +3,11 @@
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/expression_binder.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/object_cache.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/common/enums/output_type.hpp"
 #include <cctype>
@@ -96,6 +98,7 @@ static void pragma_default_order(ClientContext &context, FunctionParameters para
 static void pragma_set_threads(ClientContext &context, FunctionParameters parameters) {
 	auto nr_threads = parameters.values[0].GetValue<int64_t>();
 	TaskScheduler::GetScheduler(context).SetThreads(nr_threads);
+	BufferManager::GetBufferManager(context).SetReadAheadThreads(nr_threads);
 }
 
 static void pragma_enable_verification(ClientContext &context, FunctionParameters parameters) {
@@ -118,6 +121,14 @@ static void pragma_disable_force_parallelism(ClientContext &context, FunctionPar
 	context.force_parallelism = false;
 }
 
+static void pragma_enable_late_materialization(ClientContext &context, FunctionParameters parameters) {
+	context.enable_late_materialization = true;
+}
+
+static void pragma_disable_late_materialization(ClientContext &context, FunctionParameters parameters) {
+	context.enable_late_materialization = false;
+}
+
 static void pragma_enable_object_cache(ClientContext &context, FunctionParameters parameters) {
 	DBConfig::GetConfig(context).object_cache_enable = true;
 }
@@ -167,6 +178,30 @@ static void pragma_perfect_ht_threshold(ClientContext &context, FunctionParamete
 	context.perfect_ht_threshold = bits;
 }
 
+static void pragma_plan_cache_size(ClientContext &context, FunctionParameters parameters) {
+	auto size = parameters.values[0].GetValue<int64_t>();
+	if (size < 0) {
+		throw ParserException("Plan cache size out of range: should be 0 or larger");
+	}
+	DBConfig::GetConfig(context).plan_cache_size = size;
+	PlanCache::GetPlanCache(context).SetCapacity(size);
+}
+
+static void pragma_block_cache_size(ClientContext &context, FunctionParameters parameters) {
+	idx_t size = ParseMemoryLimit(parameters.values[0].ToString());
+	if (size == INVALID_INDEX) {
+		throw ParserException("Block cache size must be a fixed amount of memory (e.g. PRAGMA block_cache_size='64MB')");
+	}
+	DBConfig::GetConfig(context).block_cache_size = size;
+	ObjectCache::GetObjectCache(context).block_cache.SetLimit(size);
+}
+
+static void pragma_block_cache_directory(ClientContext &context, FunctionParameters parameters) {
+	auto directory = parameters.values[0].ToString();
+	DBConfig::GetConfig(context).block_cache_directory = directory;
+	ObjectCache::GetObjectCache(context).block_cache.SetSpillDirectory(directory);
+}
+
 void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	register_enable_profiling(set);
 
@@ -207,8 +242,20 @@ void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 
 	set.AddFunction(PragmaFunction::PragmaStatement("force_index_join", pragma_enable_force_index_join));
 
+	set.AddFunction(
+	    PragmaFunction::PragmaStatement("enable_late_materialization", pragma_enable_late_materialization));
+	set.AddFunction(
+	    PragmaFunction::PragmaStatement("disable_late_materialization", pragma_disable_late_materialization));
+
 	set.AddFunction(
 	    PragmaFunction::PragmaAssignment("perfect_ht_threshold", pragma_perfect_ht_threshold, LogicalType::INTEGER));
+
+	set.AddFunction(PragmaFunction::PragmaAssignment("plan_cache_size", pragma_plan_cache_size, LogicalType::BIGINT));
+
+	set.AddFunction(
+	    PragmaFunction::PragmaAssignment("block_cache_size", pragma_block_cache_size, LogicalType::VARCHAR));
+	set.AddFunction(
+	    PragmaFunction::PragmaAssignment("block_cache_directory", pragma_block_cache_directory, LogicalType::VARCHAR));
 }
 
 idx_t ParseMemoryLimit(string arg) {
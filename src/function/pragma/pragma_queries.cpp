@@ -32,6 +32,10 @@ string pragma_show(ClientContext &context, FunctionParameters parameters) {
 	    parameters.values[0].ToString());
 }
 
+string pragma_block_cache_info(ClientContext &context, FunctionParameters parameters) {
+	return "SELECT * FROM pragma_block_cache_info()";
+}
+
 string pragma_version(ClientContext &context, FunctionParameters parameters) {
 	return "SELECT * FROM pragma_version()";
 }
@@ -60,6 +64,7 @@ void PragmaQueries::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaStatement("collations", pragma_collations));
 	set.AddFunction(PragmaFunction::PragmaCall("show", pragma_show, {LogicalType::VARCHAR}));
 	set.AddFunction(PragmaFunction::PragmaStatement("version", pragma_version));
+	set.AddFunction(PragmaFunction::PragmaStatement("block_cache_info", pragma_block_cache_info));
 	set.AddFunction(PragmaFunction::PragmaStatement("functions", pragma_functions));
 	set.AddFunction(PragmaFunction::PragmaCall("import_database", pragma_import_database, {LogicalType::VARCHAR}));
 }
@@ -65,37 +65,51 @@ static idx_t ContainsAligned(const unsigned char *haystack, idx_t haystack_size,
 	return INVALID_INDEX;
 }
 
-idx_t ContainsGeneric(const unsigned char *haystack, idx_t haystack_size, const unsigned char *needle,
-                      idx_t needle_size, idx_t base_offset) {
+static bool MatchesNeedleAt(const unsigned char *haystack, const unsigned char *needle, idx_t needle_size,
+                            idx_t offset) {
+	return haystack[offset] == needle[0] && haystack[offset + needle_size - 1] == needle[needle_size - 1] &&
+	       memcmp(haystack + offset + 1, needle + 1, needle_size - 2) == 0;
+}
+
+static idx_t ContainsGeneric(const unsigned char *haystack, idx_t haystack_size, const unsigned char *needle,
+                             idx_t needle_size, idx_t base_offset) {
 	if (needle_size > haystack_size) {
 		// needle is bigger than haystack: haystack cannot contain needle
 		return INVALID_INDEX;
 	}
-	// this implementation is inspired by Raphael Javaux's faststrstr (https://github.com/RaphaelJ/fast_strstr)
-	// generic contains; note that we can't use strstr because we don't have null-terminated strings anymore
-	// we keep track of a shifting window sum of all characters with window size equal to needle_size
-	// this shifting sum is used to avoid calling into memcmp;
-	// we only need to call into memcmp when the window sum is equal to the needle sum
-	// when that happens, the characters are potentially the same and we call into memcmp to check if they are
-	uint32_t sums_diff = 0;
-	for (idx_t i = 0; i < needle_size; i++) {
-		sums_diff += haystack[i];
-		sums_diff -= needle[i];
-	}
+	// generic contains for needles larger than 8 bytes; note that we can't use strstr because we don't have
+	// null-terminated strings anymore
+	// we look at eight candidate positions at a time, and compare both the first and the last character of the needle
+	// against them with a single 64-bit operation (SIMD within a register). only if one of the eight positions has a
+	// matching first and last character do we verify the candidates with memcmp
+	const uint64_t ones = 0x0101010101010101ULL;
+	const uint64_t highs = 0x8080808080808080ULL;
+	const uint64_t first = ones * needle[0];
+	const uint64_t last = ones * needle[needle_size - 1];
+	// the number of positions at which the needle can start
+	idx_t position_count = haystack_size - needle_size + 1;
 	idx_t offset = 0;
-	while (true) {
-		if (sums_diff == 0 && haystack[offset] == needle[0]) {
-			if (memcmp(haystack + offset, needle, needle_size) == 0) {
-				return base_offset + offset;
+	for (; offset + sizeof(uint64_t) <= position_count; offset += sizeof(uint64_t)) {
+		auto first_block = Load<uint64_t>(haystack + offset);
+		auto last_block = Load<uint64_t>(haystack + offset + needle_size - 1);
+		// a byte of diff is zero only if both the first and the last character match at that position
+		uint64_t diff = (first_block ^ first) | (last_block ^ last);
+		if (((diff - ones) & ~diff & highs) == 0) {
+			continue;
+		}
+		for (idx_t i = offset; i < offset + sizeof(uint64_t); i++) {
+			if (MatchesNeedleAt(haystack, needle, needle_size, i)) {
+				return base_offset + i;
 			}
 		}
-		if (offset > haystack_size - needle_size) {
-			return INVALID_INDEX;
+	}
+	// check the remaining positions one by one
+	for (; offset < position_count; offset++) {
+		if (MatchesNeedleAt(haystack, needle, needle_size, offset)) {
+			return base_offset + offset;
 		}
-		sums_diff -= haystack[offset];
-		sums_diff += haystack[offset + needle_size];
-		offset++;
 	}
+	return INVALID_INDEX;
 }
 
 idx_t ContainsFun::Find(const unsigned char *haystack, idx_t haystack_size, const unsigned char *needle,
@@ -189,11 +189,31 @@ static unique_ptr<FunctionData> like_bind_function(ClientContext &context, Scala
 	D_ASSERT(arguments.size() == 2 || arguments.size() == 3);
 	if (arguments[1]->IsFoldable()) {
 		Value pattern_str = ExpressionExecutor::EvaluateScalar(*arguments[1]);
+		if (pattern_str.is_null) {
+			return nullptr;
+		}
 		return LikeMatcher::CreateLikeMatcher(pattern_str.ToString());
 	}
 	return nullptr;
 }
 
+static unique_ptr<FunctionData> ilike_bind_function(ClientContext &context, ScalarFunction &bound_function,
+                                                    vector<unique_ptr<Expression>> &arguments) {
+	// for a constant pattern we prepare a matcher for the lowercased pattern, the input is lowercased while matching
+	D_ASSERT(arguments.size() == 2);
+	if (arguments[1]->IsFoldable()) {
+		Value pattern_str = ExpressionExecutor::EvaluateScalar(*arguments[1]);
+		if (pattern_str.is_null) {
+			return nullptr;
+		}
+		auto pattern = pattern_str.ToString();
+		string lowered_pattern(LowerFun::LowerLength(pattern.c_str(), pattern.size()), '\0');
+		LowerFun::LowerCase(pattern.c_str(), pattern.size(), &lowered_pattern[0]);
+		return LikeMatcher::CreateLikeMatcher(lowered_pattern);
+	}
+	return nullptr;
+}
+
 bool like_operator(const char *s, idx_t slen, const char *pattern, idx_t plen, char escape) {
 	return templated_like_operator<'%', '_'>(s, slen, pattern, plen, escape);
 }
@@ -421,7 +441,52 @@ template <typename Func> static void like_escape_function(DataChunk &args, Expre
 	    str, pattern, escape, result, args.size(), Func::template Operation<string_t, string_t, string_t>);
 }
 
-template <class ASCII_OP>
+template <class OP, bool INVERT, bool CASE_INSENSITIVE>
+static void ExecuteLike(Vector &str, Vector &pattern, FunctionData *bind_info, Vector &result, idx_t count) {
+	if (bind_info) {
+		auto &matcher = (LikeMatcher &)*bind_info;
+		if (CASE_INSENSITIVE) {
+			// the matcher holds the lowercased pattern: lowercase every string into a shared buffer before matching
+			string lowered;
+			UnaryExecutor::Execute<string_t, bool, true>(str, result, count, [&](string_t input) {
+				auto input_data = input.GetDataUnsafe();
+				auto input_size = input.GetSize();
+				lowered.resize(LowerFun::LowerLength(input_data, input_size));
+				LowerFun::LowerCase(input_data, input_size, &lowered[0]);
+				string_t lowered_input(lowered.c_str(), lowered.size());
+				return INVERT ? !matcher.Match(lowered_input) : matcher.Match(lowered_input);
+			});
+		} else {
+			// use fast like matcher
+			UnaryExecutor::Execute<string_t, bool, true>(str, result, count, [&](string_t input) {
+				return INVERT ? !matcher.Match(input) : matcher.Match(input);
+			});
+		}
+	} else {
+		// use generic like matcher
+		BinaryExecutor::ExecuteStandard<string_t, string_t, bool, OP, true>(str, pattern, result, count);
+	}
+}
+
+template <class OP, bool INVERT, bool CASE_INSENSITIVE = false>
+static void RegularLikeFunction(DataChunk &input, ExpressionState &state, Vector &result) {
+	auto &func_expr = (BoundFunctionExpression &)state.expr;
+	auto &str = input.data[0];
+	auto &pattern = input.data[1];
+	if (pattern.vector_type == VectorType::CONSTANT_VECTOR &&
+	    DictionaryVector::CanExecuteOnDictionary(str, input.size())) {
+		// dictionary input with a constant pattern: match every distinct string only once
+		Vector dict_result(result.type);
+		ExecuteLike<OP, INVERT, CASE_INSENSITIVE>(DictionaryVector::Child(str), pattern, func_expr.bind_info.get(),
+		                                          dict_result, DictionaryVector::DictionarySize(str));
+		result.Slice(dict_result, DictionaryVector::SelVector(str), input.size());
+		result.Normalify(input.size());
+		return;
+	}
+	ExecuteLike<OP, INVERT, CASE_INSENSITIVE>(str, pattern, func_expr.bind_info.get(), result, input.size());
+}
+
+template <class ASCII_OP, bool INVERT>
 static unique_ptr<BaseStatistics> ilike_propagate_stats(ClientContext &context, BoundFunctionExpression &expr,
                                                         FunctionData *bind_data,
                                                         vector<unique_ptr<BaseStatistics>> &child_stats) {
@@ -432,26 +497,11 @@ static unique_ptr<BaseStatistics> ilike_propagate_stats(ClientContext &context,
 	}
 	auto &sstats = (StringStatistics &)*child_stats[0];
 	if (!sstats.has_unicode) {
-		expr.function.function = ScalarFunction::BinaryFunction<string_t, string_t, bool, ASCII_OP, true>;
+		expr.function.function = RegularLikeFunction<ASCII_OP, INVERT, true>;
 	}
 	return nullptr;
 }
 
-template <class OP, bool INVERT>
-static void RegularLikeFunction(DataChunk &input, ExpressionState &state, Vector &result) {
-	auto &func_expr = (BoundFunctionExpression &)state.expr;
-	if (func_expr.bind_info) {
-		auto &matcher = (LikeMatcher &)*func_expr.bind_info;
-		// use fast like matcher
-		UnaryExecutor::Execute<string_t, bool, true>(input.data[0], result, input.size(), [&](string_t str) {
-			return INVERT ? !matcher.Match(str) : matcher.Match(str);
-		});
-	} else {
-		// use generic like matcher
-		BinaryExecutor::ExecuteStandard<string_t, string_t, bool, OP, true>(input.data[0], input.data[1], result,
-		                                                                    input.size());
-	}
-}
 void LikeFun::RegisterFunction(BuiltinFunctions &set) {
 	// like
 	set.AddFunction(ScalarFunction("~~", {LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::BOOLEAN,
@@ -464,12 +514,12 @@ void LikeFun::RegisterFunction(BuiltinFunctions &set) {
 	                               ScalarFunction::BinaryFunction<string_t, string_t, bool, GlobOperator, true>));
 	// ilike
 	set.AddFunction(ScalarFunction("~~*", {LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::BOOLEAN,
-	                               ScalarFunction::BinaryFunction<string_t, string_t, bool, ILikeOperator, true>, false,
-	                               nullptr, nullptr, ilike_propagate_stats<ILikeOperatorASCII>));
+	                               RegularLikeFunction<ILikeOperator, false, true>, false, ilike_bind_function, nullptr,
+	                               ilike_propagate_stats<ILikeOperatorASCII, false>));
 	// not ilike
 	set.AddFunction(ScalarFunction("!~~*", {LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::BOOLEAN,
-	                               ScalarFunction::BinaryFunction<string_t, string_t, bool, NotILikeOperator, true>,
-	                               false, nullptr, nullptr, ilike_propagate_stats<NotILikeOperatorASCII>));
+	                               RegularLikeFunction<NotILikeOperator, true, true>, false, ilike_bind_function,
+	                               nullptr, ilike_propagate_stats<NotILikeOperatorASCII, true>));
 }
 
 void LikeEscapeFun::RegisterFunction(BuiltinFunctions &set) {
@@ -12,18 +12,177 @@
 
 namespace duckdb {
 
+//! Extracts a literal that every string matched by the pattern contains, so inputs that do not contain it can be
+//! rejected with a substring search before invoking RE2. Only literals outside of groups are considered, and patterns
+//! with alternations or inline flags are not analyzed at all. Returns an empty string if no literal is found.
+static string ExtractRequiredLiteral(const string &pattern, const duckdb_re2::RE2::Options &options) {
+	if (!options.case_sensitive() || options.literal()) {
+		return string();
+	}
+	string best, current;
+	auto flush = [&]() {
+		if (current.size() > best.size()) {
+			best = current;
+		}
+		current.clear();
+	};
+	idx_t depth = 0;
+	idx_t i = 0;
+	while (i < pattern.size()) {
+		char c = pattern[i];
+		bool is_literal = false;
+		char literal = '\0';
+		idx_t next = i + 1;
+		switch (c) {
+		case '|':
+			// alternations make every literal optional
+			return string();
+		case '\\':
+			if (i + 1 >= pattern.size()) {
+				return string();
+			}
+			if (isalnum((unsigned char)pattern[i + 1]) || (unsigned char)pattern[i + 1] >= 0x80) {
+				if (!strchr("dDwWsSbBAz", pattern[i + 1])) {
+					// escapes that span multiple characters (\x41, \pL, \101) or that we do not know (\Q, \C)
+					return string();
+				}
+				// single character classes (\d, \w) and assertions (\b) end the literal
+				flush();
+			} else if (depth == 0) {
+				is_literal = true;
+				literal = pattern[i + 1];
+			}
+			next = i + 2;
+			break;
+		case '[': {
+			// skip over the character class
+			flush();
+			idx_t end = i + 1;
+			if (end < pattern.size() && pattern[end] == '^') {
+				end++;
+			}
+			if (end < pattern.size() && pattern[end] == ']') {
+				end++;
+			}
+			while (end < pattern.size() && pattern[end] != ']') {
+				end += pattern[end] == '\\' ? 2 : 1;
+			}
+			next = end + 1;
+			break;
+		}
+		case '(':
+			if (i + 1 < pattern.size() && pattern[i + 1] == '?') {
+				// inline flags can change the meaning of the remaining pattern
+				return string();
+			}
+			flush();
+			depth++;
+			break;
+		case ')':
+			flush();
+			if (depth > 0) {
+				depth--;
+			}
+			break;
+		case '{':
+			// repetition of a non-literal: skip the bounds
+			flush();
+			while (next < pattern.size() && pattern[next - 1] != '}') {
+				next++;
+			}
+			break;
+		case '.':
+		case '^':
+		case '$':
+		case '*':
+		case '+':
+		case '?':
+			flush();
+			break;
+		default:
+			if ((unsigned char)c >= 0x80) {
+				flush();
+			} else if (depth == 0) {
+				is_literal = true;
+				literal = c;
+			}
+			break;
+		}
+		if (is_literal) {
+			char quantifier = next < pattern.size() ? pattern[next] : '\0';
+			if (quantifier == '*' || quantifier == '?' || quantifier == '{') {
+				// the character is optional (or repeated a variable number of times)
+				flush();
+			} else if (quantifier == '+') {
+				// the character occurs at least once, but the literal cannot continue past the repetition
+				current += literal;
+				flush();
+			} else {
+				current += literal;
+			}
+		}
+		i = next;
+	}
+	flush();
+	return best;
+}
+
+static inline bool ContainsRequiredLiteral(const string_t &input, const string &literal) {
+	return ContainsFun::Find((const unsigned char *)input.GetDataUnsafe(), input.GetSize(),
+	                         (const unsigned char *)literal.c_str(), literal.size()) != INVALID_INDEX;
+}
+
 RegexpMatchesBindData::RegexpMatchesBindData(duckdb_re2::RE2::Options options,
                                              unique_ptr<duckdb_re2::RE2> constant_pattern, string range_min,
                                              string range_max, bool range_success)
     : options(move(options)), constant_pattern(std::move(constant_pattern)), range_min(range_min), range_max(range_max),
       range_success(range_success) {
+	if (this->constant_pattern) {
+		required_literal = ExtractRequiredLiteral(this->constant_pattern->pattern(), this->options);
+	}
 }
 
 RegexpMatchesBindData::~RegexpMatchesBindData() {
 }
 
 unique_ptr<FunctionData> RegexpMatchesBindData::Copy() {
-	return make_unique<RegexpMatchesBindData>(options, move(constant_pattern), range_min, range_max, range_success);
+	unique_ptr<duckdb_re2::RE2> pattern_copy;
+	if (constant_pattern) {
+		pattern_copy = make_unique<duckdb_re2::RE2>(constant_pattern->pattern(), options);
+	}
+	return make_unique<RegexpMatchesBindData>(options, move(pattern_copy), range_min, range_max, range_success);
+}
+
+RegexpMatchesSetBindData::RegexpMatchesSetBindData(duckdb_re2::RE2::Options options, vector<string> patterns,
+                                                   bool full_match)
+    : options(move(options)), patterns(move(patterns)), full_match(full_match) {
+	set = make_unique<duckdb_re2::RE2::Set>(this->options, full_match ? duckdb_re2::RE2::ANCHOR_BOTH
+	                                                                   : duckdb_re2::RE2::UNANCHORED);
+	bool all_literals = true;
+	for (auto &pattern : this->patterns) {
+		string error;
+		if (set->Add(pattern, &error) < 0) {
+			throw Exception(error);
+		}
+		regexes.push_back(make_unique<duckdb_re2::RE2>(pattern, this->options));
+		auto literal = ExtractRequiredLiteral(pattern, this->options);
+		all_literals = all_literals && !literal.empty();
+		required_literals.push_back(move(literal));
+	}
+	if (!all_literals) {
+		required_literals.clear();
+	}
+	if (!set->Compile()) {
+		// the set could not be compiled: fall back to matching the patterns one by one
+		set.reset();
+	}
+}
+
+RegexpMatchesSetBindData::~RegexpMatchesSetBindData() {
+}
+
+unique_ptr<FunctionData> RegexpMatchesSetBindData::Copy() {
+	return make_unique<RegexpMatchesSetBindData>(options, patterns, full_match);
 }
 
 static inline duckdb_re2::StringPiece CreateStringPiece(string_t &input) {
@@ -90,7 +249,11 @@ template <class OP> static void regexp_matches_function(DataChunk &args, Express
 	auto &info = (RegexpMatchesBindData &)*func_expr.bind_info;
 
 	if (info.constant_pattern) {
+		auto &literal = info.required_literal;
 		UnaryExecutor::Execute<string_t, bool, true>(strings, result, args.size(), [&](string_t input) {
+			if (!literal.empty() && !ContainsRequiredLiteral(input, literal)) {
+				return false;
+			}
 			return OP::Operation(CreateStringPiece(input), *info.constant_pattern);
 		});
 	} else {
@@ -105,6 +268,49 @@ template <class OP> static void regexp_matches_function(DataChunk &args, Express
 	}
 }
 
+static void regexp_matches_set_function(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = (BoundFunctionExpression &)state.expr;
+	auto &info = (RegexpMatchesSetBindData &)*func_expr.bind_info;
+
+	UnaryExecutor::Execute<string_t, bool, true>(args.data[0], result, args.size(), [&](string_t input) {
+		if (!info.required_literals.empty()) {
+			// every pattern requires a literal: if none of them is present none of the patterns can match
+			bool any_literal = false;
+			for (auto &literal : info.required_literals) {
+				if (ContainsRequiredLiteral(input, literal)) {
+					any_literal = true;
+					break;
+				}
+			}
+			if (!any_literal) {
+				return false;
+			}
+		}
+		auto piece = CreateStringPiece(input);
+		if (info.set) {
+			duckdb_re2::RE2::Set::ErrorInfo error;
+			if (info.set->Match(piece, nullptr, &error)) {
+				return true;
+			}
+			if (error.kind == duckdb_re2::RE2::Set::kNoError) {
+				return false;
+			}
+		}
+		// the DFA of the set failed (e.g. it ran out of memory): match the patterns one by one
+		for (auto &re : info.regexes) {
+			if (info.full_match ? RegexFullMatch::Operation(piece, *re) : RegexPartialMatch::Operation(piece, *re)) {
+				return true;
+			}
+		}
+		return false;
+	});
+}
+
+ScalarFunction RegexpFun::GetSetFunction() {
+	return ScalarFunction("regexp_matches_set", {LogicalType::VARCHAR}, LogicalType::BOOLEAN,
+	                      regexp_matches_set_function);
+}
+
 static unique_ptr<FunctionData> regexp_matches_get_bind_function(ClientContext &context, ScalarFunction &bound_function,
                                                                  vector<unique_ptr<Expression>> &arguments) {
 	// pattern is the second argument. If its constant, we can already prepare the pattern and store it for later.
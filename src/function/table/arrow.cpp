@@ -10,6 +10,7 @@
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/common/types/date.hpp"
 #include "duckdb/common/to_string.hpp"
+#include "duckdb/parallel/parallel_state.hpp"
 
 #include "utf8proc_wrapper.hpp"
 
@@ -18,23 +19,10 @@ namespace duckdb {
 struct ArrowScanFunctionData : public TableFunctionData {
 	ArrowArrayStream *stream;
 	ArrowSchema schema_root;
-	ArrowArray current_chunk_root;
-	idx_t chunk_idx = 0;
-	idx_t chunk_offset = 0;
+	//! The Arrow format of the indices of every dictionary-encoded column, or an empty string for regular columns
+	vector<string> index_formats;
 	bool is_consumed = false;
 
-	void ReleaseArray() {
-		if (current_chunk_root.release) {
-			for (idx_t child_idx = 0; child_idx < (idx_t)current_chunk_root.n_children; child_idx++) {
-				auto &child = *current_chunk_root.children[child_idx];
-				if (child.release) {
-					child.release(&child);
-				}
-			}
-			current_chunk_root.release(&current_chunk_root);
-		}
-	}
-
 	void ReleaseSchema() {
 		if (schema_root.release) {
 			for (idx_t child_idx = 0; child_idx < (idx_t)schema_root.n_children; child_idx++) {
@@ -49,10 +37,90 @@ struct ArrowScanFunctionData : public TableFunctionData {
 
 	~ArrowScanFunctionData() {
 		ReleaseSchema();
+	}
+};
+
+//! The dictionary of a dictionary-encoded column, converted into a vector once per record batch
+struct ArrowScanDictionary {
+	explicit ArrowScanDictionary(LogicalType type) : vector(type, false, false) {
+	}
+
+	Vector vector;
+	//! The storage of the dictionary values that could not be referenced directly
+	unique_ptr<data_t[]> data;
+};
+
+struct ArrowScanState : public FunctionOperatorData {
+	explicit ArrowScanState(vector<column_t> column_ids) : column_ids(move(column_ids)) {
+		current_chunk_root.release = nullptr;
+	}
+
+	//! The record batch that is currently being scanned and the offset within it
+	ArrowArray current_chunk_root;
+	idx_t chunk_offset = 0;
+	vector<column_t> column_ids;
+	//! Whether or not this is a parallel scan; in a parallel scan record batches are handed out by the parallel state
+	bool is_parallel = false;
+	//! The converted dictionaries of the current record batch, indexed by column index
+	unordered_map<idx_t, unique_ptr<ArrowScanDictionary>> dictionaries;
+
+	void ReleaseArray() {
+		if (current_chunk_root.release) {
+			for (idx_t child_idx = 0; child_idx < (idx_t)current_chunk_root.n_children; child_idx++) {
+				auto &child = *current_chunk_root.children[child_idx];
+				if (child.release) {
+					child.release(&child);
+				}
+			}
+			current_chunk_root.release(&current_chunk_root);
+		}
+		dictionaries.clear();
+		chunk_offset = 0;
+	}
+
+	~ArrowScanState() {
 		ReleaseArray();
 	}
 };
 
+struct ArrowScanParallelState : public ParallelState {
+	//! Lock that serializes calls to the (not thread-safe) stream
+	mutex lock;
+	bool finished = false;
+};
+
+static LogicalType GetArrowLogicalType(const string &format) {
+	if (format == "n") {
+		return LogicalType::SQLNULL;
+	} else if (format == "b") {
+		return LogicalType::BOOLEAN;
+	} else if (format == "c") {
+		return LogicalType::TINYINT;
+	} else if (format == "s") {
+		return LogicalType::SMALLINT;
+	} else if (format == "i") {
+		return LogicalType::INTEGER;
+	} else if (format == "l") {
+		return LogicalType::BIGINT;
+	} else if (format == "f") {
+		return LogicalType::FLOAT;
+	} else if (format == "g") {
+		return LogicalType::DOUBLE;
+	} else if (format == "d:38,0") { // decimal128
+		return LogicalType::HUGEINT;
+	} else if (format == "u") {
+		return LogicalType::VARCHAR;
+	} else if (format == "tsn:") {
+		return LogicalType::TIMESTAMP;
+	} else if (format == "tdD") {
+		return LogicalType::DATE;
+	} else if (format == "ttm") {
+		return LogicalType::TIME;
+	} else {
+		throw NotImplementedException("Unsupported Arrow type %s", format);
+	}
+}
+
 static unique_ptr<FunctionData> arrow_scan_bind(ClientContext &context, vector<Value> &inputs,
                                                 unordered_map<string, Value> &named_parameters,
                                                 vector<LogicalType> &return_types, vector<string> &names) {
@@ -83,38 +151,18 @@ static unique_ptr<FunctionData> arrow_scan_bind(ClientContext &context, vector<V
 		if (!schema.release) {
 			throw InvalidInputException("arrow_scan: released schema passed");
 		}
-		if (schema.dictionary) {
-			throw NotImplementedException("arrow_scan: dictionary vectors not supported yet");
-		}
 		auto format = string(schema.format);
-		if (format == "n") {
-			return_types.push_back(LogicalType::SQLNULL);
-		} else if (format == "b") {
-			return_types.push_back(LogicalType::BOOLEAN);
-		} else if (format == "c") {
-			return_types.push_back(LogicalType::TINYINT);
-		} else if (format == "s") {
-			return_types.push_back(LogicalType::SMALLINT);
-		} else if (format == "i") {
-			return_types.push_back(LogicalType::INTEGER);
-		} else if (format == "l") {
-			return_types.push_back(LogicalType::BIGINT);
-		} else if (format == "f") {
-			return_types.push_back(LogicalType::FLOAT);
-		} else if (format == "g") {
-			return_types.push_back(LogicalType::DOUBLE);
-		} else if (format == "d:38,0") { // decimal128
-			return_types.push_back(LogicalType::HUGEINT);
-		} else if (format == "u") {
-			return_types.push_back(LogicalType::VARCHAR);
-		} else if (format == "tsn:") {
-			return_types.push_back(LogicalType::TIMESTAMP);
-		} else if (format == "tdD") {
-			return_types.push_back(LogicalType::DATE);
-		} else if (format == "ttm") {
-			return_types.push_back(LogicalType::TIME);
+		if (schema.dictionary) {
+			// dictionary-encoded column: the format of the column is the format of the indices
+			if (format != "c" && format != "C" && format != "s" && format != "S" && format != "i" && format != "I" &&
+			    format != "l" && format != "L") {
+				throw NotImplementedException("arrow_scan: unsupported dictionary index type %s", format);
+			}
+			data.index_formats.push_back(format);
+			return_types.push_back(GetArrowLogicalType(string(schema.dictionary->format)));
 		} else {
-			throw NotImplementedException("Unsupported Arrow type %s", format);
+			data.index_formats.push_back(string());
+			return_types.push_back(GetArrowLogicalType(format));
 		}
 		auto name = string(schema.name);
 		if (name.empty()) {
@@ -126,6 +174,28 @@ static unique_ptr<FunctionData> arrow_scan_bind(ClientContext &context, vector<V
 	return move(res);
 }
 
+//! Fetches the next record batch from the stream into the scan state; returns false if the stream is exhausted
+static bool arrow_scan_next_batch(const ArrowScanFunctionData &data, ArrowScanState &state) {
+	state.ReleaseArray();
+	if (!data.stream->release) {
+		// no more chunks
+		return false;
+	}
+	if (data.stream->get_next(data.stream, &state.current_chunk_root)) {
+		throw InvalidInputException("arrow_scan: get_next failed(): %s",
+		                            string(data.stream->get_last_error(data.stream)));
+	}
+	if (!state.current_chunk_root.release) {
+		// we have run out of chunks
+		data.stream->release(data.stream);
+		return false;
+	}
+	if ((idx_t)state.current_chunk_root.n_children != data.index_formats.size()) {
+		throw InvalidInputException("arrow_scan: array column count mismatch");
+	}
+	return true;
+}
+
 static unique_ptr<FunctionOperatorData> arrow_scan_init(ClientContext &context, const FunctionData *bind_data,
                                                         vector<column_t> &column_ids, TableFilterSet *table_filters) {
 	auto &data = (ArrowScanFunctionData &)*bind_data;
@@ -133,55 +203,264 @@ static unique_ptr<FunctionOperatorData> arrow_scan_init(ClientContext &context,
 		throw NotImplementedException("FIXME: Arrow streams can only be read once");
 	}
 	data.is_consumed = true;
-	return make_unique<FunctionOperatorData>();
+	return make_unique<ArrowScanState>(column_ids);
 }
 
-static void arrow_scan_function(ClientContext &context, const FunctionData *bind_data,
-                                FunctionOperatorData *operator_state, DataChunk &output) {
+static idx_t arrow_scan_max_threads(ClientContext &context, const FunctionData *bind_data) {
+	// the number of record batches is not known up front: let every thread pull batches from the stream
+	return context.db->NumberOfThreads();
+}
+
+static unique_ptr<ParallelState> arrow_scan_init_parallel_state(ClientContext &context,
+                                                                const FunctionData *bind_data) {
 	auto &data = (ArrowScanFunctionData &)*bind_data;
-	if (!data.stream->release) {
-		// no more chunks
-		return;
+	if (data.is_consumed) {
+		throw NotImplementedException("FIXME: Arrow streams can only be read once");
+	}
+	data.is_consumed = true;
+	return make_unique<ArrowScanParallelState>();
+}
+
+static bool arrow_scan_parallel_state_next(ClientContext &context, const FunctionData *bind_data,
+                                           FunctionOperatorData *operator_state, ParallelState *parallel_state_p) {
+	auto &data = (ArrowScanFunctionData &)*bind_data;
+	auto &state = (ArrowScanState &)*operator_state;
+	auto &parallel_state = (ArrowScanParallelState &)*parallel_state_p;
+
+	lock_guard<mutex> parallel_lock(parallel_state.lock);
+	if (parallel_state.finished) {
+		state.ReleaseArray();
+		return false;
 	}
+	if (!arrow_scan_next_batch(data, state)) {
+		parallel_state.finished = true;
+		return false;
+	}
+	return true;
+}
 
-	// have we run out of data on the current chunk? move to next one
-	if (data.chunk_offset >= (idx_t)data.current_chunk_root.length) {
-		data.chunk_offset = 0;
-		data.ReleaseArray();
-		if (data.stream->get_next(data.stream, &data.current_chunk_root)) {
-			throw InvalidInputException("arrow_scan: get_next failed(): %s",
-			                            string(data.stream->get_last_error(data.stream)));
+static unique_ptr<FunctionOperatorData> arrow_scan_parallel_init(ClientContext &context, const FunctionData *bind_data,
+                                                                 ParallelState *parallel_state,
+                                                                 vector<column_t> &column_ids,
+                                                                 TableFilterSet *table_filters) {
+	auto result = make_unique<ArrowScanState>(column_ids);
+	result->is_parallel = true;
+	if (!arrow_scan_parallel_state_next(context, bind_data, result.get(), parallel_state)) {
+		return nullptr;
+	}
+	return move(result);
+}
+
+static inline bool arrow_is_valid(ArrowArray &array, idx_t row_idx) {
+	if (array.null_count == 0 || !array.buffers[0]) {
+		return true;
+	}
+	auto bit_idx = array.offset + row_idx;
+	return ((const uint8_t *)array.buffers[0])[bit_idx / 8] & (1 << (bit_idx % 8));
+}
+
+//! Converts the values [offset, offset + size) of a (non-dictionary) Arrow array into the vector. Fixed-width values
+//! are referenced directly; values that require a conversion are written into target, which must hold size values.
+static void arrow_to_duckdb(ArrowArray &array, Vector &vector, idx_t offset, idx_t size, data_ptr_t target) {
+	switch (vector.type.id()) {
+	case LogicalTypeId::SQLNULL:
+		vector.Reference(Value());
+		break;
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::DATE:
+		FlatVector::SetData(vector, (data_ptr_t)array.buffers[1] +
+		                                GetTypeIdSize(vector.type.InternalType()) * (offset + array.offset));
+		break;
+
+	case LogicalTypeId::VARCHAR: {
+		auto offsets = (uint32_t *)array.buffers[1] + array.offset + offset;
+		auto cdata = (char *)array.buffers[2];
+		auto strings = (string_t *)target;
+		for (idx_t row_idx = 0; row_idx < size; row_idx++) {
+			if (!arrow_is_valid(array, offset + row_idx)) {
+				// the bytes of a NULL entry are undefined: they are neither converted nor validated
+				strings[row_idx] = string_t(nullptr, 0);
+				continue;
+			}
+			auto cptr = cdata + offsets[row_idx];
+			auto str_len = offsets[row_idx + 1] - offsets[row_idx];
+
+			auto utf_type = Utf8Proc::Analyze(cptr, str_len);
+			if (utf_type == UnicodeType::INVALID) {
+				throw std::runtime_error("Invalid UTF8 string encoding");
+			}
+			strings[row_idx] = StringVector::AddString(vector, cptr, str_len);
 		}
+		FlatVector::SetData(vector, target);
+		break;
 	}
+	case LogicalTypeId::TIME: {
+		// convert time from milliseconds to microseconds
+		auto src_ptr = (uint32_t *)array.buffers[1] + array.offset + offset;
+		auto tgt_ptr = (dtime_t *)target;
+		for (idx_t row = 0; row < size; row++) {
+			tgt_ptr[row] = dtime_t(src_ptr[row]) * 1000;
+		}
+		FlatVector::SetData(vector, target);
+		break;
+	}
+	case LogicalTypeId::TIMESTAMP: {
+		// convert timestamps from nanoseconds to microseconds
+		auto src_ptr = (uint64_t *)array.buffers[1] + array.offset + offset;
+		auto tgt_ptr = (timestamp_t *)target;
+		for (idx_t row = 0; row < size; row++) {
+			tgt_ptr[row] = Timestamp::FromEpochNanoSeconds(src_ptr[row]);
+		}
+		FlatVector::SetData(vector, target);
+		break;
+	}
+	default:
+		throw std::runtime_error("Unsupported type " + vector.type.ToString());
+	}
+}
 
-	// have we run out of chunks? we done
-	if (!data.current_chunk_root.release) {
-		data.stream->release(data.stream);
+template <class T> static void arrow_set_selection(ArrowArray &array, idx_t offset, idx_t size, SelectionVector &sel) {
+	auto indices = (const T *)array.buffers[1] + array.offset + offset;
+	auto dictionary_size = (uint64_t)array.dictionary->length;
+	for (idx_t row_idx = 0; row_idx < size; row_idx++) {
+		// NULL entries might contain any index
+		auto index = arrow_is_valid(array, offset + row_idx) ? (uint64_t)indices[row_idx] : 0;
+		if (index >= dictionary_size) {
+			throw InvalidInputException("arrow_scan: dictionary index out of range");
+		}
+		sel.set_index(row_idx, index);
+	}
+}
+
+//! Turns the vector into a dictionary vector over the (converted) dictionary of the array, without decoding the values
+static void arrow_dictionary_to_duckdb(ArrowScanState &state, idx_t col_idx, const string &index_format,
+                                       ArrowArray &array, Vector &vector, idx_t size) {
+	auto &dictionary_array = *array.dictionary;
+	auto dictionary_size = (idx_t)dictionary_array.length;
+	if (dictionary_size > (idx_t)NumericLimits<sel_t>::Maximum() + 1) {
+		throw NotImplementedException("arrow_scan: dictionaries with more than %llu entries are not supported",
+		                              (idx_t)NumericLimits<sel_t>::Maximum() + 1);
+	}
+	// convert the dictionary itself once per record batch
+	auto entry = state.dictionaries.find(col_idx);
+	if (entry == state.dictionaries.end()) {
+		auto dictionary = make_unique<ArrowScanDictionary>(vector.type);
+		dictionary->data = unique_ptr<data_t[]>(
+		    new data_t[GetTypeIdSize(vector.type.InternalType()) * MaxValue<idx_t>(dictionary_size, 1)]);
+		arrow_to_duckdb(dictionary_array, dictionary->vector, 0, dictionary_size, dictionary->data.get());
+		entry = state.dictionaries.insert(make_pair(col_idx, move(dictionary))).first;
+	}
+	auto &dictionary_vector = entry->second->vector;
+	if (dictionary_vector.vector_type == VectorType::CONSTANT_VECTOR) {
+		// dictionary of NULL values
+		vector.Reference(dictionary_vector);
 		return;
 	}
 
-	if ((idx_t)data.current_chunk_root.n_children != output.ColumnCount()) {
-		throw InvalidInputException("arrow_scan: array column count mismatch");
+	// the indices become the selection vector of the dictionary vector
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	switch (index_format[0]) {
+	case 'c':
+		arrow_set_selection<int8_t>(array, state.chunk_offset, size, sel);
+		break;
+	case 'C':
+		arrow_set_selection<uint8_t>(array, state.chunk_offset, size, sel);
+		break;
+	case 's':
+		arrow_set_selection<int16_t>(array, state.chunk_offset, size, sel);
+		break;
+	case 'S':
+		arrow_set_selection<uint16_t>(array, state.chunk_offset, size, sel);
+		break;
+	case 'i':
+		arrow_set_selection<int32_t>(array, state.chunk_offset, size, sel);
+		break;
+	case 'I':
+		arrow_set_selection<uint32_t>(array, state.chunk_offset, size, sel);
+		break;
+	case 'l':
+		arrow_set_selection<int64_t>(array, state.chunk_offset, size, sel);
+		break;
+	default:
+		D_ASSERT(index_format[0] == 'L');
+		arrow_set_selection<uint64_t>(array, state.chunk_offset, size, sel);
+		break;
+	}
+	vector.Reference(dictionary_vector);
+	vector.Slice(sel, size);
+
+	// a dictionary vector cannot have NULLs of its own: if either the index or the dictionary entry is NULL, we have to
+	// flatten the vector after all
+	bool has_nulls = false;
+	for (idx_t row_idx = 0; row_idx < size; row_idx++) {
+		if (!arrow_is_valid(array, state.chunk_offset + row_idx) ||
+		    !arrow_is_valid(dictionary_array, sel.get_index(row_idx))) {
+			has_nulls = true;
+			break;
+		}
 	}
+	if (!has_nulls) {
+		return;
+	}
+	vector.Normalify(size);
+	auto &nullmask = FlatVector::Nullmask(vector);
+	for (idx_t row_idx = 0; row_idx < size; row_idx++) {
+		if (!arrow_is_valid(array, state.chunk_offset + row_idx) ||
+		    !arrow_is_valid(dictionary_array, sel.get_index(row_idx))) {
+			nullmask[row_idx] = true;
+		}
+	}
+}
 
-	output.SetCardinality(
-	    std::min((int64_t)STANDARD_VECTOR_SIZE, (int64_t)(data.current_chunk_root.length - data.chunk_offset)));
+static void arrow_scan_function(ClientContext &context, const FunctionData *bind_data,
+                                FunctionOperatorData *operator_state, DataChunk &output) {
+	auto &data = (ArrowScanFunctionData &)*bind_data;
+	auto &state = (ArrowScanState &)*operator_state;
 
-	for (idx_t col_idx = 0; col_idx < output.ColumnCount(); col_idx++) {
-		auto &array = *data.current_chunk_root.children[col_idx];
+	// have we run out of data on the current chunk? move to next one
+	while (!state.current_chunk_root.release || state.chunk_offset >= (idx_t)state.current_chunk_root.length) {
+		if (state.is_parallel) {
+			// the next record batch is handed out by arrow_scan_parallel_state_next
+			return;
+		}
+		if (!arrow_scan_next_batch(data, state)) {
+			return;
+		}
+	}
+
+	output.SetCardinality(MinValue<idx_t>(STANDARD_VECTOR_SIZE, state.current_chunk_root.length - state.chunk_offset));
+
+	for (idx_t idx = 0; idx < output.ColumnCount(); idx++) {
+		auto col_idx = state.column_ids[idx];
+		if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
+			// Arrow record batches do not have row identifiers
+			output.data[idx].Sequence(state.chunk_offset, 1);
+			continue;
+		}
+		// only the child arrays of the projected columns are touched
+		auto &array = *state.current_chunk_root.children[col_idx];
 		if (!array.release) {
 			throw InvalidInputException("arrow_scan: released array passed");
 		}
-		if (array.length != data.current_chunk_root.length) {
+		if (array.length != state.current_chunk_root.length) {
 			throw InvalidInputException("arrow_scan: array length mismatch");
 		}
 		if (array.dictionary) {
-			throw NotImplementedException("arrow_scan: dictionary vectors not supported yet");
+			arrow_dictionary_to_duckdb(state, col_idx, data.index_formats[col_idx], array, output.data[idx],
+			                           output.size());
+			continue;
 		}
 		if (array.null_count != 0 && array.buffers[0]) {
-			auto &nullmask = FlatVector::Nullmask(output.data[col_idx]);
+			auto &nullmask = FlatVector::Nullmask(output.data[idx]);
 
-			auto bit_offset = data.chunk_offset + array.offset;
+			auto bit_offset = state.chunk_offset + array.offset;
 			auto n_bitmask_bytes = (output.size() + 8 - 1) / 8;
 
 			if (bit_offset % 8 == 0) {
@@ -197,79 +476,23 @@ static void arrow_scan_function(ClientContext &context, const FunctionData *bind
 			}
 			nullmask.flip(); // arrow uses inverse nullmask logic
 		}
-
-		switch (output.data[col_idx].type.id()) {
-		case LogicalTypeId::SQLNULL:
-			output.data[col_idx].Reference(Value());
-			break;
-		case LogicalTypeId::BOOLEAN:
-		case LogicalTypeId::TINYINT:
-		case LogicalTypeId::SMALLINT:
-		case LogicalTypeId::INTEGER:
-		case LogicalTypeId::FLOAT:
-		case LogicalTypeId::DOUBLE:
-		case LogicalTypeId::BIGINT:
-		case LogicalTypeId::HUGEINT:
-		case LogicalTypeId::DATE:
-			FlatVector::SetData(output.data[col_idx],
-			                    (data_ptr_t)array.buffers[1] + GetTypeIdSize(output.data[col_idx].type.InternalType()) *
-			                                                       (data.chunk_offset + array.offset));
-			break;
-
-		case LogicalTypeId::VARCHAR: {
-			auto offsets = (uint32_t *)array.buffers[1] + array.offset + data.chunk_offset;
-			auto cdata = (char *)array.buffers[2];
-
-			for (idx_t row_idx = 0; row_idx < output.size(); row_idx++) {
-				if (FlatVector::Nullmask(output.data[col_idx])[row_idx]) {
-					continue;
-				}
-				auto cptr = cdata + offsets[row_idx];
-				auto str_len = offsets[row_idx + 1] - offsets[row_idx];
-
-				auto utf_type = Utf8Proc::Analyze(cptr, str_len);
-				if (utf_type == UnicodeType::INVALID) {
-					throw std::runtime_error("Invalid UTF8 string encoding");
-				}
-				FlatVector::GetData<string_t>(output.data[col_idx])[row_idx] =
-				    StringVector::AddString(output.data[col_idx], cptr, str_len);
-			}
-
-			break;
-		}
-		case LogicalTypeId::TIME: {
-			// convert time from milliseconds to microseconds
-			auto src_ptr = (uint32_t *)array.buffers[1] + data.chunk_offset;
-			auto tgt_ptr = (dtime_t *)FlatVector::GetData(output.data[col_idx]);
-			for (idx_t row = 0; row < output.size(); row++) {
-				auto source_idx = data.chunk_offset + row;
-				tgt_ptr[row] = dtime_t(src_ptr[source_idx]) * 1000;
-			}
-			break;
-		}
-		case LogicalTypeId::TIMESTAMP: {
-			// convert timestamps from nanoseconds to microseconds
-			auto src_ptr = (uint64_t *)array.buffers[1] + data.chunk_offset;
-			auto tgt_ptr = (timestamp_t *)FlatVector::GetData(output.data[col_idx]);
-
-			for (idx_t row = 0; row < output.size(); row++) {
-				auto source_idx = data.chunk_offset + row;
-				tgt_ptr[row] = Timestamp::FromEpochNanoSeconds(src_ptr[source_idx]);
-			}
-			break;
-		}
-		default:
-			throw std::runtime_error("Unsupported type " + output.data[col_idx].type.ToString());
-		}
+		arrow_to_duckdb(array, output.data[idx], state.chunk_offset, output.size(),
+		                FlatVector::GetData(output.data[idx]));
 	}
 	output.Verify();
-	data.chunk_offset += output.size();
+	state.chunk_offset += output.size();
 }
 
 void ArrowTableFunction::RegisterFunction(BuiltinFunctions &set) {
 	TableFunctionSet arrow("arrow_scan");
 
-	arrow.AddFunction(TableFunction({LogicalType::POINTER}, arrow_scan_function, arrow_scan_bind, arrow_scan_init));
+	TableFunction arrow_function({LogicalType::POINTER}, arrow_scan_function, arrow_scan_bind, arrow_scan_init,
+	                             /* statistics */ nullptr, /* cleanup */ nullptr, /* dependency */ nullptr,
+	                             /* cardinality */ nullptr, /* pushdown_complex_filter */ nullptr,
+	                             /* to_string */ nullptr, arrow_scan_max_threads, arrow_scan_init_parallel_state,
+	                             arrow_scan_parallel_init, arrow_scan_parallel_state_next);
+	arrow_function.projection_pushdown = true;
+	arrow.AddFunction(arrow_function);
 	set.AddFunction(arrow);
 }
 
@@ -0,0 +1,63 @@
+#include "duckdb/function/table/sqlite_functions.hpp"
+
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+
+struct PragmaBlockCacheInfoData : public FunctionOperatorData {
+	PragmaBlockCacheInfoData() : finished(false) {
+	}
+
+	bool finished;
+};
+
+static unique_ptr<FunctionData> pragma_block_cache_info_bind(ClientContext &context, vector<Value> &inputs,
+                                                             unordered_map<string, Value> &named_parameters,
+                                                             vector<LogicalType> &return_types, vector<string> &names) {
+	names.push_back("hits");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.push_back("misses");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.push_back("memory_usage");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.push_back("memory_limit");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.push_back("spilled_blocks");
+	return_types.push_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<FunctionOperatorData> pragma_block_cache_info_init(ClientContext &context, const FunctionData *bind_data,
+                                                              vector<column_t> &column_ids,
+                                                              TableFilterSet *table_filters) {
+	return make_unique<PragmaBlockCacheInfoData>();
+}
+
+void pragma_block_cache_info(ClientContext &context, const FunctionData *bind_data,
+                             FunctionOperatorData *operator_state, DataChunk &output) {
+	auto &data = (PragmaBlockCacheInfoData &)*operator_state;
+	if (data.finished) {
+		return;
+	}
+	auto &cache = ObjectCache::GetObjectCache(context).block_cache;
+	output.SetCardinality(1);
+	output.data[0].SetValue(0, Value::BIGINT(cache.hits));
+	output.data[1].SetValue(0, Value::BIGINT(cache.misses));
+	output.data[2].SetValue(0, Value::BIGINT(cache.MemoryUsage()));
+	output.data[3].SetValue(0, Value::BIGINT(cache.MemoryLimit()));
+	output.data[4].SetValue(0, Value::BIGINT(cache.SpilledBlocks()));
+
+	data.finished = true;
+}
+
+void PragmaBlockCacheInfo::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("pragma_block_cache_info", {}, pragma_block_cache_info, pragma_block_cache_info_bind,
+	                              pragma_block_cache_info_init));
+}
+
+} // namespace duckdb
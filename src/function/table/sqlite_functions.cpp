@@ -15,6 +15,7 @@ void BuiltinFunctions::RegisterSQLiteFunctions() {
 	PragmaTableInfo::RegisterFunction(*this);
 	SQLiteMaster::RegisterFunction(*this);
 	PragmaDatabaseList::RegisterFunction(*this);
+	PragmaBlockCacheInfo::RegisterFunction(*this);
 
 	// CreateViewInfo info;
 	// info.schema = DEFAULT_SCHEMA;
@@ -83,7 +83,7 @@ idx_t table_scan_max_threads(ClientContext &context, const FunctionData *bind_da
 unique_ptr<ParallelState> table_scan_init_parallel_state(ClientContext &context, const FunctionData *bind_data_) {
 	auto &bind_data = (const TableScanBindData &)*bind_data_;
 	auto result = make_unique<ParallelTableFunctionScanState>();
-	bind_data.table->storage->InitializeParallelScan(result->state);
+	bind_data.table->storage->InitializeParallelScan(context, result->state);
 	return move(result);
 }
 
@@ -186,6 +186,8 @@ void table_scan_pushdown_complex_filter(ClientContext &context, LogicalGet &get,
 		// no indexes or no filters: skip the pushdown
 		return;
 	}
+	// the indexes are only filled once the data of the table has been read
+	storage.LoadPersistentData();
 	// check all the indexes
 	for (size_t j = 0; j < storage.info->indexes.size(); j++) {
 		auto &index = storage.info->indexes[j];
@@ -0,0 +1,34 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/arrow_wrapper.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/arrow.hpp"
+#include "duckdb/main/query_result.hpp"
+
+namespace duckdb {
+
+//! Exposes a QueryResult as an ArrowArrayStream. Every call to get_next fetches a single chunk from the result and
+//! converts it into an Arrow array, so a StreamQueryResult is consumed incrementally. The wrapper takes ownership of
+//! the result and deletes itself when the stream is released.
+class ResultArrowArrayStreamWrapper {
+public:
+	explicit ResultArrowArrayStreamWrapper(unique_ptr<QueryResult> result);
+
+	ArrowArrayStream stream;
+	unique_ptr<QueryResult> result;
+	string last_error;
+
+private:
+	static int MyStreamGetSchema(struct ArrowArrayStream *stream, struct ArrowSchema *out);
+	static int MyStreamGetNext(struct ArrowArrayStream *stream, struct ArrowArray *out);
+	static void MyStreamRelease(struct ArrowArrayStream *stream);
+	static const char *MyStreamGetLastError(struct ArrowArrayStream *stream);
+};
+
+} // namespace duckdb
@@ -0,0 +1,166 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/decompression_stream.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <istream>
+
+namespace duckdb {
+
+enum class CompressedUnitType : uint8_t {
+	//! More input has to be buffered to determine the unit
+	NEED_MORE_INPUT,
+	//! The compressed size of the unit is known, it can be decompressed in parallel with the surrounding units
+	INDEPENDENT,
+	//! The end of the unit is only known after decompressing it, it is decompressed in order
+	STREAMING,
+	//! There are no more units in the input
+	END_OF_STREAM
+};
+
+//! A unit (e.g. a gzip member or a zstd frame) at the start of the compressed input
+struct CompressedUnit {
+	CompressedUnit(CompressedUnitType type, idx_t size = 0) : type(type), size(size) {
+	}
+
+	CompressedUnitType type;
+	//! The compressed size of an INDEPENDENT unit
+	idx_t size;
+};
+
+//! A StreamDecompressor decompresses the units of a compressed file format. Every thread of the decompression pipeline
+//! uses its own StreamDecompressor.
+class StreamDecompressor {
+public:
+	virtual ~StreamDecompressor() {
+	}
+
+	//! Inspects the unit at the start of the buffered input; end_of_input is set if no more input follows
+	virtual CompressedUnit NextUnit(const_data_ptr_t input, idx_t input_size, bool end_of_input) = 0;
+	//! Returns the decompressed size of the INDEPENDENT unit of the given size at the start of the input, or 0 if it
+	//! is not known
+	virtual idx_t DecompressedSize(const_data_ptr_t input, idx_t unit_size) {
+		return 0;
+	}
+	//! Starts decompressing the unit at the start of the input, returns the amount of (header) bytes consumed
+	virtual idx_t BeginUnit(const_data_ptr_t input, idx_t input_size) = 0;
+	//! Decompresses from the input into the output and advances both, returns true once the end of the unit is reached
+	virtual bool Decompress(const_data_ptr_t &input, const_data_ptr_t input_end, data_ptr_t &output,
+	                        data_ptr_t output_end) = 0;
+};
+
+//! The DecompressionStreamBuf decompresses a file on a dedicated reader thread, which hands the decompressed output to
+//! the stream through a bounded queue of chunks. Units whose compressed size is known up front are gathered in batches
+//! and decompressed in parallel by a set of worker threads; the chunks are always handed out in the order of the file.
+class DecompressionStreamBuf : public std::streambuf {
+public:
+	//! The amount of compressed input that is read at once, and the size of a batch of independent units
+	static constexpr idx_t INPUT_BUFFER_SIZE = 1 << 20;
+	//! The size of the chunks that streaming units are decompressed into
+	static constexpr idx_t OUTPUT_CHUNK_SIZE = 1 << 20;
+	//! The largest unit that is buffered in its entirety to be decompressed in parallel
+	static constexpr idx_t MAXIMUM_UNIT_SIZE = 4 << 20;
+
+	//! Creates a stream over the given file that decompresses independent units with thread_count worker threads
+	DecompressionStreamBuf(string filename, idx_t thread_count);
+	~DecompressionStreamBuf() override;
+
+	std::streambuf::int_type underflow() override;
+
+protected:
+	virtual unique_ptr<StreamDecompressor> CreateDecompressor() = 0;
+
+private:
+	struct DecompressedChunk {
+		vector<data_t> data;
+		bool ready = false;
+		//! The error that occurred while decompressing the chunk, if any
+		string error;
+	};
+	struct DecompressionBatch {
+		shared_ptr<DecompressedChunk> chunk;
+		vector<data_t> input;
+		//! The decompressed size of the units in the batch, or 0 if it is not known
+		idx_t output_size;
+	};
+
+	void Initialize();
+	//! Decompresses the next part of the input into one or more chunks, returns false at the end of the input
+	bool ProduceChunks();
+	//! Reads more compressed input, growing the input buffer if it is full
+	void ReadInput();
+	//! Hands the gathered batch of independent units to a worker; returns false if the stream is being destroyed
+	bool FlushBatch();
+	//! Adds a chunk to the back of the queue, waiting for space if the queue is full
+	bool AddChunk(shared_ptr<DecompressedChunk> chunk);
+	//! The maximum amount of chunks in the queue, which bounds the memory used by decompressed data
+	idx_t MaximumChunks() {
+		return 2 * thread_count + 2;
+	}
+	void MarkReady(DecompressedChunk &chunk);
+	void DecompressBatch(StreamDecompressor &batch_decompressor, DecompressionBatch &batch);
+
+	void RunReader();
+	void RunWorker(StreamDecompressor *worker_decompressor);
+
+	string filename;
+	idx_t thread_count;
+	bool is_initialized = false;
+
+	FileSystem fs;
+	unique_ptr<FileHandle> handle;
+	//! The buffered compressed input, of which [input_start, input_end) is not consumed yet
+	unique_ptr<data_t[]> input;
+	idx_t input_capacity = 0;
+	idx_t input_start = 0;
+	idx_t input_end = 0;
+	bool end_of_input = false;
+	//! The decompressor of the reader thread
+	unique_ptr<StreamDecompressor> decompressor;
+	//! The streaming unit that is being decompressed, if any
+	bool in_streaming_unit = false;
+	//! The compressed independent units that are gathered into the next batch
+	vector<data_t> batch_input;
+	idx_t batch_output_size = 0;
+
+	mutex lock;
+	std::condition_variable chunk_ready;
+	std::condition_variable chunk_space;
+	std::condition_variable batch_available;
+	//! The decompressed chunks in the order of the file; the front chunk is the one that is being read
+	std::deque<shared_ptr<DecompressedChunk>> chunks;
+	std::deque<DecompressionBatch> batches;
+	//! Whether or not the chunks are produced by a reader thread
+	bool reader_thread = false;
+	//! Whether or not the front chunk is being read
+	bool reading_chunk = false;
+	bool finished = false;
+	bool cancelled = false;
+	vector<unique_ptr<thread>> threads;
+	vector<unique_ptr<StreamDecompressor>> worker_decompressors;
+};
+
+//! An input stream over a compressed file that is decompressed by a DecompressionStreamBuf
+class DecompressionStream : public std::istream {
+public:
+	explicit DecompressionStream(unique_ptr<DecompressionStreamBuf> buffer) : std::istream(buffer.release()) {
+		exceptions(std::ios_base::badbit);
+	}
+	~DecompressionStream() override {
+		delete rdbuf();
+	}
+};
+
+} // namespace duckdb
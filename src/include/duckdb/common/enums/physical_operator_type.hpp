@@ -44,6 +44,7 @@ enum class PhysicalOperatorType : uint8_t {
 	EXTERNAL_FILE_SCAN,
 	QUERY_DERIVED_SCAN,
 	EXPRESSION_SCAN,
+	TABLE_FETCH,
 	// -----------------------------
 	// Joins
 	// -----------------------------
@@ -52,6 +53,8 @@ enum class PhysicalOperatorType : uint8_t {
 	HASH_JOIN,
 	CROSS_PRODUCT,
 	PIECEWISE_MERGE_JOIN,
+	IE_JOIN,
+	ASOF_JOIN,
 	DELIM_JOIN,
 	INDEX_JOIN,
 	// -----------------------------
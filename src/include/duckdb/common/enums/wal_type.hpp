@@ -42,6 +42,10 @@ enum class WALType : uint8_t {
 	DELETE_TUPLE = 27,
 	UPDATE_TUPLE = 28,
 	// -----------------------------
+	// Checkpoint
+	// -----------------------------
+	CHECKPOINT_REQUEST = 99,
+	// -----------------------------
 	// Flush
 	// -----------------------------
 	WAL_FLUSH = 100
@@ -23,6 +23,9 @@ public:
 	//! been opened with DIRECT_IO on all operating systems, however, the entire buffer must be written to the file.
 	//! Note that the returned size is 8 bytes less than the allocation size to account for the checksum.
 	FileBuffer(FileBufferType type, uint64_t bufsiz);
+	//! Wraps a buffer of the specified size that is owned elsewhere, e.g. a block in a memory mapped file. The buffer
+	//! starts with the checksum and is not freed when the FileBuffer is destroyed.
+	FileBuffer(FileBufferType type, data_ptr_t internal_buffer, uint64_t bufsiz);
 	virtual ~FileBuffer();
 
 	//! The type of the buffer
@@ -39,6 +42,8 @@ public:
 	//! Write the contents of the FileBuffer to the specified location. Automatically adds a checksum of the contents of
 	//! the filebuffer in front of the written data.
 	void Write(FileHandle &handle, uint64_t location);
+	//! Verify the checksum in front of the contents of the FileBuffer, throws an exception if it does not match
+	void VerifyChecksum();
 
 	void Clear();
 
@@ -52,7 +57,8 @@ private:
 	//! The aligned size as passed to the constructor. This is the size that is read or written to disk.
 	uint64_t internal_size;
 
-	//! The buffer that was actually malloc'd, i.e. the pointer that must be freed when the FileBuffer is destroyed
+	//! The buffer that was actually malloc'd, i.e. the pointer that must be freed when the FileBuffer is destroyed. This
+	//! is nullptr if the buffer is owned elsewhere.
 	data_ptr_t malloced_buffer;
 };
 
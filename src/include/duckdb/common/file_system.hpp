@@ -10,6 +10,7 @@
 
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/file_buffer.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/vector.hpp"
 
 #include <functional>
@@ -41,6 +42,8 @@ protected:
 public:
 	FileSystem &file_system;
 	string path;
+	//! Lock held while the file pointer is moved for a read or write at a location
+	mutex file_pointer_lock;
 };
 
 enum class FileLockType : uint8_t { NO_LOCK = 0, READ_LOCK = 1, WRITE_LOCK = 2 };
@@ -74,11 +77,14 @@ public:
 		return OpenFile(path.c_str(), flags, lock);
 	}
 	//! Read exactly nr_bytes from the specified location in the file. Fails if nr_bytes could not be read. This is
-	//! equivalent to calling SetFilePointer(location) followed by calling Read().
+	//! equivalent to calling SetFilePointer(location) followed by calling Read(), while holding the lock of the handle.
 	virtual void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be read. This is
-	//! equivalent to calling SetFilePointer(location) followed by calling Write().
+	//! equivalent to calling SetFilePointer(location) followed by calling Write(), while holding the lock of the handle.
 	virtual void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
+	//! Hint that nr_bytes at the specified location in the file will be read soon, so that the file system can start
+	//! reading them in the background. This is only a hint: it does not fail and might do nothing at all.
+	virtual void Prefetch(FileHandle &handle, int64_t nr_bytes, idx_t location);
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
 	virtual int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes);
@@ -92,6 +98,12 @@ public:
 	//! Truncate a file to a maximum size of new_size, new_size should be smaller than or equal to the current size of
 	//! the file
 	virtual void Truncate(FileHandle &handle, int64_t new_size);
+	//! Map the first nr_bytes of the file into memory for reading. Returns nullptr if the file cannot be memory mapped
+	//! (the default), in which case it has to be read instead. The mapping must not be written to, and has to be
+	//! released with UnmapFile.
+	virtual data_ptr_t MapFile(FileHandle &handle, idx_t nr_bytes);
+	//! Release a mapping that was created by MapFile
+	virtual void UnmapFile(data_ptr_t mapping, idx_t nr_bytes);
 
 	//! Check if a directory exists
 	virtual bool DirectoryExists(const string &directory);
@@ -133,4 +145,18 @@ private:
 	void SetFilePointer(FileHandle &handle, idx_t location);
 };
 
+//! The LocalFileSystem is the file system used by a database unless another one is configured. Its reads and writes
+//! at a location are positional (pread/pwrite): they do not use or move the file pointer, and can be issued
+//! concurrently on the same handle. Prefetch asks the operating system to read the range ahead.
+class LocalFileSystem : public FileSystem {
+public:
+	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
+	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
+	void Prefetch(FileHandle &handle, int64_t nr_bytes, idx_t location) override;
+	data_ptr_t MapFile(FileHandle &handle, idx_t nr_bytes) override;
+	void UnmapFile(data_ptr_t mapping, idx_t nr_bytes) override;
+	using FileSystem::Read;
+	using FileSystem::Write;
+};
+
 } // namespace duckdb
@@ -8,47 +8,26 @@
 
 #pragma once
 
-#include "duckdb/common/constants.hpp"
-
-#include <fstream>
-#include <sstream>
+#include "duckdb/common/decompression_stream.hpp"
 
 namespace duckdb {
 
-class GzipStreamBuf : public std::streambuf {
+//! Decompresses the members of a (multi-member) GZIP file. Members that record their compressed size in the header
+//! (BGZF, as written by bgzip) are decompressed in parallel, other members are decompressed in order.
+class GzipStreamBuf : public DecompressionStreamBuf {
 public:
-	GzipStreamBuf(std::string filename) : filename(filename) {
+	GzipStreamBuf(string filename, idx_t thread_count) : DecompressionStreamBuf(move(filename), thread_count) {
 	}
 
-	GzipStreamBuf(const GzipStreamBuf &) = delete;
-	GzipStreamBuf(GzipStreamBuf &&) = default;
-	GzipStreamBuf &operator=(const GzipStreamBuf &) = delete;
-	GzipStreamBuf &operator=(GzipStreamBuf &&) = default;
-
-	~GzipStreamBuf();
-
-	std::streambuf::int_type underflow() override;
-
-private:
-	void initialize();
-	std::fstream input;
-	idx_t data_start = 0;
-	void *mz_stream_ptr = nullptr; // void* so we don't have to include the header
-	data_ptr_t in_buff = nullptr, in_buff_start, in_buff_end, out_buff = nullptr; // various buffers & pointers
-	bool is_initialized = false;
-	std::string filename;
-	idx_t BUFFER_SIZE = 1024;
+protected:
+	unique_ptr<StreamDecompressor> CreateDecompressor() override;
 };
 
-class GzipStream : public std::istream {
+class GzipStream : public DecompressionStream {
 public:
-	GzipStream(std::string filename) : std::istream(new GzipStreamBuf(filename)) {
-		exceptions(std::ios_base::badbit);
-	}
-	~GzipStream() {
-		if (rdbuf())
-			delete rdbuf();
+	explicit GzipStream(string filename, idx_t thread_count = 1)
+	    : DecompressionStream(make_unique<GzipStreamBuf>(filename, thread_count)) {
 	}
-}; // class istream
+};
 
 } // namespace duckdb
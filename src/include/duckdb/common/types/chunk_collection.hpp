@@ -101,10 +101,16 @@ public:
 	}
 
 	void Sort(vector<OrderType> &desc, vector<OrderByNullType> &null_order, idx_t result[]);
+	//! Compares a row of the left collection with a row of the right collection on the first desc.size() columns, in
+	//! the order used by Sort. Returns a negative value, zero or a positive value (like a C comparator).
+	static int CompareRows(ChunkCollection &left_collection, idx_t left, ChunkCollection &right_collection, idx_t right,
+	                       vector<OrderType> &desc, vector<OrderByNullType> &null_order);
 	//! Reorders the rows in the collection according to the given indices. NB: order is changed!
 	void Reorder(idx_t order[]);
 
 	void MaterializeSortedChunk(DataChunk &target, idx_t order[], idx_t start_offset);
+	//! Materializes the rows order[start_offset, start_offset + count) of the collection into the target chunk
+	void MaterializeSortedChunk(DataChunk &target, idx_t order[], idx_t start_offset, idx_t count);
 
 	//! Returns true if the ChunkCollections are equivalent
 	bool Equals(ChunkCollection &other);
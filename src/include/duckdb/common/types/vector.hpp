@@ -150,6 +150,8 @@ public:
 
 public:
 	Vector data;
+	//! The amount of entries in the child vector when it is used as a dictionary, or 0 if this is unknown
+	idx_t dictionary_size = 0;
 };
 
 struct ConstantVector {
@@ -186,6 +188,23 @@ struct DictionaryVector {
 		D_ASSERT(vector.vector_type == VectorType::DICTIONARY_VECTOR);
 		return ((VectorChildBuffer &)*vector.auxiliary).data;
 	}
+	//! Returns the amount of entries in the dictionary, or 0 if the dictionary size is unknown
+	static inline idx_t DictionarySize(const Vector &vector) {
+		D_ASSERT(vector.vector_type == VectorType::DICTIONARY_VECTOR);
+		return ((VectorChildBuffer &)*vector.auxiliary).dictionary_size;
+	}
+	static inline void SetDictionarySize(Vector &vector, idx_t dictionary_size) {
+		D_ASSERT(vector.vector_type == VectorType::DICTIONARY_VECTOR);
+		((VectorChildBuffer &)*vector.auxiliary).dictionary_size = dictionary_size;
+	}
+	//! Whether or not operations on this vector can be executed once per dictionary entry instead of once per row
+	static inline bool CanExecuteOnDictionary(const Vector &vector, idx_t count) {
+		if (vector.vector_type != VectorType::DICTIONARY_VECTOR) {
+			return false;
+		}
+		auto dictionary_size = DictionarySize(vector);
+		return dictionary_size > 0 && dictionary_size < count;
+	}
 };
 
 struct FlatVector {
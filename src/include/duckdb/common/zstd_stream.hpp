@@ -0,0 +1,33 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/zstd_stream.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/decompression_stream.hpp"
+
+namespace duckdb {
+
+//! Decompresses the frames of a ZSTD file. Frames are decompressed in parallel, except for frames that are too large
+//! to be buffered in their entirety, which are decompressed in order.
+class ZstdStreamBuf : public DecompressionStreamBuf {
+public:
+	ZstdStreamBuf(string filename, idx_t thread_count) : DecompressionStreamBuf(move(filename), thread_count) {
+	}
+
+protected:
+	unique_ptr<StreamDecompressor> CreateDecompressor() override;
+};
+
+class ZstdStream : public DecompressionStream {
+public:
+	explicit ZstdStream(string filename, idx_t thread_count = 1)
+	    : DecompressionStream(make_unique<ZstdStreamBuf>(filename, thread_count)) {
+	}
+};
+
+} // namespace duckdb
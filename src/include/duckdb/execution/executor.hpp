@@ -25,6 +25,19 @@ class Task;
 
 struct ProducerToken;
 
+enum class PendingExecutionResult : uint8_t { RESULT_READY, RESULT_NOT_READY, EXECUTION_ERROR };
+
+//! The progress of a single pipeline of a query
+struct PipelineProgress {
+	//! A description of the pipeline (e.g. "TABLE_SCAN -> HASH_GROUP_BY")
+	string pipeline;
+	//! The amount of finished and scheduled tasks of the pipeline
+	idx_t finished_tasks;
+	idx_t total_tasks;
+	//! Whether or not the pipeline has finished executing
+	bool finished;
+};
+
 class Executor {
 	friend class Pipeline;
 	friend class PipelineTask;
@@ -36,10 +49,28 @@ public:
 	ClientContext &context;
 
 public:
+	//! Builds the pipelines of the plan and schedules the pipelines that can start executing. The pipelines are
+	//! executed by the worker threads and by calls to ExecuteTask().
 	void Initialize(PhysicalOperator *physical_plan);
 	void BuildPipelines(PhysicalOperator *op, Pipeline *parent);
 
+	//! Executes at most one pending task of the current query on the calling thread. Returns RESULT_READY once all
+	//! pipelines have finished, and EXECUTION_ERROR once all pipelines have finished but one of them failed.
+	PendingExecutionResult ExecuteTask();
+	//! Executes tasks until all pipelines have finished, throwing an exception if any of them failed
+	void WorkOnTasks();
+	//! Interrupts the current query and waits until all of its tasks have stopped
+	void CancelTasks();
+	//! Returns the percentage (0-100) of the finished tasks of the query
+	double GetProgress();
+	//! Returns the progress of every pipeline of the query
+	vector<PipelineProgress> GetPipelineProgress();
+	bool HasError();
+	string GetError();
+
 	void Reset();
+	//! Releases the operator states of the current query. Must be called while the plan of the query is still alive.
+	void ReleaseStates();
 
 	vector<LogicalType> GetTypes();
 
@@ -58,6 +89,9 @@ private:
 	mutex executor_lock;
 	//! The pipelines of the current query
 	vector<unique_ptr<Pipeline>> pipelines;
+	//! The sinks of the current query. Their global states are released as soon as the query has finished, as the
+	//! plan can outlive the query (e.g. in a prepared statement or in the plan cache)
+	vector<PhysicalSink *> sinks;
 	//! The producer of this query
 	unique_ptr<ProducerToken> producer;
 	//! Exceptions that occurred during the execution of the current query
@@ -22,6 +22,9 @@ public:
 
 	unique_ptr<VacuumInfo> info;
 
+	//! The minimum fraction of deleted rows of a table for which a VACUUM without a table requests a checkpoint
+	static constexpr double MIN_DELETED_FRACTION = 0.1;
+
 public:
 	void GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state) override;
 };
@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_asof_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/order_type.hpp"
+#include "duckdb/execution/operator/join/physical_comparison_join.hpp"
+
+namespace duckdb {
+
+//! PhysicalAsOfJoin joins every LHS row with the closest RHS row that has the same values for the equality conditions
+//! and satisfies the (single) inequality condition, e.g. the latest quote at or before the time of a trade. Both sides
+//! are sorted on the equality keys followed by the inequality key, after which they are merged in a single pass.
+class PhysicalAsOfJoin : public PhysicalComparisonJoin {
+public:
+	PhysicalAsOfJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
+	                 vector<JoinCondition> cond, JoinType join_type);
+
+	//! The sort order of the join keys: the equality keys are sorted ascending, and the inequality key is sorted such
+	//! that the RHS rows that satisfy the inequality for a LHS row precede it (with the closest match last)
+	vector<OrderType> key_orders;
+	vector<OrderByNullType> null_orders;
+	//! The sort order of only the equality keys
+	vector<OrderType> equality_orders;
+	//! Whether or not RHS rows with a key equal to the LHS key match (i.e. the inequality is not strict)
+	bool match_equal_keys;
+
+public:
+	unique_ptr<GlobalOperatorState> GetGlobalState(ClientContext &context) override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) override;
+	void Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate, DataChunk &input) override;
+	void Combine(ExecutionContext &context, GlobalOperatorState &gstate, LocalSinkState &lstate) override;
+	void Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> state) override;
+
+	void GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state) override;
+	unique_ptr<PhysicalOperatorState> GetOperatorState() override;
+
+private:
+	//! Materializes and sorts the LHS
+	void InitializeJoin(ExecutionContext &context, PhysicalOperatorState *state);
+	//! Finds the closest RHS match of a LHS row, returns INVALID_INDEX if there is none
+	idx_t FindMatch(PhysicalOperatorState *state, idx_t left_row);
+};
+
+} // namespace duckdb
@@ -0,0 +1,48 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_iejoin.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/physical_comparison_join.hpp"
+
+namespace duckdb {
+
+//! PhysicalIEJoin represents an inequality join on two range conditions (e.g. an interval join such as
+//! "a.start <= b.ts AND b.ts < a.end"). Both inputs are sorted on the first join key and split into blocks that are
+//! sorted on the second join key. Every probing thread joins its blocks of the LHS with all blocks of the RHS whose
+//! key ranges can match, enumerating the matches of a pair of blocks with a permutation array and a bit array.
+class PhysicalIEJoin : public PhysicalComparisonJoin {
+public:
+	PhysicalIEJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
+	               vector<JoinCondition> cond, JoinType join_type);
+
+	vector<LogicalType> join_key_types;
+
+public:
+	//! Whether or not a join with the given conditions and type can be executed with an IEJoin
+	static bool CanUseIEJoin(const vector<JoinCondition> &conditions, JoinType join_type);
+
+	unique_ptr<GlobalOperatorState> GetGlobalState(ClientContext &context) override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) override;
+	void Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate, DataChunk &input) override;
+	void Combine(ExecutionContext &context, GlobalOperatorState &gstate, LocalSinkState &lstate) override;
+	void Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> state) override;
+
+	void GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state) override;
+	unique_ptr<PhysicalOperatorState> GetOperatorState() override;
+
+private:
+	//! Materializes the LHS, and sorts and splits it into blocks
+	void InitializeJoin(ExecutionContext &context, PhysicalOperatorState *state);
+	//! Moves to the next pair of LHS and RHS blocks that can have matches and merges their orders, returns false if
+	//! all pairs have been joined
+	bool NextBlockPair(PhysicalOperatorState *state);
+};
+
+} // namespace duckdb
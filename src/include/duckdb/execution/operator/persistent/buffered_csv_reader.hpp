@@ -135,6 +135,8 @@ public:
 	unique_ptr<std::istream> source;
 	bool plain_file_source = false;
 	idx_t file_size = 0;
+	//! The amount of threads used to decompress a compressed (.gz or .zst) file
+	idx_t decompression_threads = 1;
 
 	unique_ptr<char[]> buffer;
 	idx_t buffer_size;
@@ -210,6 +212,8 @@ private:
 	bool ReadBuffer(idx_t &start);
 
 	unique_ptr<std::istream> OpenCSV(ClientContext &context, BufferedCSVReaderOptions options);
+	//! Opens a decompressing stream over the file if it is compressed (based on the extension), or returns nullptr
+	unique_ptr<std::istream> OpenCompressedCSV();
 };
 
 } // namespace duckdb
@@ -0,0 +1,40 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/scan/physical_table_fetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+class DataTable;
+
+//! PhysicalTableFetch fetches the columns of a base table that were left out of an earlier scan, using the row
+//! identifiers that the scan emitted
+class PhysicalTableFetch : public PhysicalOperator {
+public:
+	PhysicalTableFetch(vector<LogicalType> types, DataTable &table, idx_t row_id_index, vector<column_t> fetch_ids,
+	                   vector<LogicalType> fetch_types, vector<idx_t> projection_map);
+
+	//! The table to fetch from
+	DataTable &table;
+	//! The index of the row identifier column in the input
+	idx_t row_id_index;
+	//! The columns of the table to fetch
+	vector<column_t> fetch_ids;
+	//! The types of the fetched columns
+	vector<LogicalType> fetch_types;
+	//! For every result column, the index of the column it references: input columns come first, followed by the
+	//! fetched columns
+	vector<idx_t> projection_map;
+
+public:
+	void GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state) override;
+	unique_ptr<PhysicalOperatorState> GetOperatorState() override;
+};
+
+} // namespace duckdb
@@ -9,8 +9,19 @@
 #pragma once
 
 #include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/parallel/parallel_state.hpp"
 
 namespace duckdb {
+
+//! Restricts the tasks of a pipeline to a single branch of a union, so that the branches can be executed in parallel
+struct UnionBranchState : public ParallelState {
+	explicit UnionBranchState(idx_t branch) : branch(branch) {
+	}
+
+	//! The child of the union that is executed (0 = top, 1 = bottom)
+	idx_t branch;
+};
+
 class PhysicalUnion : public PhysicalOperator {
 public:
 	PhysicalUnion(vector<LogicalType> types, unique_ptr<PhysicalOperator> top, unique_ptr<PhysicalOperator> bottom);
@@ -10,6 +10,7 @@
 
 #include "duckdb/function/function_set.hpp"
 #include "re2/re2.h"
+#include "re2/set.h"
 
 namespace duckdb {
 
@@ -22,6 +23,26 @@ struct RegexpMatchesBindData : public FunctionData {
 	std::unique_ptr<duckdb_re2::RE2> constant_pattern;
 	string range_min, range_max;
 	bool range_success;
+	//! A literal that every string matched by the constant pattern contains (empty if there is none)
+	string required_literal;
+
+	unique_ptr<FunctionData> Copy() override;
+};
+
+//! Bind data of the fused disjunction of several constant regular expressions over the same input
+struct RegexpMatchesSetBindData : public FunctionData {
+	RegexpMatchesSetBindData(duckdb_re2::RE2::Options options, vector<string> patterns, bool full_match);
+	~RegexpMatchesSetBindData();
+
+	duckdb_re2::RE2::Options options;
+	vector<string> patterns;
+	bool full_match;
+	//! The set of all patterns, matched in a single pass over the input
+	std::unique_ptr<duckdb_re2::RE2::Set> set;
+	//! The individual patterns, used if the DFA of the set runs out of memory
+	vector<std::unique_ptr<duckdb_re2::RE2>> regexes;
+	//! The required literals of the patterns, only used if every pattern has one
+	vector<string> required_literals;
 
 	unique_ptr<FunctionData> Copy() override;
 };
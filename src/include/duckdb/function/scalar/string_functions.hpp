@@ -105,6 +105,8 @@ struct RightFun {
 
 struct RegexpFun {
 	static void RegisterFunction(BuiltinFunctions &set);
+	//! Returns the function that matches its input against the set of patterns in its RegexpMatchesSetBindData
+	static ScalarFunction GetSetFunction();
 };
 
 struct SubstringFun {
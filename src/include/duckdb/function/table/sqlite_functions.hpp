@@ -36,4 +36,8 @@ struct PragmaDatabaseList {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct PragmaBlockCacheInfo {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 } // namespace duckdb
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/types/chunk_collection.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/winapi.hpp"
 #include "duckdb/main/table_description.hpp"
@@ -19,7 +20,17 @@ class DuckDB;
 class TableCatalogEntry;
 class Connection;
 
-//! The Appender class can be used to append elements to a table.
+//! The Appender class can be used to append elements to a table. Appended rows are buffered in the appender and
+//! only written to the table when the appender is flushed (by Flush(), Close(), the destructor, or automatically once
+//! the flush count is reached, see SetFlushCount()). This has a number of consequences:
+//! * Buffered rows are not visible to any query, including queries on the connection of the appender.
+//! * Constraints (NOT NULL, CHECK, PRIMARY KEY/UNIQUE) are only verified when the rows are written, so a violation is
+//!   reported by the Flush() or Close() call (or by the append that triggered an automatic flush), possibly long after
+//!   the offending row was appended. The rows stay buffered after a failed flush.
+//! * The rows are written in the transaction that is active on the connection at the time of the flush, not at the
+//!   time they are appended: rows that are still buffered when an explicit transaction commits are not part of it.
+//! Multiple appenders can fill their buffers concurrently from different threads (each with its own connection);
+//! only the flushes themselves are serialized on the append lock of the table.
 class Appender {
 	//! A reference to a database connection that created this appender
 	shared_ptr<ClientContext> context;
@@ -27,8 +38,12 @@ class Appender {
 	unique_ptr<TableDescription> description;
 	//! Internal chunk used for appends
 	DataChunk chunk;
+	//! The rows that have been appended but not yet flushed to the table
+	ChunkCollection collection;
 	//! The current column to append to
 	idx_t column = 0;
+	//! The number of buffered rows after which the appender is flushed automatically
+	idx_t flush_count = STANDARD_VECTOR_SIZE;
 
 public:
 	DUCKDB_API Appender(Connection &con, string schema_name, string table_name);
@@ -49,16 +64,28 @@ public:
 
 	DUCKDB_API void Append(const char *value, uint32_t length);
 
+	//! Appends all rows of a DataChunk at once. The types of the chunk have to match the types of the table.
+	DUCKDB_API void AppendDataChunk(DataChunk &value);
+	//! Appends count rows from raw column arrays. columns[i] points to count values of the physical type of the i-th
+	//! column (string_t for VARCHAR columns), validity[i] is either nullptr (no NULL values) or a bitmask in which bit
+	//! j is set if row j of the column is valid.
+	DUCKDB_API void AppendColumns(idx_t count, const vector<const_data_ptr_t> &columns,
+	                              const vector<const uint8_t *> &validity);
+
 	// prepared statements
 	template <typename... Args> void AppendRow(Args... args) {
 		BeginRow();
 		AppendRowRecursive(args...);
 	}
 
-	//! Commit the changes made by the appender.
+	//! Write the buffered rows to the table. Throws if the rows violate a constraint of the table.
 	DUCKDB_API void Flush();
 	//! Flush the changes made by the appender and close it. The appender cannot be used after this point
 	DUCKDB_API void Close();
+	//! Sets the number of buffered rows after which the appender is flushed automatically (default:
+	//! STANDARD_VECTOR_SIZE). A larger flush count amortizes the cost of a flush over more rows, at the price of more
+	//! memory and a longer delay before the rows become visible and constraint violations are reported.
+	DUCKDB_API void SetFlushCount(idx_t count);
 
 	//! Obtain a reference to the internal vector that is used to append to the table
 	DUCKDB_API DataChunk &GetAppendChunk() {
@@ -83,6 +110,8 @@ private:
 	}
 
 	void AppendValue(Value value);
+	//! Moves the rows of the internal chunk into the collection of buffered rows
+	void FlushChunk();
 };
 
 template <> void DUCKDB_API Appender::Append(bool value);
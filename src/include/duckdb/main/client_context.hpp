@@ -25,7 +25,9 @@
 namespace duckdb {
 class Appender;
 class Catalog;
+class ChunkCollection;
 class DatabaseInstance;
+class PendingQueryResult;
 class PreparedStatementData;
 class Relation;
 class BufferedFileWriter;
@@ -35,6 +37,8 @@ class ClientContextLock;
 //! The ClientContext holds information relevant to the current client session
 //! during execution
 class ClientContext : public std::enable_shared_from_this<ClientContext> {
+	friend class PendingQueryResult;
+
 public:
 	DUCKDB_API ClientContext(shared_ptr<DatabaseInstance> db);
 	DUCKDB_API ~ClientContext();
@@ -65,6 +69,8 @@ public:
 	bool force_parallelism = false;
 	//! Force index join independent of table cardinality, used for testing
 	bool force_index_join = false;
+	//! Scan only the columns needed for ORDER BY ... LIMIT and fetch the remaining columns of the surviving rows
+	bool enable_late_materialization = false;
 	//! Maximum bits allowed for using a perfect hash table (i.e. the perfect HT can hold up to 2^perfect_ht_threshold
 	//! elements)
 	idx_t perfect_ht_threshold = 12;
@@ -92,6 +98,10 @@ public:
 	//! statement.
 	DUCKDB_API unique_ptr<QueryResult> Query(const string &query, bool allow_stream_result);
 	DUCKDB_API unique_ptr<QueryResult> Query(unique_ptr<SQLStatement> statement, bool allow_stream_result);
+	//! Plans and schedules a single statement without waiting for it to finish executing. The query runs in the
+	//! background (and on the threads that call PendingQueryResult::ExecuteTask()) until its result is requested with
+	//! PendingQueryResult::Execute().
+	DUCKDB_API unique_ptr<PendingQueryResult> PendingQuery(const string &query, bool allow_stream_result);
 	//! Fetch a query from the current result set (if any)
 	DUCKDB_API unique_ptr<DataChunk> Fetch();
 	//! Cleanup the result set (if any).
@@ -103,6 +113,9 @@ public:
 	DUCKDB_API unique_ptr<TableDescription> TableInfo(const string &schema_name, const string &table_name);
 	//! Appends a DataChunk to the specified table. Returns whether or not the append was successful.
 	DUCKDB_API void Append(TableDescription &description, DataChunk &chunk);
+	//! Appends all chunks of a ChunkCollection to the specified table in a single transaction. The chunks are moved
+	//! out of the collection.
+	DUCKDB_API void Append(TableDescription &description, ChunkCollection &collection);
 	//! Try to bind a relation in the current client context; either throws an exception or fills the result_columns
 	//! list with the set of returned columns
 	DUCKDB_API void TryBindRelation(Relation &relation, vector<ColumnDefinition> &result_columns);
@@ -161,7 +174,14 @@ private:
 
 	//! Internally prepare a SQL statement. Caller must hold the context_lock.
 	shared_ptr<PreparedStatementData> CreatePreparedStatement(ClientContextLock &lock, const string &query,
-	                                                          unique_ptr<SQLStatement> statement);
+	                                                          unique_ptr<SQLStatement> statement,
+	                                                          bool propagate_statistics = true);
+	//! Binds the values of a prepared statement and schedules its execution. Caller must hold the context_lock.
+	void InitializePreparedStatement(ClientContextLock &lock, PreparedStatementData &statement,
+	                                 vector<Value> bound_values);
+	//! Creates the result of an executed prepared statement. Caller must hold the context_lock.
+	unique_ptr<QueryResult> FetchResultInternal(ClientContextLock &lock, shared_ptr<PreparedStatementData> statement,
+	                                            bool allow_stream_result);
 	//! Internally execute a prepared SQL statement. Caller must hold the context_lock.
 	unique_ptr<QueryResult> ExecutePreparedStatement(ClientContextLock &lock, const string &query,
 	                                                 shared_ptr<PreparedStatementData> statement,
@@ -169,7 +189,20 @@ private:
 	//! Call CreatePreparedStatement() and ExecutePreparedStatement() without any bound values
 	unique_ptr<QueryResult> RunStatementInternal(ClientContextLock &lock, const string &query,
 	                                             unique_ptr<SQLStatement> statement, bool allow_stream_result);
+	//! Execute a SELECT statement using (and populating) the plan cache. Caller must hold the context_lock.
+	unique_ptr<QueryResult> RunCachedStatement(ClientContextLock &lock, const string &query,
+	                                           unique_ptr<SQLStatement> statement, bool allow_stream_result);
 	unique_ptr<PreparedStatement> PrepareInternal(ClientContextLock &lock, unique_ptr<SQLStatement> statement);
+
+	//! Methods used by the PendingQueryResult; these obtain the context_lock
+	PendingExecutionResult ExecuteTaskInternal(PendingQueryResult &pending);
+	unique_ptr<QueryResult> ExecutePendingQuery(PendingQueryResult &pending);
+	double GetQueryProgress(PendingQueryResult &pending);
+	vector<PipelineProgress> GetPipelineProgress(PendingQueryResult &pending);
+	//! Returns whether or not the pending query is the query that is currently being executed
+	bool IsActivePendingQuery(ClientContextLock &lock, PendingQueryResult &pending);
+	//! Finalizes the pending query after it failed, storing the error in the pending query result
+	void FailPendingQuery(ClientContextLock &lock, const string &error);
 	void LogQueryInternal(ClientContextLock &lock, string query);
 
 	unique_ptr<ClientContextLock> LockContext();
@@ -177,6 +210,8 @@ private:
 private:
 	//! The currently opened StreamQueryResult (if any)
 	StreamQueryResult *open_result = nullptr;
+	//! The currently executing PendingQueryResult (if any)
+	PendingQueryResult *open_pending_query = nullptr;
 	//! Lock on using the ClientContext in parallel
 	std::mutex context_lock;
 };
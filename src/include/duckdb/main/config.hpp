@@ -32,6 +32,9 @@ public:
 	idx_t checkpoint_wal_size = 1 << 20;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
+	//! Whether or not to memory map the database file when it is opened in read-only mode, instead of reading its
+	//! blocks into buffers
+	bool use_mmap = true;
 	//! The FileSystem to use, can be overwritten to allow for injecting custom file systems for testing purposes (e.g.
 	//! RamFS or something similar)
 	unique_ptr<FileSystem> file_system;
@@ -51,6 +54,12 @@ public:
 	bool enable_copy = true;
 	//! Wether or not object cache is used
 	bool object_cache_enable = false;
+	//! The maximum amount of plans kept in the plan cache (0 disables the plan cache)
+	idx_t plan_cache_size = 0;
+	//! The maximum memory used by the block cache for file reads (in bytes, 0 disables the block cache)
+	idx_t block_cache_size = 0;
+	//! Directory that blocks evicted from the block cache are written to (empty: evicted blocks are dropped)
+	string block_cache_directory;
 
 public:
 	DUCKDB_API static DBConfig &GetConfig(ClientContext &context);
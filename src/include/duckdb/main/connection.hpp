@@ -13,6 +13,7 @@
 #include "duckdb/common/winapi.hpp"
 #include "duckdb/function/udf_function.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/pending_query_result.hpp"
 #include "duckdb/main/prepared_statement.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
@@ -69,6 +70,10 @@ public:
 	//! Issues a query to the database and materializes the result (if necessary). Always returns a
 	//! MaterializedQueryResult.
 	DUCKDB_API unique_ptr<MaterializedQueryResult> Query(unique_ptr<SQLStatement> statement);
+	//! Issues a single query to the database without waiting for it to finish. The returned PendingQueryResult can be
+	//! used to drive the execution of the query, to monitor its progress or to cancel it. Like a StreamQueryResult, the
+	//! PendingQueryResult is invalidated by any subsequent query on the Connection.
+	DUCKDB_API unique_ptr<PendingQueryResult> PendingQuery(string query);
 	// prepared statements
 	template <typename... Args> unique_ptr<QueryResult> Query(string query, Args... args) {
 		vector<Value> values;
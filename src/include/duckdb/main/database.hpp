@@ -21,11 +21,13 @@ class ConnectionManager;
 class FileSystem;
 class TaskScheduler;
 class ObjectCache;
+class PlanCache;
 
 class DatabaseInstance : public std::enable_shared_from_this<DatabaseInstance> {
 	friend class BufferManager;
 	friend class ClientContext;
 	friend class ObjectCache;
+	friend class PlanCache;
 	friend class StorageManager;
 	friend class DuckDB;
 	friend class TaskScheduler;
@@ -51,6 +53,7 @@ private:
 	unique_ptr<TransactionManager> transaction_manager;
 	unique_ptr<TaskScheduler> scheduler;
 	unique_ptr<ObjectCache> object_cache;
+	unique_ptr<PlanCache> plan_cache;
 };
 
 //! The database object. This object holds the catalog and all the
@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/pending_query_result.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/winapi.hpp"
+#include "duckdb/execution/executor.hpp"
+#include "duckdb/main/query_result.hpp"
+
+namespace duckdb {
+class ClientContext;
+class PreparedStatementData;
+
+//! A PendingQueryResult is a query that has been planned and scheduled, but whose result has not been computed yet.
+//! The query is executed by the worker threads of the database, and by the thread that calls ExecuteTask(), which
+//! allows the caller to interleave execution with other work (e.g. reporting progress) or to cancel the query.
+class PendingQueryResult {
+	friend class ClientContext;
+
+public:
+	//! Create a successfully scheduled pending query result
+	DUCKDB_API PendingQueryResult(shared_ptr<ClientContext> context, shared_ptr<PreparedStatementData> prepared,
+	                              bool allow_stream_result);
+	//! Create a pending query result of a query that could not be scheduled
+	DUCKDB_API explicit PendingQueryResult(string error);
+	DUCKDB_API ~PendingQueryResult();
+
+	//! Whether or not the query was successful so far
+	bool success;
+	//! The error message (if success = false)
+	string error;
+
+public:
+	//! Executes a single task of the query on the calling thread. Returns RESULT_READY once the result can be fetched
+	//! with Execute(), or EXECUTION_ERROR if the query failed.
+	DUCKDB_API PendingExecutionResult ExecuteTask();
+	//! Executes the remaining tasks of the query and returns its result
+	DUCKDB_API unique_ptr<QueryResult> Execute();
+	//! Interrupts the query: the running tasks stop at the next chunk boundary. May be called from any thread.
+	DUCKDB_API void Cancel();
+
+	//! Returns the percentage (0-100) of the work of the query that has been completed
+	DUCKDB_API double GetProgress();
+	//! Returns the progress of the individual pipelines of the query
+	DUCKDB_API vector<PipelineProgress> GetPipelineProgress();
+
+	//! Returns the result SQL types and names of the query
+	DUCKDB_API const vector<LogicalType> &GetTypes();
+	DUCKDB_API const vector<string> &GetNames();
+	DUCKDB_API StatementType GetStatementType();
+
+	//! Closes the pending query, cancelling it if it has not finished executing yet
+	DUCKDB_API void Close();
+
+private:
+	//! The client context this query is executed in
+	shared_ptr<ClientContext> context;
+	//! The prepared statement data of the query
+	shared_ptr<PreparedStatementData> prepared;
+	//! Whether or not the result may be returned as a StreamQueryResult
+	bool allow_stream_result;
+	//! Whether or not the query is still pending in the client context
+	bool is_open;
+
+private:
+	void CheckExecutable();
+};
+
+} // namespace duckdb
@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/plan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+#include <atomic>
+#include <list>
+
+namespace duckdb {
+class ClientContext;
+class PreparedStatementData;
+class SelectStatement;
+
+//! The PlanCache holds the prepared plans of SELECT statements issued through ClientContext::Query. Statements are
+//! keyed on their serialized form after the literals in their filters have been replaced by parameters, so that
+//! queries that only differ in those literals share a single plan. Literals that are compared directly against a
+//! column are kept, so that filter pushdown and index scans still apply to the cached plans. Entries are evicted in LRU order, and are only
+//! used by transactions that see the same catalog version the plan was bound against.
+class PlanCache {
+public:
+	explicit PlanCache(idx_t capacity);
+
+	//! Replaces the literals compared against in the WHERE clauses of the statement by (typed) parameters, unless
+	//! they are compared against a column, and moves their values into "values". Returns the cache key of the normalized statement, or an empty string if the
+	//! statement cannot be cached.
+	static string NormalizeStatement(ClientContext &context, SelectStatement &statement, vector<Value> &values);
+
+	//! Returns the cached plan for the given key, or nullptr if there is no (usable) entry. Plans that are still in use
+	//! by another query are not returned, because binding new values would modify them.
+	shared_ptr<PreparedStatementData> Get(const string &key, idx_t catalog_version);
+	//! Adds a plan to the cache, evicting the least recently used plan if the cache is full
+	void Put(const string &key, shared_ptr<PreparedStatementData> plan);
+	//! Removes all plans from the cache
+	void Clear();
+
+	//! Sets the maximum amount of plans in the cache; a capacity of 0 disables the cache
+	void SetCapacity(idx_t capacity);
+	bool IsEnabled() {
+		return capacity > 0;
+	}
+	idx_t Count();
+
+	static PlanCache &GetPlanCache(ClientContext &context);
+
+	//! The amount of lookups that were answered from (hits) or missed (misses) the cache
+	std::atomic<idx_t> hits;
+	std::atomic<idx_t> misses;
+
+private:
+	typedef std::list<std::pair<string, shared_ptr<PreparedStatementData>>> entry_list_t;
+
+	void EvictEntries();
+
+	mutex lock;
+	std::atomic<idx_t> capacity;
+	//! The cached plans, ordered from most to least recently used
+	entry_list_t entries;
+	unordered_map<string, entry_list_t::iterator> entry_map;
+};
+
+} // namespace duckdb
@@ -62,6 +62,9 @@ private:
 	// Pushdown a mark join
 	unique_ptr<LogicalOperator> PushdownMarkJoin(unique_ptr<LogicalOperator> op, unordered_set<idx_t> &left_bindings,
 	                                             unordered_set<idx_t> &right_bindings);
+	// Pushdown an ASOF join
+	unique_ptr<LogicalOperator> PushdownAsOfJoin(unique_ptr<LogicalOperator> op, unordered_set<idx_t> &left_bindings,
+	                                             unordered_set<idx_t> &right_bindings);
 	// Pushdown a single join
 	unique_ptr<LogicalOperator> PushdownSingleJoin(unique_ptr<LogicalOperator> op, unordered_set<idx_t> &left_bindings,
 	                                               unordered_set<idx_t> &right_bindings);
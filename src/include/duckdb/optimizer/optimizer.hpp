@@ -24,6 +24,9 @@ public:
 	ClientContext &context;
 	Binder &binder;
 	ExpressionRewriter rewriter;
+	//! Whether or not the plan can be specialized using the statistics of the data. Disabled for plans that are kept
+	//! in the plan cache, because those are reused after the data has changed.
+	bool propagate_statistics = true;
 };
 
 } // namespace duckdb
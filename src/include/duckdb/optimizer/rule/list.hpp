@@ -8,3 +8,4 @@
 #include "duckdb/optimizer/rule/empty_needle_removal.hpp"
 #include "duckdb/optimizer/rule/like_optimizations.hpp"
 #include "duckdb/optimizer/rule/move_constants.hpp"
+#include "duckdb/optimizer/rule/regex_optimizations.hpp"
@@ -0,0 +1,24 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/rule/regex_optimizations.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/rule.hpp"
+
+namespace duckdb {
+
+// The Regex Optimization rule fuses a disjunction of regular expressions with constant patterns on the same input into
+// a single function that matches all of the patterns at once using an RE2::Set
+class RegexOptimizationRule : public Rule {
+public:
+	RegexOptimizationRule(ExpressionRewriter &rewriter);
+
+	unique_ptr<Expression> Apply(LogicalOperator &op, vector<Expression *> &bindings, bool &changes_made) override;
+};
+
+} // namespace duckdb
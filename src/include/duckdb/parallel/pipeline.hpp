@@ -12,12 +12,12 @@
 #include "duckdb/parallel/parallel_state.hpp"
 #include "duckdb/common/unordered_set.hpp"
 #include "duckdb/function/table_function.hpp"
+#include "duckdb/parallel/task_context.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include <atomic>
 
 namespace duckdb {
 class Executor;
-class TaskContext;
 
 //! The Pipeline class represents an execution pipeline
 class Pipeline {
@@ -73,7 +73,7 @@ public:
 	//! The current threads working on the pipeline
 	std::atomic<idx_t> finished_tasks;
 	//! The maximum amount of threads that can work on the pipeline
-	idx_t total_tasks;
+	std::atomic<idx_t> total_tasks;
 
 private:
 	//! The child from which to pull chunks
@@ -90,10 +90,8 @@ private:
 	//! executing)
 	std::atomic<idx_t> finished_dependencies;
 
-	//! The parallel operator (if any)
-	PhysicalOperator *parallel_node;
-	//! The parallel state (if any)
-	unique_ptr<ParallelState> parallel_state;
+	//! The parallel states referenced by the task info of the scheduled tasks (if any)
+	vector<unique_ptr<ParallelState>> parallel_states;
 
 	//! Whether or not the pipeline is finished executing
 	bool finished;
@@ -103,6 +101,9 @@ private:
 private:
 	void ScheduleSequentialTask();
 	bool ScheduleOperator(PhysicalOperator *op);
+	//! Creates the tasks that execute the source "op" of the pipeline in parallel, starting from the task info of
+	//! "task". Returns false if the source cannot be executed in parallel.
+	bool CreateParallelTasks(PhysicalOperator *op, const TaskContext &task, vector<unique_ptr<Task>> &tasks);
 };
 
 } // namespace duckdb
@@ -18,6 +18,7 @@ namespace duckdb {
 struct ConcurrentQueue;
 struct QueueProducerToken;
 class ClientContext;
+class DatabaseInstance;
 class TaskScheduler;
 
 struct SchedulerThread;
@@ -41,6 +42,7 @@ public:
 	~TaskScheduler();
 
 	static TaskScheduler &GetScheduler(ClientContext &context);
+	static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
 	unique_ptr<ProducerToken> CreateProducer();
 	//! Schedule a task to be executed by the task scheduler
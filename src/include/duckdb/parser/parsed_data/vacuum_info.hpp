@@ -13,7 +13,21 @@
 namespace duckdb {
 
 struct VacuumInfo : public ParseInfo {
-	// nothing for now
+	//! Whether or not the deleted rows of the tables are removed. If false (ANALYZE), the statement is ignored.
+	bool vacuum = false;
+	//! The schema of the table to vacuum
+	string schema;
+	//! The table to vacuum. If empty, all tables with a large fraction of deleted rows are vacuumed.
+	string table;
+
+public:
+	unique_ptr<VacuumInfo> Copy() const {
+		auto result = make_unique<VacuumInfo>();
+		result->vacuum = vacuum;
+		result->schema = schema;
+		result->table = table;
+		return result;
+	}
 };
 
 } // namespace duckdb
@@ -18,7 +18,7 @@ namespace duckdb {
 //! Represents a JOIN between two expressions
 class JoinRef : public TableRef {
 public:
-	JoinRef() : TableRef(TableReferenceType::JOIN), is_natural(false) {
+	JoinRef() : TableRef(TableReferenceType::JOIN), is_natural(false), is_asof(false) {
 	}
 
 	//! The left hand side of the join
@@ -31,6 +31,8 @@ public:
 	JoinType type;
 	//! Natural join
 	bool is_natural;
+	//! ASOF join: every LHS row is joined with (at most) the closest RHS row that satisfies the inequality condition
+	bool is_asof;
 	//! The set of USING columns (if any)
 	vector<string> using_columns;
 
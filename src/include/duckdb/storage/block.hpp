@@ -17,6 +17,8 @@ namespace duckdb {
 class Block : public FileBuffer {
 public:
 	Block(block_id_t id);
+	//! Constructs a block that points to its contents in a memory mapped file, instead of holding a copy of them
+	Block(block_id_t id, data_ptr_t mapped_buffer);
 
 	block_id_t id;
 };
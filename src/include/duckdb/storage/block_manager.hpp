@@ -28,6 +28,11 @@ public:
 	virtual block_id_t GetMetaBlock() = 0;
 	//! Read the content of the block from disk
 	virtual void Read(Block &block) = 0;
+	//! Returns a pointer to the block in a read-only memory mapping of the database file, or nullptr if the block is not
+	//! memory mapped and has to be read instead. The pointer refers to the checksum in front of the block contents.
+	virtual data_ptr_t GetMappedBlock(block_id_t block_id) {
+		return nullptr;
+	}
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
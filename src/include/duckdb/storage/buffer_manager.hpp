@@ -21,6 +21,7 @@
 
 namespace duckdb {
 struct EvictionQueue;
+struct ReadAheadQueue;
 
 //! The buffer manager is in charge of handling memory management for the database. It hands out memory buffers that can
 //! be used by the database internally.
@@ -48,6 +49,14 @@ public:
 	unique_ptr<BufferHandle> Pin(shared_ptr<BlockHandle> &handle);
 	void Unpin(shared_ptr<BlockHandle> &handle);
 
+	//! Start loading the given on-disk blocks into memory in the background, so that a subsequent Pin does not have to
+	//! wait for the disk. Blocks that are already loaded are skipped, and nothing is read ahead if the buffer pool is
+	//! full.
+	void Prefetch(vector<shared_ptr<BlockHandle>> &handles);
+	//! Sizes the pool of background threads that load the blocks passed to Prefetch for the given amount of database
+	//! threads: the pool has one thread fewer, so read-ahead is disabled in a single-threaded database
+	void SetReadAheadThreads(idx_t database_threads);
+
 	void UnregisterBlock(block_id_t block_id, bool can_destroy);
 
 	//! Set a new memory limit to the buffer manager, throws an exception if the new limit is too low and not enough
@@ -88,5 +97,7 @@ private:
 	unique_ptr<EvictionQueue> queue;
 	//! The temporary id used for managed buffers
 	block_id_t temporary_id;
+	//! The background threads that load the blocks passed to Prefetch
+	unique_ptr<ReadAheadQueue> read_ahead;
 };
 } // namespace duckdb
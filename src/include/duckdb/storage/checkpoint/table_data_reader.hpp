@@ -8,22 +8,26 @@
 
 #pragma once
 
-#include "duckdb/storage/checkpoint_manager.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/storage/table/persistent_table_data.hpp"
 
 namespace duckdb {
-struct BoundCreateTableInfo;
+class BufferManager;
+class MetaBlockReader;
 
 //! The table data reader is responsible for reading the data of a table from the block manager
 class TableDataReader {
 public:
-	TableDataReader(CheckpointManager &manager, MetaBlockReader &reader, BoundCreateTableInfo &info);
+	TableDataReader(BufferManager &buffer_manager, MetaBlockReader &reader, const vector<LogicalType> &types,
+	                PersistentTableData &data);
 
 	void ReadTableData();
 
 private:
-	CheckpointManager &manager;
+	BufferManager &buffer_manager;
 	MetaBlockReader &reader;
-	BoundCreateTableInfo &info;
+	const vector<LogicalType> &types;
+	PersistentTableData &data;
 };
 
 } // namespace duckdb
@@ -21,6 +21,10 @@ class Transaction;
 struct DataTableInfo;
 
 class ColumnData {
+public:
+	//! The amount of segments following the current one that a scan loads in the background
+	static constexpr idx_t READ_AHEAD_SEGMENTS = 2;
+
 public:
 	ColumnData(BufferManager &manager, DataTableInfo &table_info, LogicalType type, idx_t column_idx);
 
@@ -73,6 +77,8 @@ public:
 private:
 	//! Append a transient segment
 	void AppendTransientSegment(idx_t start_row);
+	//! Initialize the scan of the current segment, and start loading the segments that follow it
+	void InitializeSegmentScan(ColumnScanState &state);
 };
 
 } // namespace duckdb
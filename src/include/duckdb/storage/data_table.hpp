@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/enums/index_type.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/storage/index.hpp"
 #include "duckdb/storage/table_statistics.hpp"
@@ -32,12 +33,15 @@ class Transaction;
 class WriteAheadLog;
 
 struct DataTableInfo {
-	DataTableInfo(string schema, string table) : cardinality(0), schema(move(schema)), table(move(table)) {
+	DataTableInfo(string schema, string table)
+	    : cardinality(0), last_commit_id(0), schema(move(schema)), table(move(table)) {
 	}
 
 	//! The amount of elements in the table. Note that this number signifies the amount of COMMITTED entries in the
 	//! table. It can be inaccurate inside of transactions. More work is needed to properly support that.
 	std::atomic<idx_t> cardinality;
+	//! The commit id of the last transaction that appended, deleted or updated rows of the table
+	std::atomic<transaction_t> last_commit_id;
 	// schema of the table
 	string schema;
 	// name of the table
@@ -52,13 +56,20 @@ struct DataTableInfo {
 
 struct ParallelTableScanState {
 	idx_t current_row;
-	bool transaction_local_data;
+	//! The amount of base table rows to scan, fixed when the scan is initialized
+	idx_t max_row;
+	//! The next chunk of the transaction-local storage to scan
+	idx_t local_chunk_index;
+	//! The transaction-local chunks to scan, fixed when the scan is initialized. This keeps the local storage from
+	//! being flushed or merged into while the parallel scan is active.
+	LocalScanState local_state;
 };
 
 //! DataTable represents a physical table on disk
 class DataTable {
 public:
-	//! Constructs a new data table from an (optional) set of persistent segments
+	//! Constructs a new data table from an (optional) set of persistent segments. If the persistent data has not been
+	//! read from the metadata yet, it is only read when the table is first accessed.
 	DataTable(StorageManager &storage, string schema, string table, vector<LogicalType> types,
 	          unique_ptr<PersistentTableData> data = nullptr);
 	//! Constructs a DataTable as a delta on an existing data table with a newly added column
@@ -83,7 +94,7 @@ public:
 
 	//! Returns the maximum amount of threads that should be assigned to scan this data table
 	idx_t MaxThreads(ClientContext &context);
-	void InitializeParallelScan(ParallelTableScanState &state);
+	void InitializeParallelScan(ClientContext &context, ParallelTableScanState &state);
 	bool NextParallelScan(ClientContext &context, ParallelTableScanState &state, TableScanState &scan_state,
 	                      const vector<column_t> &column_ids);
 
@@ -99,6 +110,12 @@ public:
 
 	//! Append a DataChunk to the table. Throws an exception if the columns don't match the tables' columns.
 	void Append(TableCatalogEntry &table, ClientContext &context, DataChunk &chunk);
+	//! Append a collection of chunks that have already passed VerifyAppendConstraints to the transaction-local
+	//! storage. The chunks are moved out of the collection.
+	void LocalAppend(ClientContext &context, ChunkCollection &collection);
+	//! Verify constraints with a chunk from the Append containing all columns of the table. This can be called in
+	//! parallel as long as the table has no indexes.
+	void VerifyAppendConstraints(TableCatalogEntry &table, DataChunk &chunk);
 	//! Delete the entries with the specified row identifier from the table
 	void Delete(TableCatalogEntry &table, ClientContext &context, Vector &row_ids, idx_t count);
 	//! Update the entries with the specified row identifier from the table
@@ -112,6 +129,13 @@ public:
 	void InitializeAppend(Transaction &transaction, TableAppendState &state, idx_t append_count);
 	//! Append a chunk to the table using the AppendState obtained from BeginAppend
 	void Append(Transaction &transaction, DataChunk &chunk, TableAppendState &state);
+	//! Initialize the append to a single column of the table in the calling thread, after the thread that called
+	//! InitializeAppend released the lock of the column append state. This allows different threads to append to
+	//! different columns of the table in parallel.
+	void InitializeColumnAppend(TableAppendState &state, idx_t column_idx);
+	//! Append a vector to a single column of the table, the caller advances the current_row of the AppendState once
+	//! all columns have been appended to
+	void AppendColumn(TableAppendState &state, idx_t column_idx, Vector &vector, idx_t count);
 	//! Commit the append
 	void CommitAppend(transaction_t commit_id, idx_t row_start, idx_t count);
 	//! Write a segment of the table to the WAL
@@ -133,6 +157,19 @@ public:
 	//! Remove the row identifiers from all the indexes of the table
 	void RemoveFromIndexes(Vector &row_identifiers, idx_t count);
 
+	//! Reads the persistent data of the table from the metadata and fills the indexes with it, if this has not
+	//! happened yet. This is done implicitly by all methods that access the data or the indexes of the table.
+	void LoadPersistentData();
+
+	//! Returns the amount of rows in the table, including the rows that are deleted
+	idx_t GetTotalRows() {
+		LoadPersistentData();
+		return total_rows;
+	}
+	//! Returns the amount of rows of the table that are not visible to the transaction, i.e. rows that were deleted or
+	//! whose insertion was rolled back
+	idx_t CountDeletedRows(Transaction &transaction);
+
 	void SetAsRoot() {
 		this->is_root = true;
 	}
@@ -140,14 +177,20 @@ public:
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id);
 
 private:
-	//! Verify constraints with a chunk from the Append containing all columns of the table
-	void VerifyAppendConstraints(TableCatalogEntry &table, DataChunk &chunk);
+	//! Initializes the columns and version information of the table from the persistent segments
+	void InitializePersistentData(PersistentTableData *data);
+
 	//! Verify constraints with a chunk from the Update containing only the specified column_ids
 	void VerifyUpdateConstraints(TableCatalogEntry &table, DataChunk &chunk, vector<column_t> &column_ids);
 
 	void InitializeScanWithOffset(TableScanState &state, const vector<column_t> &column_ids,
 	                              TableFilterSet *table_filters, idx_t start_row, idx_t end_row);
 	bool CheckZonemap(TableScanState &state, TableFilterSet *table_filters, idx_t &current_row);
+	//! Checks the zonemaps of the segments of all filtered columns that contain the given row. Returns false if any
+	//! of them excludes its segment. segment_end is set to the end of that segment, or to the first segment boundary
+	//! after the row in any of the filtered columns if all segments pass.
+	bool CheckSegmentZonemaps(TableFilterSet &table_filters, const vector<column_t> &column_ids, idx_t row,
+	                          idx_t &segment_end);
 	bool ScanBaseTable(Transaction &transaction, DataChunk &result, TableScanState &state,
 	                   const vector<column_t> &column_ids, idx_t &current_row, idx_t max_row);
 	bool ScanCreateIndex(CreateIndexScanState &state, const vector<column_t> &column_ids, DataChunk &result,
@@ -170,6 +213,12 @@ private:
 	idx_t total_rows;
 	//! The physical columns of the table
 	vector<shared_ptr<ColumnData>> columns;
+	//! Lock for reading the persistent data of the table
+	mutex load_lock;
+	//! The location of the persistent data of the table, if it has not been read yet
+	unique_ptr<PersistentTableData> persistent_data;
+	//! Whether or not the persistent data of the table has been read
+	std::atomic<bool> persistent_data_loaded;
 	//! Whether or not the data table is the root DataTable for this table; the root DataTable is the newest version
 	//! that can be appended to
 	bool is_root;
@@ -0,0 +1,120 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/file_block_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+#include <atomic>
+#include <list>
+
+namespace duckdb {
+
+//! The FileBlockCache caches the contents of (slow or remote) files in blocks of CACHE_BLOCK_SIZE bytes, so that
+//! repeatedly reading the same byte ranges (e.g. the column chunks of a Parquet file) is served from memory. Blocks are
+//! keyed on the path, the generation and the offset of the block. The generation of a file is bumped when it is
+//! invalidated explicitly (e.g. because it is overwritten) or when its size or last modified time changes, after
+//! which the blocks of older generations are no longer used. The blocks kept in memory are bounded by a memory limit
+//! and evicted in LRU order; if a spill directory is set, evicted blocks are written there and read back from disk
+//! (after verifying their checksum) on the next hit.
+class FileBlockCache {
+public:
+	//! The size of the byte ranges that are cached
+	static constexpr idx_t CACHE_BLOCK_SIZE = 256 * 1024;
+
+	FileBlockCache();
+	~FileBlockCache();
+
+	//! Read exactly nr_bytes from the specified location in the file through the cache. If the cache is disabled this
+	//! is a plain read from the file system.
+	void Read(FileSystem &fs, FileHandle &handle, void *buffer, idx_t nr_bytes, idx_t location);
+
+	//! Sets the maximum amount of memory used by the cached blocks; a limit of 0 disables the cache
+	void SetLimit(idx_t limit);
+	//! Sets the directory that evicted blocks are written to; an empty directory disables spilling
+	void SetSpillDirectory(const string &directory);
+	//! Removes all blocks from the cache, including the spilled ones
+	void Clear();
+	//! Removes the blocks of the file at the given path from the cache, e.g. because the file is being written to
+	void Invalidate(const string &path);
+
+	bool IsEnabled() {
+		return memory_limit > 0;
+	}
+	idx_t MemoryLimit() {
+		return memory_limit;
+	}
+	//! The amount of memory used by the blocks that are cached in memory
+	idx_t MemoryUsage();
+	//! The amount of blocks that are spilled to disk
+	idx_t SpilledBlocks();
+
+	//! The amount of block reads that were answered from (hits) or missed (misses) the cache
+	std::atomic<idx_t> hits;
+	std::atomic<idx_t> misses;
+
+private:
+	struct CacheBlock {
+		string key;
+		idx_t size;
+		unique_ptr<data_t[]> data;
+	};
+	struct SpilledBlock {
+		string path;
+		idx_t size;
+		uint64_t checksum;
+	};
+	struct CachedFile {
+		idx_t generation;
+		time_t last_modified;
+		int64_t file_size;
+	};
+	typedef std::list<CacheBlock> block_list_t;
+
+	//! Returns the generation of the file, starting a new generation if the file has changed. Must be called with the
+	//! lock held.
+	idx_t GetGeneration(const string &path, time_t last_modified, int64_t file_size);
+	//! Copies count bytes starting at block_offset of the block with the given key into the target, returns false if
+	//! the block is not cached in memory. Must be called with the lock held.
+	bool ReadCachedBlock(const string &key, idx_t block_offset, data_ptr_t target, idx_t count);
+	//! Adds a block to the front of the LRU list and evicts blocks until the memory limit is respected. Evicted blocks
+	//! that have to be spilled are moved into the evicted list. Must be called with the lock held.
+	void AddBlock(string key, unique_ptr<data_t[]> data, idx_t size, vector<CacheBlock> &evicted);
+	void EvictBlocks(vector<CacheBlock> &evicted);
+	//! Writes evicted blocks to the spill directory. Must be called WITHOUT the lock held.
+	void SpillBlocks(const string &directory, vector<CacheBlock> &evicted);
+	//! Reads a block back from the spill directory, returns nullptr if the spill file is missing or was modified. Must
+	//! be called WITHOUT the lock held.
+	unique_ptr<data_t[]> ReadSpilledBlock(const SpilledBlock &spilled);
+	void RemoveSpilledBlocks();
+	void ClearInternal();
+
+	mutex lock;
+	std::atomic<idx_t> memory_limit;
+	idx_t memory_usage;
+	//! The blocks held in memory, ordered from most to least recently used
+	block_list_t blocks;
+	unordered_map<string, block_list_t::iterator> block_map;
+	//! The blocks that were evicted to the spill directory
+	unordered_map<string, SpilledBlock> spilled_blocks;
+	//! The generation of the files whose blocks are cached
+	unordered_map<string, CachedFile> files;
+	idx_t next_generation;
+	string spill_directory;
+	//! The prefix of the spill files, which is unique to this cache (i.e. includes the process id and a random token),
+	//! so that multiple processes can share a spill directory
+	string spill_prefix;
+	std::atomic<idx_t> spill_id;
+	//! The (local) file system used to spill blocks
+	FileSystem spill_fs;
+};
+
+} // namespace duckdb
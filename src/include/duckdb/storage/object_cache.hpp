@@ -14,6 +14,7 @@
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/storage/file_block_cache.hpp"
 
 namespace duckdb {
 class ClientContext;
@@ -41,10 +42,18 @@ public:
 		cache[key] = move(value);
 	}
 
+	void Delete(const std::string &key) {
+		lock_guard<mutex> glock(lock);
+		cache.erase(key);
+	}
+
 	static ObjectCache &GetObjectCache(duckdb::ClientContext &context) {
 		return *context.db->object_cache;
 	}
 
+	//! The cache for byte ranges of files
+	FileBlockCache block_cache;
+
 private:
 	//! Object Cache
 	std::unordered_map<std::string, shared_ptr<ObjectCacheEntry>> cache;
@@ -25,7 +25,9 @@ class SingleFileBlockManager : public BlockManager {
 	static constexpr uint64_t BLOCK_START = Storage::FILE_HEADER_SIZE * 3;
 
 public:
-	SingleFileBlockManager(FileSystem &fs, string path, bool read_only, bool create_new, bool use_direct_io);
+	SingleFileBlockManager(FileSystem &fs, string path, bool read_only, bool create_new, bool use_direct_io,
+	                       bool use_mmap = false);
+	~SingleFileBlockManager() override;
 
 	void StartCheckpoint() override;
 	//! Creates a new Block and returns a pointer
@@ -36,6 +38,8 @@ public:
 	block_id_t GetMetaBlock() override;
 	//! Read the content of the block from disk
 	void Read(Block &block) override;
+	//! Returns a pointer to the block in the memory mapping of the file, if the file is memory mapped
+	data_ptr_t GetMappedBlock(block_id_t block_id) override;
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
@@ -72,5 +76,9 @@ private:
 	bool read_only;
 	//! Whether or not to use Direct IO to read the blocks
 	bool use_direct_io;
+	//! The read-only memory mapping of the file, or nullptr if the blocks are read from the file
+	data_ptr_t mapping;
+	//! The size of the memory mapping
+	idx_t mapping_size;
 };
 } // namespace duckdb
@@ -62,6 +62,13 @@ public:
 	unique_ptr<OverflowStringWriter> overflow_writer;
 	//! Map of block id to string block
 	unordered_map<block_id_t, StringBlock *> overflow_blocks;
+	//! Map of the hashes of the strings stored in the dictionary to their dictionary offset, used to deduplicate
+	//! appended strings. The strings themselves are compared against the dictionary, so no copy of them is kept.
+	unordered_map<hash_t, int32_t> dictionary_entries;
+	//! Whether or not appended strings are still deduplicated against the dictionary
+	bool deduplicate_strings = true;
+	//! The amount of appended strings that were looked up in the dictionary entries
+	idx_t dictionary_lookups = 0;
 
 public:
 	void InitializeScan(ColumnScanState &state) override;
@@ -88,6 +95,7 @@ protected:
 	            vector<TableFilter> &tableFilter) override;
 
 	void FetchBaseData(ColumnScanState &state, idx_t vector_index, Vector &result) override;
+	void ScanBaseData(ColumnScanState &state, idx_t vector_index, Vector &result) override;
 	void FetchUpdateData(ColumnScanState &state, Transaction &transaction, UpdateInfo *versions,
 	                     Vector &result) override;
 
@@ -211,6 +219,10 @@ private:
 	static constexpr idx_t BIG_STRING_MARKER_BASE_SIZE = sizeof(block_id_t) + sizeof(int32_t);
 	//! The marker size of the big string
 	static constexpr idx_t BIG_STRING_MARKER_SIZE = BIG_STRING_MARKER_BASE_SIZE + sizeof(uint16_t);
+	//! Deduplication is disabled if more than 1/DEDUPLICATION_RATIO of the appended strings are distinct
+	static constexpr idx_t DEDUPLICATION_RATIO = 2;
+	//! A vector is only scanned as a dictionary vector if at most 1/DICTIONARY_SCAN_RATIO of its strings are distinct
+	static constexpr idx_t DICTIONARY_SCAN_RATIO = 2;
 };
 
 } // namespace duckdb
@@ -39,6 +39,8 @@ public:
 	//! Returns whether or not a single row in the ChunkInfo should be used or not for the given transaction
 	virtual bool Fetch(Transaction &transaction, row_t row) = 0;
 	virtual void CommitAppend(transaction_t commit_id, idx_t start, idx_t end) = 0;
+	//! Sets the delete id of the given rows, used to commit, revert or roll back a delete
+	virtual void CommitDelete(transaction_t commit_id, row_t rows[], idx_t count) = 0;
 };
 
 class ChunkConstantInfo : public ChunkInfo {
@@ -52,6 +54,9 @@ public:
 	idx_t GetSelVector(Transaction &transaction, SelectionVector &sel_vector, idx_t max_count) override;
 	bool Fetch(Transaction &transaction, row_t row) override;
 	void CommitAppend(transaction_t commit_id, idx_t start, idx_t end) override;
+	//! Marks all the rows of the chunk as deleted. Only used when a delete covers the entire chunk.
+	void Delete(Transaction &transaction);
+	void CommitDelete(transaction_t commit_id, row_t rows[], idx_t count) override;
 };
 
 class ChunkVectorInfo : public ChunkInfo {
@@ -74,7 +79,7 @@ public:
 
 	void Append(idx_t start, idx_t end, transaction_t commit_id);
 	void Delete(Transaction &transaction, row_t rows[], idx_t count);
-	void CommitDelete(transaction_t commit_id, row_t rows[], idx_t count);
+	void CommitDelete(transaction_t commit_id, row_t rows[], idx_t count) override;
 };
 
 } // namespace duckdb
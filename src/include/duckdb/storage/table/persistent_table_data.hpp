@@ -10,6 +10,7 @@
 
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/vector.hpp"
+#include "duckdb/storage/storage_info.hpp"
 
 namespace duckdb {
 class BaseStatistics;
@@ -22,6 +23,15 @@ public:
 
 	vector<unique_ptr<BaseStatistics>> column_stats;
 	vector<vector<unique_ptr<PersistentSegment>>> table_data;
+	//! The location of the table data in the metadata, if the statistics and segments have not been read yet
+	block_id_t block_id;
+	idx_t offset;
+
+public:
+	//! Whether or not the statistics and segments have been read from the metadata
+	bool IsLoaded() {
+		return block_id == INVALID_BLOCK;
+	}
 };
 
 } // namespace duckdb
@@ -43,6 +43,11 @@ struct ColumnScanState {
 	bool initialized = false;
 	//! If this segment has already been checked for skipping puorposes
 	bool segment_checked = false;
+	//! Whether or not the scan of the current segment should try to emit dictionary vectors
+	bool scan_dictionary = true;
+	//! The segments following the current one that start before this row are read ahead when the scan initializes a
+	//! segment (0 disables read-ahead)
+	idx_t read_ahead_row = 0;
 
 public:
 	//! Move on to the next vector in the scan
@@ -89,6 +89,10 @@ public:
 	//! temporary in-memory one
 	virtual void ToTemporary();
 
+	//! Returns true if the vector has updates that are not visible to the transaction, i.e. if the vector cannot be
+	//! read from the base data alone. The caller must hold a lock on the segment.
+	bool HasUpdatesForTransaction(Transaction &transaction, idx_t vector_index);
+
 	//! Get the amount of tuples in a vector
 	idx_t GetVectorCount(idx_t vector_index) {
 		D_ASSERT(vector_index < max_vector_count);
@@ -109,6 +113,11 @@ protected:
 	                                 idx_t &approved_tuple_count) = 0;
 	//! Fetch base table data
 	virtual void FetchBaseData(ColumnScanState &state, idx_t vector_index, Vector &result) = 0;
+	//! Scan base table data of a vector without any updates. Unlike FetchBaseData, the result is not required to be a
+	//! flat vector (e.g. segments can emit dictionary vectors here)
+	virtual void ScanBaseData(ColumnScanState &state, idx_t vector_index, Vector &result) {
+		FetchBaseData(state, vector_index, result);
+	}
 	//! Fetch update data from an UpdateInfo version
 	virtual void FetchUpdateData(ColumnScanState &state, Transaction &transaction, UpdateInfo *version,
 	                             Vector &result) = 0;
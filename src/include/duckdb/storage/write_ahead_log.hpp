@@ -43,6 +43,9 @@ public:
 public:
 	//! Replay the WAL
 	static void Replay(DatabaseInstance &database, string &path);
+	//! Returns whether or not a committed transaction in the WAL requested the database to be checkpointed, regardless
+	//! of the size of the WAL
+	static bool CheckpointRequested(DatabaseInstance &database, string &path);
 
 	//! Initialize the WAL in the specified directory
 	void Initialize(string &path);
@@ -73,6 +76,8 @@ public:
 	void WriteInsert(DataChunk &chunk);
 	void WriteDelete(DataChunk &chunk);
 	void WriteUpdate(DataChunk &chunk, column_t col_idx);
+	//! Requests the database to be checkpointed on the next startup
+	void WriteCheckpointRequest();
 
 	//! Truncate the WAL to a previous size, and clear anything currently set in the writer
 	void Truncate(int64_t size);
@@ -11,14 +11,16 @@
 #include "duckdb/common/constants.hpp"
 
 namespace duckdb {
-class ChunkVectorInfo;
+class ChunkInfo;
 class DataTable;
 
 struct DeleteInfo {
 	DataTable *table;
-	ChunkVectorInfo *vinfo;
+	ChunkInfo *vinfo;
 	idx_t count;
 	idx_t base_row;
+	//! If true, all the rows of the chunk were deleted: the rows are [0, count) and are not stored in the rows array
+	bool is_consecutive;
 	row_t rows[1];
 };
 
@@ -8,9 +8,12 @@
 
 #pragma once
 
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/chunk_collection.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 
+#include <atomic>
+
 namespace duckdb {
 class DataTable;
 class WriteAheadLog;
@@ -31,10 +34,17 @@ public:
 	//! The number of deleted rows
 	idx_t deleted_rows;
 	//! The number of active scans
-	idx_t active_scans = 0;
+	std::atomic<idx_t> active_scans;
+	//! Lock for the chunks of the collection: chunks can be appended while parallel scans read the collection (e.g. in
+	//! an INSERT INTO tbl SELECT * FROM tbl)
+	mutex collection_lock;
 
 public:
 	void InitializeScan(LocalScanState &state, TableFilterSet *table_filters = nullptr);
+	//! Initialize a scan of the chunks [start_chunk, end_chunk) of the storage. Returns false if there is nothing to
+	//! scan in this range.
+	bool InitializeScanWithOffset(LocalScanState &state, TableFilterSet *table_filters, idx_t start_chunk,
+	                              idx_t end_chunk);
 
 	void Clear();
 };
@@ -52,11 +62,21 @@ public:
 
 	//! Initialize a scan of the local storage
 	void InitializeScan(DataTable *table, LocalScanState &state, TableFilterSet *table_filters);
+	//! Initialize a scan of the next morsel of at most chunk_count chunks of the local data covered by the
+	//! parallel_state, starting at chunk_index. Returns false if all of that data has been handed out.
+	bool NextParallelScan(LocalScanState &parallel_state, LocalScanState &state, TableFilterSet *table_filters,
+	                      idx_t &chunk_index, idx_t chunk_count);
 	//! Scan
 	void Scan(LocalScanState &state, const vector<column_t> &column_ids, DataChunk &result);
 
 	//! Append a chunk to the local storage
 	void Append(DataTable *table, DataChunk &chunk);
+	//! Append a collection of chunks to the local storage, moving the chunks out of the collection
+	void Append(DataTable *table, ChunkCollection &collection);
+	//! Fetch a single value of a row of the local storage
+	void FetchRow(DataTable *table, row_t row_id, column_t column_id, Vector &result, idx_t result_idx);
+	//! Returns whether or not a row of the local storage was deleted by the transaction
+	bool IsDeleted(DataTable *table, row_t row_id);
 	//! Delete a set of rows from the local storage
 	void Delete(DataTable *table, Vector &row_ids, idx_t count);
 	//! Update a set of rows in the local storage
@@ -88,6 +108,7 @@ public:
 
 private:
 	LocalTableStorage *GetStorage(DataTable *table);
+	LocalTableStorage *GetOrCreateStorage(DataTable *table);
 
 	template <class T> bool ScanTableStorage(DataTable &table, LocalTableStorage &storage, T &&fun);
 
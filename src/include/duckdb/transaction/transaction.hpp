@@ -22,7 +22,7 @@ class CatalogEntry;
 class DataTable;
 class WriteAheadLog;
 
-class ChunkVectorInfo;
+class ChunkInfo;
 
 struct DeleteInfo;
 struct UpdateInfo;
@@ -35,7 +35,7 @@ public:
 	Transaction(transaction_t start_time, transaction_t transaction_id, timestamp_t start_timestamp, idx_t catalog_version)
 	    : start_time(start_time), transaction_id(transaction_id), commit_id(0), highest_active_query(0),
 	      active_query(MAXIMUM_QUERY_ID), start_timestamp(start_timestamp), catalog_version(catalog_version),
-		  storage(*this), is_invalidated(false) {
+		  storage(*this), checkpoint_requested(false), is_invalidated(false) {
 	}
 
 	//! The start timestamp of this transaction
@@ -57,6 +57,8 @@ public:
 	LocalStorage storage;
 	//! Map of all sequences that were used during the transaction and the value they had in this transaction
 	unordered_map<SequenceCatalogEntry *, SequenceValue> sequence_usage;
+	//! Whether or not the database should be checkpointed on the next startup once the transaction has committed
+	bool checkpoint_requested;
 	//! Whether or not the transaction has been invalidated
 	bool is_invalidated;
 
@@ -76,6 +78,10 @@ public:
 	void Cleanup() {
 		undo_buffer.Cleanup();
 	}
+	//! Whether or not the transaction has made any changes to the database
+	bool ChangesMade() {
+		return undo_buffer.ChangesMade();
+	}
 
 	void Invalidate() {
 		is_invalidated = true;
@@ -88,7 +94,8 @@ public:
 		return start_timestamp;
 	}
 
-	void PushDelete(DataTable *table, ChunkVectorInfo *vinfo, row_t rows[], idx_t count, idx_t base_row);
+	//! Push a delete of the given rows into the undo buffer. If rows is nullptr, all rows of the chunk were deleted.
+	void PushDelete(DataTable *table, ChunkInfo *vinfo, row_t rows[], idx_t count, idx_t base_row);
 	void PushAppend(DataTable *table, idx_t row_start, idx_t row_count);
 	UpdateInfo *CreateUpdateInfo(idx_t type_size, idx_t entries);
 
@@ -11,6 +11,9 @@
 #include "duckdb/common/constants.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
+#include <algorithm>
+#include <atomic>
+
 namespace duckdb {
 class ColumnData;
 class UncompressedSegment;
@@ -22,6 +25,10 @@ struct UpdateInfo {
 	UncompressedSegment *segment;
 	//! The version number
 	transaction_t version_number;
+	//! An upper bound on the version numbers of this UpdateInfo and all UpdateInfo's that follow it in the chain. This
+	//! is only maintained for the UpdateInfo at the front of the chain, and lowered by scans once the versions have
+	//! been committed. Scans only hold a shared lock on the segment, hence this is atomic
+	std::atomic<transaction_t> newest_version;
 	//! The vector index within the uncompressed segment
 	idx_t vector_index;
 	//! The amount of updated tuples
@@ -52,6 +59,37 @@ struct UpdateInfo {
 			current = current->next;
 		}
 	}
+
+	//! Returns true if any of the UpdateInfo's in the chain starting at head are relevant for the transaction, i.e. if
+	//! UpdatesForTransaction would execute the callback at least once
+	static bool HasUpdatesForTransaction(UpdateInfo *head, Transaction &transaction) {
+		if (!head || head->newest_version <= transaction.start_time) {
+			// all versions in the chain were committed before the transaction started
+			return false;
+		}
+		bool has_updates = false;
+		transaction_t newest_version = 0;
+		for (auto current = head; current; current = current->next) {
+			transaction_t version = current->version_number;
+			if (version > transaction.start_time && version != transaction.transaction_id) {
+				has_updates = true;
+			}
+			newest_version = MaxValue(newest_version, version);
+		}
+		// versions can only have been committed since the bound was set, so we can lower it
+		// every bound computed by a concurrent scan is valid as well, so the order of the stores does not matter
+		head->newest_version.store(newest_version);
+		return has_updates;
+	}
+
+	//! Returns the index of the tuple in this UpdateInfo, or INVALID_INDEX if the tuple is not part of it
+	idx_t FindTuple(idx_t tuple) {
+		auto entry = std::lower_bound(tuples, tuples + N, (sel_t)tuple);
+		if (entry == tuples + N || *entry != tuple) {
+			return INVALID_INDEX;
+		}
+		return entry - tuples;
+	}
 };
 
 } // namespace duckdb
@@ -47,8 +47,8 @@ void Appender::EndRow() {
 	}
 	column = 0;
 	chunk.SetCardinality(chunk.size() + 1);
-	if (chunk.size() >= STANDARD_VECTOR_SIZE) {
-		Flush();
+	if (chunk.size() >= STANDARD_VECTOR_SIZE || collection.Count() + chunk.size() >= flush_count) {
+		FlushChunk();
 	}
 }
 
@@ -152,21 +152,105 @@ void Appender::AppendValue(Value value) {
 	column++;
 }
 
+void Appender::AppendDataChunk(DataChunk &value) {
+	if (value.ColumnCount() != chunk.ColumnCount()) {
+		throw InvalidInputException("Failed to append data chunk: expected %d columns but got %d", chunk.ColumnCount(),
+		                            value.ColumnCount());
+	}
+	for (idx_t i = 0; i < chunk.ColumnCount(); i++) {
+		if (value.data[i].type != chunk.data[i].type) {
+			throw InvalidInputException("Failed to append data chunk: type mismatch in column %d, expected %s but got %s",
+			                            i, chunk.data[i].type.ToString(), value.data[i].type.ToString());
+		}
+	}
+	if (column != 0) {
+		throw InvalidInputException("Failed to append data chunk: incomplete append to row!");
+	}
+	// rows appended through the row interface come first
+	FlushChunk();
+	collection.Append(value);
+	if (collection.Count() >= flush_count) {
+		Flush();
+	}
+}
+
+void Appender::AppendColumns(idx_t count, const vector<const_data_ptr_t> &columns,
+                             const vector<const uint8_t *> &validity) {
+	if (columns.size() != chunk.ColumnCount() || validity.size() != chunk.ColumnCount()) {
+		throw InvalidInputException("Failed to append columns: expected %d columns but got %d", chunk.ColumnCount(),
+		                            columns.size());
+	}
+	auto types = chunk.GetTypes();
+	for (idx_t i = 0; i < types.size(); i++) {
+		auto internal_type = types[i].InternalType();
+		if (!TypeIsConstantSize(internal_type) && internal_type != PhysicalType::VARCHAR) {
+			throw InvalidInputException("Failed to append columns: unsupported type %s for column %d",
+			                            types[i].ToString(), i);
+		}
+	}
+	// wrap the arrays in vectors, one STANDARD_VECTOR_SIZE slice at a time, and append them as a chunk
+	DataChunk slice;
+	slice.InitializeEmpty(types);
+	for (idx_t offset = 0; offset < count; offset += STANDARD_VECTOR_SIZE) {
+		idx_t slice_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - offset);
+		for (idx_t i = 0; i < types.size(); i++) {
+			auto &vector = slice.data[i];
+			auto type_size = GetTypeIdSize(types[i].InternalType());
+			FlatVector::SetData(vector, (data_ptr_t)columns[i] + offset * type_size);
+			auto &nullmask = FlatVector::Nullmask(vector);
+			nullmask.reset();
+			if (!validity[i]) {
+				continue;
+			}
+			for (idx_t j = 0; j < slice_count; j++) {
+				auto row = offset + j;
+				if (!(validity[i][row / 8] & (1 << (row % 8)))) {
+					nullmask[j] = true;
+				}
+			}
+		}
+		slice.SetCardinality(slice_count);
+		AppendDataChunk(slice);
+	}
+}
+
+void Appender::FlushChunk() {
+	if (chunk.size() == 0) {
+		return;
+	}
+	collection.Append(chunk);
+	chunk.Reset();
+	if (collection.Count() >= flush_count) {
+		Flush();
+	}
+}
+
 void Appender::Flush() {
 	// check that all vectors have the same length before appending
 	if (column != 0) {
 		throw InvalidInputException("Failed to Flush appender: incomplete append to row!");
 	}
 
-	if (chunk.size() == 0) {
+	if (chunk.size() > 0) {
+		collection.Append(chunk);
+		chunk.Reset();
+	}
+	if (collection.Count() == 0) {
 		return;
 	}
-	context->Append(*description, chunk);
+	context->Append(*description, collection);
 
-	chunk.Reset();
+	collection.Reset();
 	column = 0;
 }
 
+void Appender::SetFlushCount(idx_t count) {
+	if (count == 0) {
+		throw InvalidInputException("The flush count of an appender must be at least 1");
+	}
+	flush_count = count;
+}
+
 void Appender::Close() {
 	if (column == 0 || column == chunk.ColumnCount()) {
 		Flush();
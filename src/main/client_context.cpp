@@ -6,6 +6,8 @@
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/pending_query_result.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/stream_query_result.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
@@ -122,11 +124,26 @@ string ClientContext::FinalizeQuery(ClientContextLock &lock, bool success) {
 }
 
 void ClientContext::CleanupInternal(ClientContextLock &lock) {
+	if (open_pending_query) {
+		// a pending query was abandoned before its result was fetched: stop its execution
+		executor.CancelTasks();
+		if (transaction.HasActiveTransaction() && !open_pending_query->prepared->read_only) {
+			// the query might have partially modified the database
+			ActiveTransaction().Invalidate();
+		}
+		FinalizeQuery(lock, false);
+		open_pending_query->is_open = false;
+		open_pending_query = nullptr;
+		this->query = string();
+		return;
+	}
 	if (!open_result) {
 		// no result currently open
 		return;
 	}
 
+	// the open result keeps the plan alive until it is closed
+	executor.ReleaseStates();
 	auto error = FinalizeQuery(lock, open_result->success);
 	if (open_result->success) {
 		// if an error occurred while committing report it in the result
@@ -145,7 +162,8 @@ unique_ptr<DataChunk> ClientContext::FetchInternal(ClientContextLock &) {
 }
 
 shared_ptr<PreparedStatementData> ClientContext::CreatePreparedStatement(ClientContextLock &lock, const string &query,
-                                                                         unique_ptr<SQLStatement> statement) {
+                                                                         unique_ptr<SQLStatement> statement,
+                                                                         bool propagate_statistics) {
 	StatementType statement_type = statement->type;
 	auto result = make_shared<PreparedStatementData>(statement_type);
 
@@ -168,6 +186,7 @@ shared_ptr<PreparedStatementData> ClientContext::CreatePreparedStatement(ClientC
 	if (enable_optimizer) {
 		profiler.StartPhase("optimizer");
 		Optimizer optimizer(planner.binder, *this);
+		optimizer.propagate_statistics = propagate_statistics;
 		plan = optimizer.Optimize(move(plan));
 		D_ASSERT(plan);
 		profiler.EndPhase();
@@ -183,10 +202,8 @@ shared_ptr<PreparedStatementData> ClientContext::CreatePreparedStatement(ClientC
 	return result;
 }
 
-unique_ptr<QueryResult> ClientContext::ExecutePreparedStatement(ClientContextLock &lock, const string &query,
-                                                                shared_ptr<PreparedStatementData> statement_p,
-                                                                vector<Value> bound_values, bool allow_stream_result) {
-	auto &statement = *statement_p;
+void ClientContext::InitializePreparedStatement(ClientContextLock &lock, PreparedStatementData &statement,
+                                                vector<Value> bound_values) {
 	if (ActiveTransaction().IsInvalidated() && statement.requires_valid_transaction) {
 		throw Exception("Current transaction is aborted (please ROLLBACK)");
 	}
@@ -199,15 +216,17 @@ unique_ptr<QueryResult> ClientContext::ExecutePreparedStatement(ClientContextLoc
 	// bind the bound values before execution
 	statement.Bind(move(bound_values));
 
-	bool create_stream_result = statement.allow_stream_result && allow_stream_result;
-
-	// store the physical plan in the context for calls to Fetch()
+	// store the physical plan in the context for calls to Fetch() and schedule its pipelines
 	executor.Initialize(statement.plan.get());
 
-	auto types = executor.GetTypes();
-
-	D_ASSERT(types == statement.types);
+	D_ASSERT(executor.GetTypes() == statement.types);
+}
 
+unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lock,
+                                                           shared_ptr<PreparedStatementData> statement_p,
+                                                           bool allow_stream_result) {
+	auto &statement = *statement_p;
+	bool create_stream_result = statement.allow_stream_result && allow_stream_result;
 	if (create_stream_result) {
 		// successfully compiled SELECT clause and it is the last statement
 		// return a StreamQueryResult so the client can call Fetch() on it and stream the result
@@ -233,6 +252,15 @@ unique_ptr<QueryResult> ClientContext::ExecutePreparedStatement(ClientContextLoc
 	return move(result);
 }
 
+unique_ptr<QueryResult> ClientContext::ExecutePreparedStatement(ClientContextLock &lock, const string &query,
+                                                                shared_ptr<PreparedStatementData> statement_p,
+                                                                vector<Value> bound_values, bool allow_stream_result) {
+	InitializePreparedStatement(lock, *statement_p, move(bound_values));
+	// help the worker threads execute the pipelines
+	executor.WorkOnTasks();
+	return FetchResultInternal(lock, move(statement_p), allow_stream_result);
+}
+
 void ClientContext::InitialCleanup(ClientContextLock &lock) {
 	//! Cleanup any open results and reset the interrupted flag
 	CleanupInternal(lock);
@@ -316,6 +344,10 @@ unique_ptr<QueryResult> ClientContext::Execute(const string &query, shared_ptr<P
 
 unique_ptr<QueryResult> ClientContext::RunStatementInternal(ClientContextLock &lock, const string &query, unique_ptr<SQLStatement> statement,
                                                             bool allow_stream_result) {
+	if (statement->type == StatementType::SELECT_STATEMENT && statement->n_param == 0 && transaction.IsAutoCommit() &&
+	    !query_verification_enabled && PlanCache::GetPlanCache(*this).IsEnabled()) {
+		return RunCachedStatement(lock, query, move(statement), allow_stream_result);
+	}
 	// prepare the query for execution
 	auto prepared = CreatePreparedStatement(lock, query, move(statement));
 	// by default, no values are bound
@@ -324,6 +356,42 @@ unique_ptr<QueryResult> ClientContext::RunStatementInternal(ClientContextLock &l
 	return ExecutePreparedStatement(lock, query, move(prepared), move(bound_values), allow_stream_result);
 }
 
+unique_ptr<QueryResult> ClientContext::RunCachedStatement(ClientContextLock &lock, const string &query,
+                                                          unique_ptr<SQLStatement> statement, bool allow_stream_result) {
+	auto &plan_cache = PlanCache::GetPlanCache(*this);
+	// replace the literals of the statement by parameters
+	auto normalized_statement = statement->Copy();
+	vector<Value> values;
+	auto key = PlanCache::NormalizeStatement(*this, (SelectStatement &)*normalized_statement, values);
+
+	shared_ptr<PreparedStatementData> prepared;
+	if (!key.empty()) {
+		auto catalog_version = ActiveTransaction().catalog_version;
+		prepared = plan_cache.Get(key, catalog_version);
+		if (!prepared) {
+			// cache miss: plan the normalized statement. Cached plans are reused after the data has changed, so they
+			// cannot depend on the statistics of the data.
+			try {
+				prepared = CreatePreparedStatement(lock, query, move(normalized_statement), false);
+			} catch (std::exception &ex) {
+				// the normalized statement could not be planned: fall back to planning the original statement
+				prepared = nullptr;
+			}
+			if (prepared && prepared->value_map.size() == values.size()) {
+				plan_cache.Put(key, prepared);
+			} else {
+				prepared = nullptr;
+			}
+		}
+	}
+	if (!prepared) {
+		// the statement cannot be cached: plan the original statement
+		prepared = CreatePreparedStatement(lock, query, move(statement));
+		values.clear();
+	}
+	return ExecutePreparedStatement(lock, query, move(prepared), move(values), allow_stream_result);
+}
+
 unique_ptr<QueryResult> ClientContext::RunStatementOrPreparedStatement(ClientContextLock &lock,
                                                                        const string &query,
                                                                        unique_ptr<SQLStatement> statement,
@@ -479,6 +547,122 @@ unique_ptr<QueryResult> ClientContext::Query(const string &query, bool allow_str
 	return RunStatements(*lock, query, statements, allow_stream_result);
 }
 
+unique_ptr<PendingQueryResult> ClientContext::PendingQuery(const string &query, bool allow_stream_result) {
+	auto lock = LockContext();
+	LogQueryInternal(*lock, query);
+
+	unique_ptr<SQLStatement> statement;
+	try {
+		InitialCleanup(*lock);
+		auto statements = ParseStatementsInternal(*lock, query);
+		if (statements.size() != 1) {
+			throw InvalidInputException("PendingQuery requires exactly one statement, but %llu were provided",
+			                            statements.size());
+		}
+		statement = move(statements[0]);
+	} catch (std::exception &ex) {
+		return make_unique<PendingQueryResult>(ex.what());
+	}
+
+	this->query = query;
+	if (transaction.IsAutoCommit()) {
+		transaction.BeginTransaction();
+	}
+	ActiveTransaction().active_query = db->transaction_manager->GetQueryNumber();
+	profiler.StartQuery(query);
+	shared_ptr<PreparedStatementData> prepared;
+	try {
+		prepared = CreatePreparedStatement(*lock, query, move(statement));
+		InitializePreparedStatement(*lock, *prepared, vector<Value>());
+	} catch (std::exception &ex) {
+		// other types of exceptions do invalidate the current transaction
+		if (!dynamic_cast<StandardException *>(&ex) && transaction.HasActiveTransaction()) {
+			ActiveTransaction().Invalidate();
+		}
+		FinalizeQuery(*lock, false);
+		return make_unique<PendingQueryResult>(ex.what());
+	}
+	auto result = make_unique<PendingQueryResult>(shared_from_this(), move(prepared), allow_stream_result);
+	open_pending_query = result.get();
+	return result;
+}
+
+bool ClientContext::IsActivePendingQuery(ClientContextLock &lock, PendingQueryResult &pending) {
+	return open_pending_query == &pending;
+}
+
+void ClientContext::FailPendingQuery(ClientContextLock &lock, const string &error) {
+	D_ASSERT(open_pending_query);
+	// errors during execution invalidate the current transaction
+	if (transaction.HasActiveTransaction()) {
+		ActiveTransaction().Invalidate();
+	}
+	FinalizeQuery(lock, false);
+	open_pending_query->success = false;
+	open_pending_query->error = error;
+	open_pending_query->is_open = false;
+	open_pending_query = nullptr;
+	this->query = string();
+}
+
+PendingExecutionResult ClientContext::ExecuteTaskInternal(PendingQueryResult &pending) {
+	auto lock = LockContext();
+	if (!IsActivePendingQuery(*lock, pending)) {
+		throw InvalidInputException("Attempting to execute a pending query that is no longer active");
+	}
+	auto result = executor.ExecuteTask();
+	if (result == PendingExecutionResult::EXECUTION_ERROR) {
+		FailPendingQuery(*lock, executor.GetError());
+	}
+	return result;
+}
+
+unique_ptr<QueryResult> ClientContext::ExecutePendingQuery(PendingQueryResult &pending) {
+	auto lock = LockContext();
+	if (!IsActivePendingQuery(*lock, pending)) {
+		throw InvalidInputException("Attempting to execute a pending query that is no longer active");
+	}
+	unique_ptr<QueryResult> result;
+	try {
+		executor.WorkOnTasks();
+		result = FetchResultInternal(*lock, pending.prepared, pending.allow_stream_result);
+	} catch (std::exception &ex) {
+		FailPendingQuery(*lock, ex.what());
+		return make_unique<MaterializedQueryResult>(ex.what());
+	}
+	open_pending_query->is_open = false;
+	open_pending_query = nullptr;
+	if (result->type == QueryResultType::STREAM_RESULT) {
+		// store as currently open result if it is a stream result
+		this->open_result = (StreamQueryResult *)result.get();
+	} else {
+		// finalize the query if it is not a stream result
+		string error = FinalizeQuery(*lock, true);
+		this->query = string();
+		if (!error.empty()) {
+			// failure in committing transaction
+			return make_unique<MaterializedQueryResult>(error);
+		}
+	}
+	return result;
+}
+
+double ClientContext::GetQueryProgress(PendingQueryResult &pending) {
+	auto lock = LockContext();
+	if (!IsActivePendingQuery(*lock, pending)) {
+		return 0;
+	}
+	return executor.GetProgress();
+}
+
+vector<PipelineProgress> ClientContext::GetPipelineProgress(PendingQueryResult &pending) {
+	auto lock = LockContext();
+	if (!IsActivePendingQuery(*lock, pending)) {
+		return vector<PipelineProgress>();
+	}
+	return executor.GetPipelineProgress();
+}
+
 void ClientContext::Interrupt() {
 	interrupted = true;
 }
@@ -708,23 +892,38 @@ unique_ptr<TableDescription> ClientContext::TableInfo(const string &schema_name,
 	return result;
 }
 
-void ClientContext::Append(TableDescription &description, DataChunk &chunk) {
-	RunFunctionInTransaction([&]() {
-		auto &catalog = Catalog::GetCatalog(*this);
-		auto table_entry = catalog.GetEntry<TableCatalogEntry>(*this, description.schema, description.table);
-		// verify that the table columns and types match up
-		if (description.columns.size() != table_entry->columns.size()) {
+static TableCatalogEntry *GetAppendTable(ClientContext &context, TableDescription &description) {
+	auto &catalog = Catalog::GetCatalog(context);
+	auto table_entry = catalog.GetEntry<TableCatalogEntry>(context, description.schema, description.table);
+	// verify that the table columns and types match up
+	if (description.columns.size() != table_entry->columns.size()) {
+		throw Exception("Failed to append: table entry has different number of columns!");
+	}
+	for (idx_t i = 0; i < description.columns.size(); i++) {
+		if (description.columns[i].type != table_entry->columns[i].type) {
 			throw Exception("Failed to append: table entry has different number of columns!");
 		}
-		for (idx_t i = 0; i < description.columns.size(); i++) {
-			if (description.columns[i].type != table_entry->columns[i].type) {
-				throw Exception("Failed to append: table entry has different number of columns!");
-			}
-		}
+	}
+	return table_entry;
+}
+
+void ClientContext::Append(TableDescription &description, DataChunk &chunk) {
+	RunFunctionInTransaction([&]() {
+		auto table_entry = GetAppendTable(*this, description);
 		table_entry->storage->Append(*table_entry, *this, chunk);
 	});
 }
 
+void ClientContext::Append(TableDescription &description, ChunkCollection &collection) {
+	RunFunctionInTransaction([&]() {
+		auto table_entry = GetAppendTable(*this, description);
+		for (auto &chunk : collection.Chunks()) {
+			table_entry->storage->VerifyAppendConstraints(*table_entry, *chunk);
+		}
+		table_entry->storage->LocalAppend(*this, collection);
+	});
+}
+
 void ClientContext::TryBindRelation(Relation &relation, vector<ColumnDefinition> &result_columns) {
 	RunFunctionInTransaction([&]() {
 		// bind the expressions
@@ -64,6 +64,10 @@ unique_ptr<MaterializedQueryResult> Connection::Query(string query) {
 	return unique_ptr_cast<QueryResult, MaterializedQueryResult>(move(result));
 }
 
+unique_ptr<PendingQueryResult> Connection::PendingQuery(string query) {
+	return context->PendingQuery(query, false);
+}
+
 unique_ptr<MaterializedQueryResult> Connection::Query(unique_ptr<SQLStatement> statement) {
 	auto result = context->Query(move(statement), false);
 	D_ASSERT(result->type == QueryResultType::MATERIALIZED_RESULT);
@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/plan_cache.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -45,9 +46,13 @@ void DatabaseInstance::Initialize(const char *path, DBConfig *new_config) {
 	transaction_manager = make_unique<TransactionManager>(*storage, *catalog);
 	scheduler = make_unique<TaskScheduler>();
 	object_cache = make_unique<ObjectCache>();
+	object_cache->block_cache.SetLimit(config.block_cache_size);
+	object_cache->block_cache.SetSpillDirectory(config.block_cache_directory);
+	plan_cache = make_unique<PlanCache>(config.plan_cache_size);
 
 	// initialize the database
 	storage->Initialize();
+	storage->buffer_manager->SetReadAheadThreads(NumberOfThreads());
 }
 
 DuckDB::DuckDB(const char *path, DBConfig *new_config) : instance(make_shared<DatabaseInstance>()) {
@@ -77,7 +82,7 @@ void DatabaseInstance::Configure(DBConfig &new_config) {
 	if (new_config.file_system) {
 		config.file_system = move(new_config.file_system);
 	} else {
-		config.file_system = make_unique<FileSystem>();
+		config.file_system = make_unique<LocalFileSystem>();
 	}
 	if (config.maximum_memory == (idx_t)-1) {
 		config.maximum_memory = config.file_system->GetAvailableMemory() * 8 / 10;
@@ -87,12 +92,16 @@ void DatabaseInstance::Configure(DBConfig &new_config) {
 	config.checkpoint_only = new_config.checkpoint_only;
 	config.checkpoint_wal_size = new_config.checkpoint_wal_size;
 	config.use_direct_io = new_config.use_direct_io;
+	config.use_mmap = new_config.use_mmap;
 	config.maximum_memory = new_config.maximum_memory;
 	config.temporary_directory = new_config.temporary_directory;
 	config.collation = new_config.collation;
 	config.default_order_type = new_config.default_order_type;
 	config.default_null_order = new_config.default_null_order;
 	config.enable_copy = new_config.enable_copy;
+	config.plan_cache_size = new_config.plan_cache_size;
+	config.block_cache_size = new_config.block_cache_size;
+	config.block_cache_directory = new_config.block_cache_directory;
 }
 
 DBConfig &DBConfig::GetConfig(ClientContext &context) {
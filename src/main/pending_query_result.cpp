@@ -0,0 +1,83 @@
+#include "duckdb/main/pending_query_result.hpp"
+
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+
+namespace duckdb {
+
+PendingQueryResult::PendingQueryResult(shared_ptr<ClientContext> context_p, shared_ptr<PreparedStatementData> prepared_p,
+                                       bool allow_stream_result)
+    : success(true), context(move(context_p)), prepared(move(prepared_p)), allow_stream_result(allow_stream_result),
+      is_open(true) {
+}
+
+PendingQueryResult::PendingQueryResult(string error)
+    : success(false), error(move(error)), allow_stream_result(false), is_open(false) {
+}
+
+PendingQueryResult::~PendingQueryResult() {
+	Close();
+}
+
+void PendingQueryResult::CheckExecutable() {
+	if (!success) {
+		throw InvalidInputException("Attempting to execute an unsuccessful pending query result\nError: %s", error);
+	}
+	if (!is_open) {
+		throw InvalidInputException("Attempting to execute a closed pending query result");
+	}
+}
+
+PendingExecutionResult PendingQueryResult::ExecuteTask() {
+	CheckExecutable();
+	return context->ExecuteTaskInternal(*this);
+}
+
+unique_ptr<QueryResult> PendingQueryResult::Execute() {
+	CheckExecutable();
+	return context->ExecutePendingQuery(*this);
+}
+
+void PendingQueryResult::Cancel() {
+	if (is_open) {
+		context->Interrupt();
+	}
+}
+
+double PendingQueryResult::GetProgress() {
+	if (!is_open) {
+		return success ? 100 : 0;
+	}
+	return context->GetQueryProgress(*this);
+}
+
+vector<PipelineProgress> PendingQueryResult::GetPipelineProgress() {
+	if (!is_open) {
+		return vector<PipelineProgress>();
+	}
+	return context->GetPipelineProgress(*this);
+}
+
+const vector<LogicalType> &PendingQueryResult::GetTypes() {
+	D_ASSERT(prepared);
+	return prepared->types;
+}
+
+const vector<string> &PendingQueryResult::GetNames() {
+	D_ASSERT(prepared);
+	return prepared->names;
+}
+
+StatementType PendingQueryResult::GetStatementType() {
+	D_ASSERT(prepared);
+	return prepared->statement_type;
+}
+
+void PendingQueryResult::Close() {
+	if (!is_open) {
+		return;
+	}
+	context->Cleanup();
+}
+
+} // namespace duckdb
@@ -0,0 +1,289 @@
+#include "duckdb/main/plan_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/common/serializer/buffered_serializer.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/expression/cast_expression.hpp"
+#include "duckdb/parser/expression/comparison_expression.hpp"
+#include "duckdb/parser/expression/conjunction_expression.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
+#include "duckdb/parser/expression/operator_expression.hpp"
+#include "duckdb/parser/expression/parameter_expression.hpp"
+#include "duckdb/parser/expression/subquery_expression.hpp"
+#include "duckdb/parser/query_node/recursive_cte_node.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/query_node/set_operation_node.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/parser/tableref/crossproductref.hpp"
+#include "duckdb/parser/tableref/joinref.hpp"
+#include "duckdb/parser/tableref/subqueryref.hpp"
+
+namespace duckdb {
+
+PlanCache::PlanCache(idx_t capacity) : hits(0), misses(0), capacity(capacity) {
+}
+
+PlanCache &PlanCache::GetPlanCache(ClientContext &context) {
+	return *context.db->plan_cache;
+}
+
+//===--------------------------------------------------------------------===//
+// Normalization
+//===--------------------------------------------------------------------===//
+class StatementNormalizer {
+public:
+	explicit StatementNormalizer(vector<Value> &values) : values(values) {
+	}
+
+	void Normalize(SelectStatement &statement) {
+		for (auto &cte : statement.cte_map) {
+			Normalize(*cte.second->query);
+		}
+		Normalize(*statement.node);
+	}
+
+private:
+	void Normalize(QueryNode &node) {
+		switch (node.type) {
+		case QueryNodeType::SELECT_NODE: {
+			auto &select = (SelectNode &)node;
+			if (select.from_table) {
+				Normalize(*select.from_table);
+			}
+			if (select.where_clause) {
+				NormalizeFilter(select.where_clause);
+			}
+			break;
+		}
+		case QueryNodeType::SET_OPERATION_NODE: {
+			auto &setop = (SetOperationNode &)node;
+			Normalize(*setop.left);
+			Normalize(*setop.right);
+			break;
+		}
+		case QueryNodeType::RECURSIVE_CTE_NODE: {
+			auto &cte = (RecursiveCTENode &)node;
+			Normalize(*cte.left);
+			Normalize(*cte.right);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	void Normalize(TableRef &ref) {
+		switch (ref.type) {
+		case TableReferenceType::JOIN: {
+			auto &join = (JoinRef &)ref;
+			Normalize(*join.left);
+			Normalize(*join.right);
+			break;
+		}
+		case TableReferenceType::CROSS_PRODUCT: {
+			auto &cross = (CrossProductRef &)ref;
+			Normalize(*cross.left);
+			Normalize(*cross.right);
+			break;
+		}
+		case TableReferenceType::SUBQUERY:
+			Normalize(*((SubqueryRef &)ref).subquery);
+			break;
+		default:
+			break;
+		}
+	}
+
+	//! Only the constants that are directly compared against are replaced: constants in other positions (e.g. function
+	//! arguments, GROUP BY/ORDER BY indexes or LIMIT) can influence binding and stay part of the key
+	void NormalizeFilter(unique_ptr<ParsedExpression> &expr) {
+		switch (expr->GetExpressionClass()) {
+		case ExpressionClass::CONJUNCTION: {
+			auto &conj = (ConjunctionExpression &)*expr;
+			for (auto &child : conj.children) {
+				NormalizeFilter(child);
+			}
+			break;
+		}
+		case ExpressionClass::COMPARISON: {
+			auto &comp = (ComparisonExpression &)*expr;
+			if (IsColumnReference(*comp.left) || IsColumnReference(*comp.right)) {
+				// comparisons between a column and a constant are pushed into the scan (and can use an index) only if
+				// the constant is known when the plan is optimized: the constant stays part of the key
+				NormalizeFilter(comp.left);
+				NormalizeFilter(comp.right);
+				break;
+			}
+			NormalizeComparisonChild(comp.left);
+			NormalizeComparisonChild(comp.right);
+			break;
+		}
+		case ExpressionClass::OPERATOR: {
+			auto &op = (OperatorExpression &)*expr;
+			if (op.type == ExpressionType::COMPARE_IN || op.type == ExpressionType::COMPARE_NOT_IN) {
+				if (IsColumnReference(*op.children[0])) {
+					// IN lists of constants on a column are rewritten by the optimizer: keep them as well
+					break;
+				}
+				for (auto &child : op.children) {
+					NormalizeComparisonChild(child);
+				}
+			} else if (op.type == ExpressionType::OPERATOR_NOT) {
+				for (auto &child : op.children) {
+					NormalizeFilter(child);
+				}
+			}
+			break;
+		}
+		case ExpressionClass::SUBQUERY: {
+			auto &subquery = (SubqueryExpression &)*expr;
+			if (subquery.child) {
+				NormalizeComparisonChild(subquery.child);
+			}
+			Normalize(*subquery.subquery);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	static bool IsColumnReference(ParsedExpression &expr) {
+		return expr.GetExpressionClass() == ExpressionClass::COLUMN_REF;
+	}
+
+	void NormalizeComparisonChild(unique_ptr<ParsedExpression> &expr) {
+		if (expr->GetExpressionClass() != ExpressionClass::CONSTANT) {
+			NormalizeFilter(expr);
+			return;
+		}
+		auto &constant = (ConstantExpression &)*expr;
+		auto type = constant.value.type();
+		switch (type.id()) {
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::BIGINT:
+		case LogicalTypeId::HUGEINT:
+		case LogicalTypeId::DECIMAL:
+		case LogicalTypeId::DOUBLE:
+		case LogicalTypeId::VARCHAR:
+			break;
+		default:
+			// NULL (or otherwise typed) constants are left alone
+			return;
+		}
+		if (!expr->alias.empty()) {
+			return;
+		}
+		// replace the constant with a parameter of the same type, so that binding results in the same plan
+		values.push_back(move(constant.value));
+		auto parameter = make_unique<ParameterExpression>();
+		parameter->parameter_nr = values.size();
+		expr = make_unique<CastExpression>(type, move(parameter));
+	}
+
+	vector<Value> &values;
+};
+
+static bool HasTemporaryObjects(ClientContext &context) {
+	bool has_objects = false;
+	auto callback = [&](CatalogEntry *) { has_objects = true; };
+	for (auto type : {CatalogType::TABLE_ENTRY, CatalogType::TABLE_FUNCTION_ENTRY, CatalogType::SCALAR_FUNCTION_ENTRY,
+	                  CatalogType::SEQUENCE_ENTRY}) {
+		context.temporary_objects->Scan(context, type, callback);
+		if (has_objects) {
+			return true;
+		}
+	}
+	return false;
+}
+
+string PlanCache::NormalizeStatement(ClientContext &context, SelectStatement &statement, vector<Value> &values) {
+	StatementNormalizer normalizer(values);
+	normalizer.Normalize(statement);
+
+	// the settings that influence binding and planning are part of the key
+	auto &config = DBConfig::GetConfig(context);
+	BufferedSerializer serializer;
+	serializer.Write<bool>(context.enable_optimizer);
+	serializer.Write<bool>(context.force_parallelism);
+	serializer.Write<bool>(context.force_index_join);
+	serializer.Write<bool>(context.enable_late_materialization);
+	serializer.Write<idx_t>(context.perfect_ht_threshold);
+	serializer.WriteString(config.collation);
+	serializer.Write<OrderType>(config.default_order_type);
+	serializer.Write<OrderByNullType>(config.default_null_order);
+	// temporary objects shadow the objects in the main schema, so plans bound in a connection that has temporary
+	// objects are private to that connection
+	serializer.Write<uintptr_t>(HasTemporaryObjects(context) ? (uintptr_t)&context : 0);
+	try {
+		statement.Serialize(serializer);
+	} catch (std::exception &ex) {
+		// the statement cannot be serialized: do not cache it
+		return string();
+	}
+	auto data = serializer.GetData();
+	return string((const char *)data.data.get(), data.size);
+}
+
+//===--------------------------------------------------------------------===//
+// Cache
+//===--------------------------------------------------------------------===//
+shared_ptr<PreparedStatementData> PlanCache::Get(const string &key, idx_t catalog_version) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entry_map.find(key);
+	if (entry == entry_map.end()) {
+		misses++;
+		return nullptr;
+	}
+	auto &plan = entry->second->second;
+	if (plan->catalog_version != catalog_version || plan.use_count() > 1) {
+		// the plan was bound against a different catalog, or it is in use by another query
+		misses++;
+		return nullptr;
+	}
+	// move the entry to the front of the LRU list
+	entries.splice(entries.begin(), entries, entry->second);
+	hits++;
+	return plan;
+}
+
+void PlanCache::Put(const string &key, shared_ptr<PreparedStatementData> plan) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entry_map.find(key);
+	if (entry != entry_map.end()) {
+		entries.erase(entry->second);
+		entry_map.erase(entry);
+	}
+	entries.emplace_front(key, move(plan));
+	entry_map[key] = entries.begin();
+	EvictEntries();
+}
+
+void PlanCache::EvictEntries() {
+	while (entries.size() > capacity) {
+		entry_map.erase(entries.back().first);
+		entries.pop_back();
+	}
+}
+
+void PlanCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	entries.clear();
+	entry_map.clear();
+}
+
+void PlanCache::SetCapacity(idx_t new_capacity) {
+	lock_guard<mutex> guard(lock);
+	capacity = new_capacity;
+	EvictEntries();
+}
+
+idx_t PlanCache::Count() {
+	lock_guard<mutex> guard(lock);
+	return entries.size();
+}
+
+} // namespace duckdb
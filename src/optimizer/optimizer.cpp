@@ -29,6 +29,7 @@ Optimizer::Optimizer(Binder &binder, ClientContext &context) : context(context),
 	rewriter.rules.push_back(make_unique<ComparisonSimplificationRule>(rewriter));
 	rewriter.rules.push_back(make_unique<MoveConstantsRule>(rewriter));
 	rewriter.rules.push_back(make_unique<LikeOptimizationRule>(rewriter));
+	rewriter.rules.push_back(make_unique<RegexOptimizationRule>(rewriter));
 	rewriter.rules.push_back(make_unique<EmptyNeedleRemovalRule>(rewriter));
 
 #ifdef DEBUG
@@ -81,10 +82,12 @@ unique_ptr<LogicalOperator> Optimizer::Optimize(unique_ptr<LogicalOperator> plan
 	context.profiler.EndPhase();
 
 	// perform statistics propagation
-	context.profiler.StartPhase("statistics_propagation");
-	StatisticsPropagator propagator(context);
-	propagator.PropagateStatistics(plan);
-	context.profiler.EndPhase();
+	if (propagate_statistics) {
+		context.profiler.StartPhase("statistics_propagation");
+		StatisticsPropagator propagator(context);
+		propagator.PropagateStatistics(plan);
+		context.profiler.EndPhase();
+	}
 
 	// then we extract common subexpressions inside the different operators
 	context.profiler.StartPhase("common_subexpressions");
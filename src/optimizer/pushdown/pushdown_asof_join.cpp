@@ -0,0 +1,29 @@
+#include "duckdb/optimizer/filter_pushdown.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+
+namespace duckdb {
+
+using Filter = FilterPushdown::Filter;
+
+unique_ptr<LogicalOperator> FilterPushdown::PushdownAsOfJoin(unique_ptr<LogicalOperator> op,
+                                                             unordered_set<idx_t> &left_bindings,
+                                                             unordered_set<idx_t> &right_bindings) {
+	D_ASSERT(op->type == LogicalOperatorType::LOGICAL_ASOF_JOIN);
+	FilterPushdown left_pushdown(optimizer), right_pushdown(optimizer);
+	// filters on the RHS change which RHS row is the closest match, so only filters on the LHS can be pushed down
+	for (idx_t i = 0; i < filters.size(); i++) {
+		auto side = JoinSide::GetJoinSide(filters[i]->bindings, left_bindings, right_bindings);
+		if (side == JoinSide::LEFT) {
+			// bindings match left side: push into left
+			left_pushdown.filters.push_back(move(filters[i]));
+			// erase the filter from the list of filters
+			filters.erase(filters.begin() + i);
+			i--;
+		}
+	}
+	op->children[0] = left_pushdown.Rewrite(move(op->children[0]));
+	op->children[1] = right_pushdown.Rewrite(move(op->children[1]));
+	return FinishPushdown(move(op));
+}
+
+} // namespace duckdb
@@ -0,0 +1,109 @@
+#include "duckdb/optimizer/rule/regex_optimizations.hpp"
+
+#include "duckdb/function/scalar/regexp.hpp"
+#include "duckdb/function/scalar/string_functions.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+
+namespace duckdb {
+
+RegexOptimizationRule::RegexOptimizationRule(ExpressionRewriter &rewriter) : Rule(rewriter) {
+	// match on an OR that has at least two regular expression matches as children
+	auto op = make_unique<ConjunctionExpressionMatcher>();
+	op->expr_type = make_unique<SpecificExpressionTypeMatcher>(ExpressionType::CONJUNCTION_OR);
+	for (idx_t i = 0; i < 2; i++) {
+		auto func = make_unique<FunctionExpressionMatcher>();
+		func->policy = SetMatcher::Policy::SOME;
+		func->function = make_unique<ManyFunctionMatcher>(unordered_set<string>{"regexp_matches", "regexp_full_match"});
+		op->matchers.push_back(move(func));
+	}
+	op->policy = SetMatcher::Policy::SOME;
+	root = move(op);
+}
+
+//! Returns the bind data of a regular expression match with a constant pattern, or nullptr if it cannot be fused
+static RegexpMatchesBindData *GetFusableRegex(Expression &expr) {
+	if (expr.expression_class != ExpressionClass::BOUND_FUNCTION) {
+		return nullptr;
+	}
+	auto &func = (BoundFunctionExpression &)expr;
+	if (func.function.name != "regexp_matches" && func.function.name != "regexp_full_match") {
+		return nullptr;
+	}
+	if (!func.bind_info) {
+		return nullptr;
+	}
+	auto &info = (RegexpMatchesBindData &)*func.bind_info;
+	if (!info.constant_pattern) {
+		return nullptr;
+	}
+	return &info;
+}
+
+static bool CanFuse(BoundFunctionExpression &left, RegexpMatchesBindData &left_info, BoundFunctionExpression &right,
+                    RegexpMatchesBindData &right_info) {
+	if (left.function.name != right.function.name) {
+		return false;
+	}
+	if (left_info.options.case_sensitive() != right_info.options.case_sensitive() ||
+	    left_info.options.dot_nl() != right_info.options.dot_nl()) {
+		return false;
+	}
+	return left.children[0]->Equals(right.children[0].get());
+}
+
+unique_ptr<Expression> RegexOptimizationRule::Apply(LogicalOperator &op, vector<Expression *> &bindings,
+                                                    bool &changes_made) {
+	auto conjunction = (BoundConjunctionExpression *)bindings[0];
+	auto &children = conjunction->children;
+
+	vector<unique_ptr<Expression>> new_children;
+	vector<bool> fused(children.size(), false);
+	bool fused_any = false;
+	for (idx_t i = 0; i < children.size(); i++) {
+		if (fused[i]) {
+			continue;
+		}
+		auto info = GetFusableRegex(*children[i]);
+		if (!info) {
+			new_children.push_back(move(children[i]));
+			continue;
+		}
+		// gather all the other regular expressions that can be evaluated together with this one
+		auto &func = (BoundFunctionExpression &)*children[i];
+		vector<string> patterns;
+		patterns.push_back(info->constant_pattern->pattern());
+		for (idx_t j = i + 1; j < children.size(); j++) {
+			auto other_info = fused[j] ? nullptr : GetFusableRegex(*children[j]);
+			if (!other_info || !CanFuse(func, *info, (BoundFunctionExpression &)*children[j], *other_info)) {
+				continue;
+			}
+			patterns.push_back(other_info->constant_pattern->pattern());
+			fused[j] = true;
+		}
+		if (patterns.size() == 1) {
+			new_children.push_back(move(children[i]));
+			continue;
+		}
+		bool full_match = func.function.name == "regexp_full_match";
+		auto set_info = make_unique<RegexpMatchesSetBindData>(info->options, move(patterns), full_match);
+		vector<unique_ptr<Expression>> arguments;
+		arguments.push_back(move(func.children[0]));
+		new_children.push_back(make_unique<BoundFunctionExpression>(LogicalType::BOOLEAN, RegexpFun::GetSetFunction(),
+		                                                            move(arguments), move(set_info)));
+		fused_any = true;
+	}
+	if (!fused_any) {
+		// nothing was fused: put the children back in place
+		children = move(new_children);
+		return nullptr;
+	}
+	if (new_children.size() == 1) {
+		return move(new_children[0]);
+	}
+	children = move(new_children);
+	changes_made = true;
+	return nullptr;
+}
+
+} // namespace duckdb
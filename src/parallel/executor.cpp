@@ -1,5 +1,6 @@
 #include "duckdb/execution/executor.hpp"
 
+#include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/helper/physical_execute.hpp"
 #include "duckdb/execution/operator/join/physical_delim_join.hpp"
 #include "duckdb/execution/operator/scan/physical_chunk_scan.hpp"
@@ -41,23 +42,95 @@ void Executor::Initialize(PhysicalOperator *plan) {
 			pipeline->Schedule();
 		}
 	}
+}
 
-	// now execute tasks from this producer until all pipelines are completed
-	while (completed_pipelines < total_pipelines) {
+PendingExecutionResult Executor::ExecuteTask() {
+	if (completed_pipelines < total_pipelines) {
+		// execute a task from this producer (if there is any)
+		auto &scheduler = TaskScheduler::GetScheduler(context);
 		unique_ptr<Task> task;
-		while (scheduler.GetTaskFromProducer(*producer, task)) {
+		if (scheduler.GetTaskFromProducer(*producer, task)) {
 			task->Execute();
 			task.reset();
 		}
+		if (completed_pipelines < total_pipelines) {
+			return PendingExecutionResult::RESULT_NOT_READY;
+		}
 	}
-
+	// all pipelines are completed
 	pipelines.clear();
-	if (exceptions.size() > 0) {
-		// an exception has occurred executing one of the pipelines
-		throw Exception(exceptions[0]);
+	if (context.interrupted && !HasError()) {
+		// the query was interrupted before any of its tasks noticed
+		PushError(InterruptException().what());
+	}
+	if (HasError()) {
+		// the query failed: no results will be fetched
+		ReleaseStates();
+		return PendingExecutionResult::EXECUTION_ERROR;
+	}
+	return PendingExecutionResult::RESULT_READY;
+}
+
+void Executor::WorkOnTasks() {
+	// execute tasks from this producer until all pipelines are completed
+	while (true) {
+		auto result = ExecuteTask();
+		if (result == PendingExecutionResult::RESULT_READY) {
+			return;
+		}
+		if (result == PendingExecutionResult::EXECUTION_ERROR) {
+			// an exception has occurred executing one of the pipelines
+			throw Exception(GetError());
+		}
 	}
 }
 
+void Executor::CancelTasks() {
+	context.interrupted = true;
+	// the remaining tasks return as soon as they notice the interrupt: help them finish
+	while (ExecuteTask() == PendingExecutionResult::RESULT_NOT_READY) {
+	}
+}
+
+vector<PipelineProgress> Executor::GetPipelineProgress() {
+	vector<PipelineProgress> result;
+	for (auto &pipeline : pipelines) {
+		PipelineProgress progress;
+		progress.pipeline = pipeline->ToString();
+		progress.finished_tasks = pipeline->finished_tasks;
+		progress.total_tasks = pipeline->total_tasks;
+		progress.finished = pipeline->IsFinished();
+		result.push_back(move(progress));
+	}
+	return result;
+}
+
+double Executor::GetProgress() {
+	if (total_pipelines == 0 || completed_pipelines == total_pipelines) {
+		return 100;
+	}
+	double progress = 0;
+	for (auto &pipeline : pipelines) {
+		if (pipeline->IsFinished()) {
+			progress += 1;
+		} else if (pipeline->total_tasks > 0) {
+			progress += double(pipeline->finished_tasks) / double(pipeline->total_tasks);
+		}
+	}
+	return progress * 100 / total_pipelines;
+}
+
+bool Executor::HasError() {
+	lock_guard<mutex> elock(executor_lock);
+	return !exceptions.empty();
+}
+
+string Executor::GetError() {
+	lock_guard<mutex> elock(executor_lock);
+	D_ASSERT(!exceptions.empty());
+	return exceptions[0];
+}
+
 void Executor::Reset() {
 	delim_join_dependencies.clear();
 	recursive_cte = nullptr;
@@ -67,6 +140,16 @@ void Executor::Reset() {
 	total_pipelines = 0;
 	exceptions.clear();
 	pipelines.clear();
+	// the plan of the previous query might no longer exist, its states have already been released
+	sinks.clear();
+}
+
+void Executor::ReleaseStates() {
+	physical_state = nullptr;
+	for (auto &sink : sinks) {
+		sink->sink_state.reset();
+	}
+	sinks.clear();
 }
 
 void Executor::BuildPipelines(PhysicalOperator *op, Pipeline *parent) {
@@ -74,6 +157,7 @@ void Executor::BuildPipelines(PhysicalOperator *op, Pipeline *parent) {
 		// operator is a sink, build a pipeline
 		auto pipeline = make_unique<Pipeline>(*this, *producer);
 		pipeline->sink = (PhysicalSink *)op;
+		sinks.push_back(pipeline->sink);
 		pipeline->sink_state = pipeline->sink->GetGlobalState(context);
 		if (parent) {
 			// the parent is dependent on this pipeline to complete
@@ -99,6 +183,8 @@ void Executor::BuildPipelines(PhysicalOperator *op, Pipeline *parent) {
 		case PhysicalOperatorType::BLOCKWISE_NL_JOIN:
 		case PhysicalOperatorType::HASH_JOIN:
 		case PhysicalOperatorType::PIECEWISE_MERGE_JOIN:
+		case PhysicalOperatorType::IE_JOIN:
+		case PhysicalOperatorType::ASOF_JOIN:
 		case PhysicalOperatorType::CROSS_PRODUCT:
 			// regular join, create a pipeline with RHS source that sinks into this pipeline
 			pipeline->child = op->children[1].get();
@@ -126,6 +212,7 @@ void Executor::BuildPipelines(PhysicalOperator *op, Pipeline *parent) {
 			// for delim joins, recurse into the actual join
 			// any pipelines in there depend on the main pipeline
 			auto &delim_join = (PhysicalDelimJoin &)*op;
+			sinks.push_back(delim_join.distinct.get());
 			// any scan of the duplicate eliminated data on the RHS depends on this pipeline
 			// we add an entry to the mapping of (PhysicalOperator*) -> (Pipeline*)
 			for (auto &delim_scan : delim_join.delim_scans) {
@@ -241,10 +328,23 @@ unique_ptr<DataChunk> Executor::FetchChunk() {
 	ExecutionContext econtext(context, thread, task);
 
 	auto chunk = make_unique<DataChunk>();
-	// run the plan to get the next chunks
 	physical_plan->InitializeChunkEmpty(*chunk);
-	physical_plan->GetChunk(econtext, *chunk, physical_state.get());
+	if (!physical_state) {
+		// the query has already finished
+		return chunk;
+	}
+	// run the plan to get the next chunks
+	try {
+		physical_plan->GetChunk(econtext, *chunk, physical_state.get());
+	} catch (...) {
+		ReleaseStates();
+		throw;
+	}
 	context.profiler.Flush(thread.profiler);
+	if (chunk->size() == 0) {
+		// the query has finished: release the states of the operators
+		ReleaseStates();
+	}
 	return chunk;
 }
 
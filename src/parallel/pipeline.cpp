@@ -11,6 +11,7 @@
 #include "duckdb/execution/operator/aggregate/physical_simple_aggregate.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
+#include "duckdb/execution/operator/set/physical_union.hpp"
 
 namespace duckdb {
 
@@ -39,9 +40,6 @@ void Pipeline::Execute(TaskContext &task) {
 	if (client.interrupted) {
 		return;
 	}
-	if (parallel_state) {
-		task.task_info[parallel_node] = parallel_state.get();
-	}
 
 	ThreadContext thread(client);
 	ExecutionContext context(client, thread, task);
@@ -73,6 +71,11 @@ void Pipeline::FinishTask() {
 	D_ASSERT(finished_tasks < total_tasks);
 	idx_t current_finished = ++finished_tasks;
 	if (current_finished == total_tasks) {
+		if (executor.context.interrupted) {
+			// the query was interrupted: skip finalizing the (incomplete) sink state
+			Finish();
+			return;
+		}
 		try {
 			sink->Finalize(*this, executor.context, move(sink_state));
 		} catch (std::exception &ex) {
@@ -95,18 +98,34 @@ void Pipeline::ScheduleSequentialTask() {
 }
 
 bool Pipeline::ScheduleOperator(PhysicalOperator *op) {
+	vector<unique_ptr<Task>> tasks;
+	if (!CreateParallelTasks(op, TaskContext(), tasks)) {
+		parallel_states.clear();
+		return false;
+	}
+	// launch the tasks
+	auto &scheduler = TaskScheduler::GetScheduler(executor.context);
+	this->total_tasks = tasks.size();
+	for (auto &task : tasks) {
+		scheduler.ScheduleTask(*executor.producer, move(task));
+	}
+	return true;
+}
+
+bool Pipeline::CreateParallelTasks(PhysicalOperator *op, const TaskContext &task, vector<unique_ptr<Task>> &tasks) {
 	switch (op->type) {
 	case PhysicalOperatorType::UNNEST:
 	case PhysicalOperatorType::FILTER:
 	case PhysicalOperatorType::PROJECTION:
 	case PhysicalOperatorType::HASH_JOIN:
+	case PhysicalOperatorType::IE_JOIN:
+	case PhysicalOperatorType::ASOF_JOIN:
 	case PhysicalOperatorType::CROSS_PRODUCT:
 	case PhysicalOperatorType::STREAMING_SAMPLE:
 		// filter, projection or hash probe: continue in children
-		return ScheduleOperator(op->children[0].get());
+		return CreateParallelTasks(op->children[0].get(), task, tasks);
 	case PhysicalOperatorType::TABLE_SCAN: {
 		// we reached a scan: split it up into parts and schedule the parts
-		auto &scheduler = TaskScheduler::GetScheduler(executor.context);
 		auto &get = (PhysicalTableScan &)*op;
 		if (!get.function.max_threads) {
 			// table function cannot be parallelized
@@ -122,14 +141,35 @@ bool Pipeline::ScheduleOperator(PhysicalOperator *op) {
 			// table is too small to parallelize
 			return false;
 		}
-		this->parallel_state = get.function.init_parallel_state(executor.context, get.bind_data.get());
-		this->parallel_node = op;
+		auto parallel_state = get.function.init_parallel_state(executor.context, get.bind_data.get());
 
-		// launch a task for every thread
-		this->total_tasks = max_threads;
+		// create a task for every thread
 		for (idx_t i = 0; i < max_threads; i++) {
-			auto task = make_unique<PipelineTask>(this);
-			scheduler.ScheduleTask(*executor.producer, move(task));
+			auto scan_task = make_unique<PipelineTask>(this);
+			scan_task->task = task;
+			scan_task->task.task_info[op] = parallel_state.get();
+			tasks.push_back(move(scan_task));
+		}
+		parallel_states.push_back(move(parallel_state));
+		return true;
+	}
+	case PhysicalOperatorType::UNION: {
+		// union: the branches are independent, so they can be executed by different tasks
+		if (executor.context.db->NumberOfThreads() <= 1) {
+			// no other threads to execute the branches on
+			return false;
+		}
+		for (idx_t branch = 0; branch < op->children.size(); branch++) {
+			auto branch_state = make_unique<UnionBranchState>(branch);
+			TaskContext branch_task = task;
+			branch_task.task_info[op] = branch_state.get();
+			parallel_states.push_back(move(branch_state));
+			if (!CreateParallelTasks(op->children[branch].get(), branch_task, tasks)) {
+				// the branch itself cannot be parallelized: execute it in a single task
+				auto sequential_task = make_unique<PipelineTask>(this);
+				sequential_task->task = move(branch_task);
+				tasks.push_back(move(sequential_task));
+			}
 		}
 		return true;
 	}
@@ -156,6 +196,7 @@ void Pipeline::ClearParents() {
 
 void Pipeline::Reset(ClientContext &context) {
 	sink_state = sink->GetGlobalState(context);
+	parallel_states.clear();
 	finished_tasks = 0;
 	total_tasks = 0;
 	finished = false;
@@ -180,6 +221,7 @@ void Pipeline::Schedule() {
 		}
 		break;
 	}
+	case PhysicalOperatorType::INSERT:
 	case PhysicalOperatorType::CREATE_TABLE_AS:
 	case PhysicalOperatorType::ORDER_BY:
 	case PhysicalOperatorType::RESERVOIR_SAMPLE:
@@ -204,7 +246,9 @@ void Pipeline::Schedule() {
 		break;
 	}
 	case PhysicalOperatorType::CROSS_PRODUCT:
-	case PhysicalOperatorType::HASH_JOIN: {
+	case PhysicalOperatorType::HASH_JOIN:
+	case PhysicalOperatorType::IE_JOIN:
+	case PhysicalOperatorType::ASOF_JOIN: {
 		// schedule build side of the join
 		if (ScheduleOperator(sink->children[1].get())) {
 			// all parallel tasks have been scheduled: return
@@ -249,7 +293,10 @@ void Pipeline::Finish() {
 		// mark a dependency as completed for each of the parents
 		parent->CompleteDependency();
 	}
-	executor.completed_pipelines++;
+	if (!recursive_cte) {
+		// pipelines of a recursive CTE are re-run by the CTE and not counted by the executor
+		executor.completed_pipelines++;
+	}
 }
 
 string Pipeline::ToString() const {
@@ -257,7 +304,7 @@ string Pipeline::ToString() const {
 	auto node = this->child;
 	while (node) {
 		str = PhysicalOperatorToString(node->type) + " -> " + str;
-		node = node->children[0].get();
+		node = node->children.empty() ? nullptr : node->children[0].get();
 	}
 	return str;
 }
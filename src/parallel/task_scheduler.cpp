@@ -106,6 +106,10 @@ TaskScheduler &TaskScheduler::GetScheduler(ClientContext &context) {
 	return *context.db->scheduler;
 }
 
+TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
+	return *db.scheduler;
+}
+
 unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
 	auto token = make_unique<QueueProducerToken>(*queue);
 	return make_unique<ProducerToken>(*this, move(token));
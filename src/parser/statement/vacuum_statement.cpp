@@ -2,10 +2,12 @@
 
 namespace duckdb {
 
-VacuumStatement::VacuumStatement() : SQLStatement(StatementType::VACUUM_STATEMENT){};
+VacuumStatement::VacuumStatement() : SQLStatement(StatementType::VACUUM_STATEMENT), info(make_unique<VacuumInfo>()){};
 
 unique_ptr<SQLStatement> VacuumStatement::Copy() const {
-	return make_unique<VacuumStatement>();
+	auto result = make_unique<VacuumStatement>();
+	result->info = info->Copy();
+	return move(result);
 }
 
 } // namespace duckdb
@@ -5,6 +5,9 @@
 
 namespace duckdb {
 
+static constexpr uint8_t JOIN_FLAG_NATURAL = 1;
+static constexpr uint8_t JOIN_FLAG_ASOF = 2;
+
 bool JoinRef::Equals(const TableRef *other_) const {
 	if (!TableRef::Equals(other_)) {
 		return false;
@@ -19,7 +22,8 @@ bool JoinRef::Equals(const TableRef *other_) const {
 		}
 	}
 	return left->Equals(other->left.get()) && right->Equals(other->right.get()) &&
-	       BaseExpression::Equals(condition.get(), other->condition.get()) && type == other->type;
+	       BaseExpression::Equals(condition.get(), other->condition.get()) && type == other->type &&
+	       is_asof == other->is_asof;
 }
 
 unique_ptr<TableRef> JoinRef::Copy() {
@@ -31,6 +35,7 @@ unique_ptr<TableRef> JoinRef::Copy() {
 	}
 	copy->type = type;
 	copy->is_natural = is_natural;
+	copy->is_asof = is_asof;
 	copy->alias = alias;
 	copy->using_columns = using_columns;
 	return move(copy);
@@ -43,7 +48,9 @@ void JoinRef::Serialize(Serializer &serializer) {
 	right->Serialize(serializer);
 	serializer.WriteOptional(condition);
 	serializer.Write<JoinType>(type);
-	serializer.Write<bool>(is_natural);
+	// the ASOF flag shares the byte of the NATURAL flag, so plain joins are serialized exactly as before
+	uint8_t join_flags = (is_natural ? JOIN_FLAG_NATURAL : 0) | (is_asof ? JOIN_FLAG_ASOF : 0);
+	serializer.Write<uint8_t>(join_flags);
 	D_ASSERT(using_columns.size() <= NumericLimits<uint32_t>::Maximum());
 	serializer.Write<uint32_t>((uint32_t)using_columns.size());
 	for (auto &using_column : using_columns) {
@@ -58,7 +65,9 @@ unique_ptr<TableRef> JoinRef::Deserialize(Deserializer &source) {
 	result->right = TableRef::Deserialize(source);
 	result->condition = source.ReadOptional<ParsedExpression>();
 	result->type = source.Read<JoinType>();
-	result->is_natural = source.Read<bool>();
+	auto join_flags = source.Read<uint8_t>();
+	result->is_natural = join_flags & JOIN_FLAG_NATURAL;
+	result->is_asof = join_flags & JOIN_FLAG_ASOF;
 	auto count = source.Read<uint32_t>();
 	for (idx_t i = 0; i < count; i++) {
 		result->using_columns.push_back(source.Read<string>());
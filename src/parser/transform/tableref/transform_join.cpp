@@ -40,8 +40,17 @@ unique_ptr<TableRef> Transformer::TransformJoin(PGJoinExpr *root) {
 	result->left = TransformTableRefNode(root->larg);
 	result->right = TransformTableRefNode(root->rarg);
 	result->is_natural = root->isNatural;
+	result->is_asof = root->isAsof;
 	result->query_location = root->location;
 
+	if (result->is_asof) {
+		if (result->type != JoinType::INNER && result->type != JoinType::LEFT) {
+			throw ParserException("ASOF JOIN only supports INNER and LEFT joins");
+		}
+		if (!root->quals) {
+			throw ParserException("ASOF JOIN requires an ON clause");
+		}
+	}
 	if (root->usingClause && root->usingClause->length > 0) {
 		// usingClause is a list of strings
 		for (auto node = root->usingClause->head; node != nullptr; node = node->next) {
@@ -132,6 +132,47 @@ unique_ptr<LogicalOperator> LogicalComparisonJoin::CreateJoin(JoinType type, uni
 	}
 }
 
+//! Create an ASOF join. Its condition has to consist of exactly one inequality comparison and any number of equality
+//! comparisons between the two sides of the join.
+static unique_ptr<LogicalOperator> CreateAsOfJoin(JoinType type, unique_ptr<LogicalOperator> left_child,
+                                                  unique_ptr<LogicalOperator> right_child,
+                                                  unordered_set<idx_t> &left_bindings,
+                                                  unordered_set<idx_t> &right_bindings,
+                                                  vector<unique_ptr<Expression>> &expressions) {
+	vector<JoinCondition> conditions;
+	idx_t inequality_count = 0;
+	for (auto &expr : expressions) {
+		bool is_equality = expr->type == ExpressionType::COMPARE_EQUAL;
+		bool is_inequality =
+		    expr->type >= ExpressionType::COMPARE_LESSTHAN && expr->type <= ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+		if ((!is_equality && !is_inequality) ||
+		    JoinSide::GetJoinSide(*expr, left_bindings, right_bindings) != JoinSide::BOTH ||
+		    !CreateJoinCondition(*expr, left_bindings, right_bindings, conditions)) {
+			throw BinderException("ASOF JOIN conditions must be comparisons between the left and the right side of the "
+			                      "join");
+		}
+		if (is_inequality) {
+			inequality_count++;
+		}
+	}
+	if (inequality_count != 1) {
+		throw BinderException("ASOF JOIN requires exactly one inequality condition");
+	}
+	// the inequality condition is always the last condition
+	for (idx_t i = 0; i + 1 < conditions.size(); i++) {
+		if (conditions[i].comparison != ExpressionType::COMPARE_EQUAL) {
+			std::swap(conditions[i], conditions.back());
+			break;
+		}
+	}
+
+	auto asof_join = make_unique<LogicalComparisonJoin>(type, LogicalOperatorType::LOGICAL_ASOF_JOIN);
+	asof_join->conditions = move(conditions);
+	asof_join->children.push_back(move(left_child));
+	asof_join->children.push_back(move(right_child));
+	return move(asof_join);
+}
+
 static bool HasCorrelatedColumns(Expression &expression) {
 	if (expression.type == ExpressionType::BOUND_COLUMN_REF) {
 		auto &colref = (BoundColumnRefExpression &)expression;
@@ -157,6 +198,19 @@ unique_ptr<LogicalOperator> Binder::CreatePlan(BoundJoinRef &ref) {
 		ref.type = JoinType::LEFT;
 		std::swap(left, right);
 	}
+	if (ref.is_asof) {
+		if (ref.condition->HasSubquery() || HasCorrelatedColumns(*ref.condition)) {
+			throw BinderException("ASOF JOIN conditions cannot contain subqueries or correlated columns");
+		}
+		vector<unique_ptr<Expression>> expressions;
+		expressions.push_back(move(ref.condition));
+		LogicalFilter::SplitPredicates(expressions);
+
+		unordered_set<idx_t> left_bindings, right_bindings;
+		LogicalJoin::GetTableReferences(*left, left_bindings);
+		LogicalJoin::GetTableReferences(*right, right_bindings);
+		return CreateAsOfJoin(ref.type, move(left), move(right), left_bindings, right_bindings, expressions);
+	}
 	if (ref.type == JoinType::INNER && (ref.condition->HasSubquery() || HasCorrelatedColumns(*ref.condition))) {
 		// inner join, generate a cross product + filter
 		// this will be later turned into a proper join by the join order optimizer
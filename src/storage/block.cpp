@@ -5,4 +5,8 @@ namespace duckdb {
 Block::Block(block_id_t id) : FileBuffer(FileBufferType::BLOCK, Storage::BLOCK_ALLOC_SIZE), id(id) {
 }
 
+Block::Block(block_id_t id, data_ptr_t mapped_buffer)
+    : FileBuffer(FileBufferType::BLOCK, mapped_buffer, Storage::BLOCK_ALLOC_SIZE), id(id) {
+}
+
 } // namespace duckdb
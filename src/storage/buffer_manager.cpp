@@ -4,6 +4,12 @@
 #include "duckdb/common/exception.hpp"
 #include "concurrentqueue.h"
 
+#ifndef DUCKDB_NO_THREADS
+#include "duckdb/common/thread.hpp"
+#include <condition_variable>
+#include <deque>
+#endif
+
 namespace duckdb {
 
 BlockHandle::BlockHandle(BufferManager &manager_p, block_id_t block_id_p) : manager(manager_p) {
@@ -13,7 +19,8 @@ BlockHandle::BlockHandle(BufferManager &manager_p, block_id_t block_id_p) : mana
 	eviction_timestamp = 0;
 	state = BlockState::BLOCK_UNLOADED;
 	can_destroy = false;
-	memory_usage = Storage::BLOCK_ALLOC_SIZE;
+	// blocks in a memory mapped database file are not loaded into buffers managed by the buffer manager
+	memory_usage = manager.manager.GetMappedBlock(block_id) ? 0 : Storage::BLOCK_ALLOC_SIZE;
 }
 
 BlockHandle::BlockHandle(BufferManager &manager_p, block_id_t block_id_p, unique_ptr<FileBuffer> buffer_p,
@@ -47,13 +54,18 @@ unique_ptr<BufferHandle> BlockHandle::Load(shared_ptr<BlockHandle> &handle) {
 	}
 	handle->state = BlockState::BLOCK_LOADED;
 	if (handle->block_id < MAXIMUM_BLOCK) {
-		// FIXME: currently we still require a lock for reading blocks from disk
-		// this is mainly down to the block manager only having a single pointer into the file
-		// this is relatively easy to fix later on
-		lock_guard<mutex> buffer_lock(handle->manager.manager_lock);
-		auto block = make_unique<Block>(handle->block_id);
-		handle->manager.manager.Read(*block);
-		handle->buffer = move(block);
+		// reads from the database file are positional, so different blocks can be loaded concurrently
+		auto mapped_block = handle->manager.manager.GetMappedBlock(handle->block_id);
+		if (mapped_block) {
+			// the block is memory mapped: only verify its checksum
+			auto block = make_unique<Block>(handle->block_id, mapped_block);
+			block->VerifyChecksum();
+			handle->buffer = move(block);
+		} else {
+			auto block = make_unique<Block>(handle->block_id);
+			handle->manager.manager.Read(*block);
+			handle->buffer = move(block);
+		}
 	} else {
 		if (handle->can_destroy) {
 			return nullptr;
@@ -89,6 +101,10 @@ bool BlockHandle::CanUnload() {
 		// there are active readers
 		return false;
 	}
+	if (memory_usage == 0) {
+		// memory mapped block: unloading it would not free any memory
+		return false;
+	}
 	if (block_id >= MAXIMUM_BLOCK && !can_destroy && manager.temp_directory.empty()) {
 		// in order to unload this block we need to write it to a temporary buffer
 		// however, no temporary directory is specified!
@@ -122,15 +138,119 @@ struct EvictionQueue {
 	eviction_queue_t q;
 };
 
+//! The read-ahead queue loads blocks on a set of background threads. There is one thread fewer than the database has
+//! threads (PRAGMA threads), so a single-threaded database does not read ahead; the threads are only launched once the
+//! first block is read ahead, and they hold weak references so that a queued block can still be destroyed.
+struct ReadAheadQueue {
+	//! The maximum amount of blocks that can be queued; further read-ahead requests are dropped
+	static constexpr idx_t MAXIMUM_QUEUED_BLOCKS = 64;
+
+	explicit ReadAheadQueue(BufferManager &manager) : manager(manager), thread_count(0), shutdown(false) {
+	}
+	~ReadAheadQueue() {
+#ifndef DUCKDB_NO_THREADS
+		{
+			lock_guard<mutex> guard(lock);
+			shutdown = true;
+		}
+		signal.notify_all();
+		for (auto &worker : threads) {
+			worker->join();
+		}
+#endif
+	}
+
+	BufferManager &manager;
+#ifndef DUCKDB_NO_THREADS
+	mutex lock;
+	std::condition_variable signal;
+	std::deque<weak_ptr<BlockHandle>> blocks;
+	vector<unique_ptr<thread>> threads;
+#endif
+	//! The amount of background threads loading blocks
+	idx_t thread_count;
+	bool shutdown;
+
+	void SetThreadCount(idx_t count) {
+#ifndef DUCKDB_NO_THREADS
+		vector<unique_ptr<thread>> stopped_threads;
+		{
+			lock_guard<mutex> guard(lock);
+			thread_count = count;
+			// the threads beyond the new thread count exit once they are woken up
+			while (threads.size() > thread_count) {
+				stopped_threads.push_back(move(threads.back()));
+				threads.pop_back();
+			}
+		}
+		signal.notify_all();
+		for (auto &worker : stopped_threads) {
+			worker->join();
+		}
+#endif
+	}
+
+	void Enqueue(vector<shared_ptr<BlockHandle>> &handles) {
+#ifndef DUCKDB_NO_THREADS
+		{
+			lock_guard<mutex> guard(lock);
+			while (threads.size() < thread_count) {
+				threads.push_back(make_unique<thread>(&ReadAheadQueue::LoadBlocks, this, threads.size()));
+			}
+			if (threads.empty()) {
+				return;
+			}
+			for (auto &handle : handles) {
+				if (blocks.size() >= MAXIMUM_QUEUED_BLOCKS) {
+					break;
+				}
+				blocks.push_back(weak_ptr<BlockHandle>(handle));
+			}
+		}
+		signal.notify_all();
+#endif
+	}
+
+#ifndef DUCKDB_NO_THREADS
+	void LoadBlocks(idx_t thread_index) {
+		while (true) {
+			shared_ptr<BlockHandle> handle;
+			{
+				std::unique_lock<mutex> guard(lock);
+				signal.wait(guard, [&] { return shutdown || thread_index >= thread_count || !blocks.empty(); });
+				if (shutdown || thread_index >= thread_count) {
+					return;
+				}
+				handle = blocks.front().lock();
+				blocks.pop_front();
+			}
+			if (!handle) {
+				// the block was destroyed before we got to it
+				continue;
+			}
+			try {
+				// pin and immediately unpin the block: it stays loaded until it is evicted
+				manager.Pin(handle);
+			} catch (std::exception &ex) {
+				// read-ahead is only a hint: any error is reported when the block is actually used
+			}
+		}
+	}
+#endif
+};
+
 BufferManager::BufferManager(FileSystem &fs, BlockManager &manager, string tmp, idx_t maximum_memory)
     : fs(fs), manager(manager), current_memory(0), maximum_memory(maximum_memory), temp_directory(move(tmp)),
-      queue(make_unique<EvictionQueue>()), temporary_id(MAXIMUM_BLOCK) {
+      queue(make_unique<EvictionQueue>()), temporary_id(MAXIMUM_BLOCK),
+      read_ahead(make_unique<ReadAheadQueue>(*this)) {
 	if (!temp_directory.empty()) {
 		fs.CreateDirectory(temp_directory);
 	}
 }
 
 BufferManager::~BufferManager() {
+	// stop the read-ahead threads before anything they might be loading is destroyed
+	read_ahead.reset();
 	if (!temp_directory.empty()) {
 		fs.RemoveDirectory(temp_directory);
 	}
@@ -194,6 +314,34 @@ unique_ptr<BufferHandle> BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	return handle->Load(handle);
 }
 
+void BufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
+	vector<shared_ptr<BlockHandle>> unloaded_handles;
+	idx_t required_memory = current_memory;
+	for (auto &handle : handles) {
+		if (handle->block_id >= MAXIMUM_BLOCK) {
+			// only blocks in the database file are read ahead
+			continue;
+		}
+		lock_guard<mutex> lock(handle->lock);
+		if (handle->state == BlockState::BLOCK_LOADED) {
+			continue;
+		}
+		required_memory += handle->memory_usage;
+		if (required_memory > maximum_memory) {
+			// reading ahead would only evict blocks that are in use
+			break;
+		}
+		unloaded_handles.push_back(handle);
+	}
+	if (!unloaded_handles.empty()) {
+		read_ahead->Enqueue(unloaded_handles);
+	}
+}
+
+void BufferManager::SetReadAheadThreads(idx_t database_threads) {
+	read_ahead->SetThreadCount(database_threads > 1 ? database_threads - 1 : 0);
+}
+
 void BufferManager::Unpin(shared_ptr<BlockHandle> &handle) {
 	lock_guard<mutex> lock(handle->lock);
 	D_ASSERT(handle->readers > 0);
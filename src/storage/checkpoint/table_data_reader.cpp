@@ -5,34 +5,28 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/common/types/null_value.hpp"
 
-#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
-
-#include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
-
-#include "duckdb/main/database.hpp"
-#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/table/persistent_segment.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
 
 namespace duckdb {
 
-TableDataReader::TableDataReader(CheckpointManager &manager, MetaBlockReader &reader, BoundCreateTableInfo &info)
-    : manager(manager), reader(reader), info(info) {
-	info.data = make_unique<PersistentTableData>(info.Base().columns.size());
+TableDataReader::TableDataReader(BufferManager &buffer_manager, MetaBlockReader &reader,
+                                 const vector<LogicalType> &types, PersistentTableData &data)
+    : buffer_manager(buffer_manager), reader(reader), types(types), data(data) {
 }
 
 void TableDataReader::ReadTableData() {
-	auto &columns = info.Base().columns;
-	D_ASSERT(columns.size() > 0);
+	D_ASSERT(types.size() > 0);
 
 	// load the column statistics
-	for (idx_t col = 0; col < columns.size(); col++) {
-		auto &column = columns[col];
-		info.data->column_stats[col] = BaseStatistics::Deserialize(reader, column.type);
+	for (idx_t col = 0; col < types.size(); col++) {
+		data.column_stats[col] = BaseStatistics::Deserialize(reader, types[col]);
 	}
 
 	// load the data pointers for the table
 	idx_t table_count = 0;
-	for (idx_t col = 0; col < columns.size(); col++) {
-		auto &column = columns[col];
+	for (idx_t col = 0; col < types.size(); col++) {
+		auto &type = types[col];
 		idx_t column_count = 0;
 		idx_t data_pointer_count = reader.Read<idx_t>();
 		for (idx_t data_ptr = 0; data_ptr < data_pointer_count; data_ptr++) {
@@ -42,14 +36,14 @@ void TableDataReader::ReadTableData() {
 			data_pointer.tuple_count = reader.Read<idx_t>();
 			data_pointer.block_id = reader.Read<block_id_t>();
 			data_pointer.offset = reader.Read<uint32_t>();
-			data_pointer.statistics = BaseStatistics::Deserialize(reader, column.type);
+			data_pointer.statistics = BaseStatistics::Deserialize(reader, type);
 
 			column_count += data_pointer.tuple_count;
 			// create a persistent segment
-			auto segment = make_unique<PersistentSegment>(manager.buffer_manager, data_pointer.block_id,
-			                                              data_pointer.offset, column.type, data_pointer.row_start,
-			                                              data_pointer.tuple_count, move(data_pointer.statistics));
-			info.data->table_data[col].push_back(move(segment));
+			auto segment = make_unique<PersistentSegment>(buffer_manager, data_pointer.block_id, data_pointer.offset,
+			                                              type, data_pointer.row_start, data_pointer.tuple_count,
+			                                              move(data_pointer.statistics));
+			data.table_data[col].push_back(move(segment));
 		}
 		if (col == 0) {
 			table_count = column_count;
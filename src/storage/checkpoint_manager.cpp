@@ -27,7 +27,7 @@
 #include "duckdb/transaction/transaction_manager.hpp"
 
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
-#include "duckdb/storage/checkpoint/table_data_reader.hpp"
+#include "duckdb/storage/table/persistent_table_data.hpp"
 
 namespace duckdb {
 
@@ -236,13 +236,10 @@ void CheckpointManager::ReadTable(ClientContext &context, MetaBlockReader &reade
 	Binder binder(context);
 	auto bound_info = binder.BindCreateTableInfo(move(info));
 
-	// now read the actual table data and place it into the create table info
-	auto block_id = reader.Read<block_id_t>();
-	auto offset = reader.Read<uint64_t>();
-	MetaBlockReader table_data_reader(buffer_manager, block_id);
-	table_data_reader.offset = offset;
-	TableDataReader data_reader(*this, table_data_reader, *bound_info);
-	data_reader.ReadTableData();
+	// the actual table data is only read when the table is first accessed: only keep track of where it is stored
+	bound_info->data = make_unique<PersistentTableData>(bound_info->Base().columns.size());
+	bound_info->data->block_id = reader.Read<block_id_t>();
+	bound_info->data->offset = reader.Read<uint64_t>();
 
 	// finally create the table in the catalog
 	auto &catalog = Catalog::GetCatalog(context);
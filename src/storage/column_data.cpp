@@ -33,8 +33,7 @@ void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t vector_i
 
 void ColumnData::Scan(Transaction &transaction, ColumnScanState &state, Vector &result) {
 	if (!state.initialized) {
-		state.current->InitializeScan(state);
-		state.initialized = true;
+		InitializeSegmentScan(state);
 	}
 	// perform a scan of this segment
 	state.current->Scan(transaction, state, state.vector_index, result);
@@ -45,8 +44,7 @@ void ColumnData::Scan(Transaction &transaction, ColumnScanState &state, Vector &
 void ColumnData::FilterScan(Transaction &transaction, ColumnScanState &state, Vector &result, SelectionVector &sel,
                             idx_t &approved_tuple_count) {
 	if (!state.initialized) {
-		state.current->InitializeScan(state);
-		state.initialized = true;
+		InitializeSegmentScan(state);
 	}
 	// perform a scan of this segment
 	state.current->FilterScan(transaction, state, result, sel, approved_tuple_count);
@@ -57,8 +55,7 @@ void ColumnData::FilterScan(Transaction &transaction, ColumnScanState &state, Ve
 void ColumnData::Select(Transaction &transaction, ColumnScanState &state, Vector &result, SelectionVector &sel,
                         idx_t &approved_tuple_count, vector<TableFilter> &tableFilter) {
 	if (!state.initialized) {
-		state.current->InitializeScan(state);
-		state.initialized = true;
+		InitializeSegmentScan(state);
 	}
 	// perform a scan of this segment
 	state.current->Select(transaction, state, result, sel, approved_tuple_count, tableFilter);
@@ -68,8 +65,7 @@ void ColumnData::Select(Transaction &transaction, ColumnScanState &state, Vector
 
 void ColumnData::IndexScan(ColumnScanState &state, Vector &result) {
 	if (!state.initialized) {
-		state.current->InitializeScan(state);
-		state.initialized = true;
+		InitializeSegmentScan(state);
 	}
 	// perform a scan of this segment
 	state.current->IndexScan(state, result);
@@ -77,6 +73,23 @@ void ColumnData::IndexScan(ColumnScanState &state, Vector &result) {
 	state.Next();
 }
 
+void ColumnData::InitializeSegmentScan(ColumnScanState &state) {
+	state.current->InitializeScan(state);
+	state.initialized = true;
+	// read ahead the on-disk blocks of the next segments, so loading them overlaps with scanning this one
+	vector<shared_ptr<BlockHandle>> blocks;
+	auto segment = (ColumnSegment *)state.current->next.get();
+	for (idx_t i = 0; i < READ_AHEAD_SEGMENTS && segment && segment->start < state.read_ahead_row; i++) {
+		if (segment->segment_type == ColumnSegmentType::PERSISTENT) {
+			blocks.push_back(((PersistentSegment *)segment)->data->block);
+		}
+		segment = (ColumnSegment *)segment->next.get();
+	}
+	if (!blocks.empty()) {
+		manager.Prefetch(blocks);
+	}
+}
+
 void ColumnScanState::Next() {
 	//! There is no column segment
 	if (!current) {
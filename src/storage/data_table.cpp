@@ -3,7 +3,9 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/limits.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/constraints/list.hpp"
 #include "duckdb/transaction/transaction.hpp"
@@ -13,6 +15,8 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/table/persistent_table_data.hpp"
+#include "duckdb/storage/checkpoint/table_data_reader.hpp"
+#include "duckdb/storage/meta_block_reader.hpp"
 
 #include "duckdb/storage/table/morsel_info.hpp"
 
@@ -23,13 +27,22 @@ using namespace std::chrono;
 DataTable::DataTable(StorageManager &storage, string schema, string table, vector<LogicalType> types_,
                      unique_ptr<PersistentTableData> data)
     : info(make_shared<DataTableInfo>(schema, table)), types(types_), storage(storage),
-      versions(make_shared<SegmentTree>()), total_rows(0), is_root(true) {
+      versions(make_shared<SegmentTree>()), total_rows(0), persistent_data_loaded(true), is_root(true) {
 	// set up the segment trees for the column segments
 	for (idx_t i = 0; i < types.size(); i++) {
 		auto column_data = make_shared<ColumnData>(*storage.buffer_manager, *info, types[i], i);
 		columns.push_back(move(column_data));
 	}
+	if (data && !data->IsLoaded()) {
+		// the persistent data is read from the metadata when the table is first accessed
+		persistent_data = move(data);
+		persistent_data_loaded = false;
+		return;
+	}
+	InitializePersistentData(data.get());
+}
 
+void DataTable::InitializePersistentData(PersistentTableData *data) {
 	// initialize the table with the existing data from disk, if any
 	if (data && data->table_data[0].size() > 0) {
 		for (idx_t i = 0; i < types.size(); i++) {
@@ -56,9 +69,117 @@ DataTable::DataTable(StorageManager &storage, string schema, string table, vecto
 	}
 }
 
+//! Creates empty indexes with the same definition as the indexes of the table, which can be filled to the side
+static vector<unique_ptr<Index>> CreateEmptyIndexes(DataTableInfo &info) {
+	vector<unique_ptr<Index>> result;
+	for (auto &index : info.indexes) {
+		D_ASSERT(index->type == IndexType::ART);
+		auto &art = (ART &)*index;
+		vector<unique_ptr<Expression>> unbound_expressions;
+		for (auto &expr : art.unbound_expressions) {
+			unbound_expressions.push_back(expr->Copy());
+		}
+		result.push_back(make_unique<ART>(art.column_ids, move(unbound_expressions), art.is_unique));
+	}
+	return result;
+}
+
+//! Swaps the contents of the indexes of the table with the (filled) indexes created by CreateEmptyIndexes. The index
+//! objects themselves are kept, as they can be referenced by e.g. prepared statements
+static void SwapIndexContents(DataTableInfo &info, vector<unique_ptr<Index>> &new_indexes) {
+	D_ASSERT(info.indexes.size() == new_indexes.size());
+	for (idx_t i = 0; i < info.indexes.size(); i++) {
+		auto &art = (ART &)*info.indexes[i];
+		IndexLock lock;
+		art.InitializeLock(lock);
+		auto &new_art = (ART &)*new_indexes[i];
+		std::swap(art.tree, new_art.tree);
+	}
+}
+
+void DataTable::LoadPersistentData() {
+	if (persistent_data_loaded) {
+		return;
+	}
+	lock_guard<mutex> lock(load_lock);
+	if (persistent_data_loaded) {
+		// loaded by another thread in the meantime
+		return;
+	}
+	// read the statistics and the data pointers of the columns
+	PersistentTableData data(types.size());
+	MetaBlockReader reader(*storage.buffer_manager, persistent_data->block_id);
+	reader.offset = persistent_data->offset;
+	TableDataReader data_reader(*storage.buffer_manager, reader, types, data);
+	data_reader.ReadTableData();
+	try {
+		InitializePersistentData(&data);
+		// the indexes of the table were created before its data was read: fill them to the side, and only replace the
+		// (empty) indexes of the table once all rows have been appended to them
+		if (!info->indexes.empty()) {
+			auto new_indexes = CreateEmptyIndexes(*info);
+			// only the columns that are used by the indexes are scanned
+			vector<column_t> column_ids;
+			vector<LogicalType> scan_types;
+			for (idx_t i = 0; i < types.size(); i++) {
+				for (auto &index : info->indexes) {
+					if (index->column_id_set.find(i) != index->column_id_set.end()) {
+						column_ids.push_back(i);
+						scan_types.push_back(types[i]);
+						break;
+					}
+				}
+			}
+			column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+			scan_types.push_back(LOGICAL_ROW_TYPE);
+			DataChunk scan_chunk;
+			scan_chunk.Initialize(scan_types);
+			// the indexes expect chunks that contain all columns of the table
+			DataChunk entries;
+			entries.InitializeEmpty(types);
+
+			CreateIndexScanState state;
+			InitializeScan(state, column_ids);
+			while (true) {
+				scan_chunk.Reset();
+				CreateIndexScan(state, column_ids, scan_chunk);
+				if (scan_chunk.size() == 0) {
+					break;
+				}
+				for (idx_t i = 0; i + 1 < column_ids.size(); i++) {
+					entries.data[column_ids[i]].Reference(scan_chunk.data[i]);
+				}
+				entries.SetCardinality(scan_chunk);
+				auto &row_identifiers = scan_chunk.data[column_ids.size() - 1];
+				for (auto &index : new_indexes) {
+					if (!index->Append(entries, row_identifiers)) {
+						throw InternalException("Duplicate key while loading the indexes of table \"%s\"",
+						                        info->table);
+					}
+				}
+			}
+			SwapIndexContents(*info, new_indexes);
+		}
+	} catch (...) {
+		// reset the table to its unloaded state, the data is read again on the next access
+		versions = make_shared<SegmentTree>();
+		total_rows = 0;
+		for (idx_t i = 0; i < types.size(); i++) {
+			columns[i] = make_shared<ColumnData>(*storage.buffer_manager, *info, types[i], i);
+		}
+		throw;
+	}
+	persistent_data.reset();
+	persistent_data_loaded = true;
+}
+
 DataTable::DataTable(ClientContext &context, DataTable &parent, ColumnDefinition &new_column, Expression *default_value)
-    : info(parent.info), types(parent.types), storage(parent.storage), versions(parent.versions),
-      total_rows(parent.total_rows), columns(parent.columns), is_root(true) {
+    : info(parent.info), types(parent.types), storage(parent.storage), persistent_data_loaded(true), is_root(true) {
+	// the new DataTable shares the data of the parent, which therefore has to be read first
+	parent.LoadPersistentData();
+	versions = parent.versions;
+	total_rows = parent.total_rows;
+	columns = parent.columns;
 	// prevent any new tuples from being added to the parent
 	lock_guard<mutex> parent_lock(parent.append_lock);
 	// add the new column to this DataTable
@@ -100,8 +221,12 @@ DataTable::DataTable(ClientContext &context, DataTable &parent, ColumnDefinition
 }
 
 DataTable::DataTable(ClientContext &context, DataTable &parent, idx_t removed_column)
-    : info(parent.info), types(parent.types), storage(parent.storage), versions(parent.versions),
-      total_rows(parent.total_rows), columns(parent.columns), is_root(true) {
+    : info(parent.info), types(parent.types), storage(parent.storage), persistent_data_loaded(true), is_root(true) {
+	// the new DataTable shares the data of the parent, which therefore has to be read first
+	parent.LoadPersistentData();
+	versions = parent.versions;
+	total_rows = parent.total_rows;
+	columns = parent.columns;
 	// prevent any new tuples from being added to the parent
 	lock_guard<mutex> parent_lock(parent.append_lock);
 	// first check if there are any indexes that exist that point to the removed column
@@ -125,8 +250,12 @@ DataTable::DataTable(ClientContext &context, DataTable &parent, idx_t removed_co
 
 DataTable::DataTable(ClientContext &context, DataTable &parent, idx_t changed_idx, LogicalType target_type,
                      vector<column_t> bound_columns, Expression &cast_expr)
-    : info(parent.info), types(parent.types), storage(parent.storage), versions(parent.versions),
-      total_rows(parent.total_rows), columns(parent.columns), is_root(true) {
+    : info(parent.info), types(parent.types), storage(parent.storage), persistent_data_loaded(true), is_root(true) {
+	// the new DataTable shares the data of the parent, which therefore has to be read first
+	parent.LoadPersistentData();
+	versions = parent.versions;
+	total_rows = parent.total_rows;
+	columns = parent.columns;
 
 	// prevent any new tuples from being added to the parent
 	CreateIndexScanState scan_state;
@@ -199,6 +328,7 @@ void DataTable::InitializeScan(TableScanState &state, const vector<column_t> &co
 		auto column = column_ids[i];
 		if (column != COLUMN_IDENTIFIER_ROW_ID) {
 			columns[column]->InitializeScan(state.column_scans[i]);
+			state.column_scans[i].read_ahead_row = total_rows;
 		} else {
 			state.column_scans[i].current = nullptr;
 		}
@@ -218,6 +348,7 @@ void DataTable::InitializeScan(TableScanState &state, const vector<column_t> &co
 
 void DataTable::InitializeScan(Transaction &transaction, TableScanState &state, const vector<column_t> &column_ids,
                                TableFilterSet *table_filters) {
+	LoadPersistentData();
 	InitializeScan(state, column_ids, table_filters);
 	transaction.storage.InitializeScan(this, state.local_state, table_filters);
 }
@@ -233,6 +364,8 @@ void DataTable::InitializeScanWithOffset(TableScanState &state, const vector<col
 		auto column = column_ids[i];
 		if (column != COLUMN_IDENTIFIER_ROW_ID) {
 			columns[column]->InitializeScanWithOffset(state.column_scans[i], vector_offset);
+			// only the segments of this morsel are read ahead
+			state.column_scans[i].read_ahead_row = end_row;
 		} else {
 			state.column_scans[i].current = nullptr;
 		}
@@ -241,9 +374,10 @@ void DataTable::InitializeScanWithOffset(TableScanState &state, const vector<col
 	// initialize the chunk scan state
 	state.column_count = column_ids.size();
 	state.current_row = start_row;
-	state.base_row = start_row;
 	state.max_row = end_row;
 	state.version_info = (MorselInfo *)versions->GetSegment(state.current_row);
+	// morsels do not have to start at the start of a version segment
+	state.base_row = state.version_info->start;
 	state.table_filters = table_filters;
 	if (table_filters && table_filters->filters.size() > 0) {
 		state.adaptive_filter = make_unique<AdaptiveFilter>(table_filters);
@@ -251,18 +385,26 @@ void DataTable::InitializeScanWithOffset(TableScanState &state, const vector<col
 }
 
 idx_t DataTable::MaxThreads(ClientContext &context) {
+	LoadPersistentData();
 	idx_t PARALLEL_SCAN_VECTOR_COUNT = 100;
 	if (context.force_parallelism) {
 		PARALLEL_SCAN_VECTOR_COUNT = 1;
 	}
 	idx_t PARALLEL_SCAN_TUPLE_COUNT = STANDARD_VECTOR_SIZE * PARALLEL_SCAN_VECTOR_COUNT;
 
-	return total_rows / PARALLEL_SCAN_TUPLE_COUNT + 1;
+	// transaction-local rows are scanned in morsels as well
+	auto &transaction = Transaction::GetTransaction(context);
+	idx_t scan_rows = total_rows + transaction.storage.AddedRows(this);
+	return scan_rows / PARALLEL_SCAN_TUPLE_COUNT + 1;
 }
 
-void DataTable::InitializeParallelScan(ParallelTableScanState &state) {
+void DataTable::InitializeParallelScan(ClientContext &context, ParallelTableScanState &state) {
+	LoadPersistentData();
 	state.current_row = 0;
-	state.transaction_local_data = false;
+	state.max_row = total_rows;
+	state.local_chunk_index = 0;
+	auto &transaction = Transaction::GetTransaction(context);
+	transaction.storage.InitializeScan(this, state.local_state, nullptr);
 }
 
 bool DataTable::NextParallelScan(ClientContext &context, ParallelTableScanState &state, TableScanState &scan_state,
@@ -273,26 +415,42 @@ bool DataTable::NextParallelScan(ClientContext &context, ParallelTableScanState
 	}
 	idx_t PARALLEL_SCAN_TUPLE_COUNT = STANDARD_VECTOR_SIZE * PARALLEL_SCAN_VECTOR_COUNT;
 
-	if (state.current_row < total_rows) {
-		idx_t next = MinValue(state.current_row + PARALLEL_SCAN_TUPLE_COUNT, total_rows);
+	if (scan_state.table_filters) {
+		// skip segments that the zonemaps exclude before they are handed out
+		idx_t segment_end;
+		while (state.current_row < state.max_row &&
+		       !CheckSegmentZonemaps(*scan_state.table_filters, column_ids, state.current_row, segment_end)) {
+			state.current_row = segment_end;
+		}
+	}
+	if (state.current_row < state.max_row) {
+		idx_t next = MinValue(state.current_row + PARALLEL_SCAN_TUPLE_COUNT, state.max_row);
+		if (scan_state.table_filters) {
+			// end the morsel at the start of the first segment in it that the zonemaps exclude
+			idx_t segment_start = state.current_row;
+			idx_t segment_end;
+			while (segment_start < next &&
+			       CheckSegmentZonemaps(*scan_state.table_filters, column_ids, segment_start, segment_end)) {
+				segment_start = segment_end;
+			}
+			next = MinValue(next, segment_start);
+		}
 
 		// scan a morsel from the persistent rows
 		InitializeScanWithOffset(scan_state, column_ids, scan_state.table_filters, state.current_row, next);
 
 		state.current_row = next;
 		return true;
-	} else if (!state.transaction_local_data) {
+	} else {
 		auto &transaction = Transaction::GetTransaction(context);
-		// create a task for scanning the local data
+		// scan a morsel from the transaction-local data
 		scan_state.current_row = 0;
 		scan_state.base_row = 0;
 		scan_state.max_row = 0;
-		transaction.storage.InitializeScan(this, scan_state.local_state, scan_state.table_filters);
-		state.transaction_local_data = true;
-		return true;
-	} else {
-		// finished all scans: no more scans remaining
-		return false;
+		// if there is no local data left, we have finished all scans
+		return transaction.storage.NextParallelScan(state.local_state, scan_state.local_state,
+		                                            scan_state.table_filters, state.local_chunk_index,
+		                                            PARALLEL_SCAN_VECTOR_COUNT);
 	}
 }
 
@@ -343,6 +501,28 @@ bool DataTable::CheckZonemap(TableScanState &state, TableFilterSet *table_filter
 	return true;
 }
 
+bool DataTable::CheckSegmentZonemaps(TableFilterSet &table_filters, const vector<column_t> &column_ids, idx_t row,
+                                     idx_t &segment_end) {
+	segment_end = NumericLimits<idx_t>::Maximum();
+	for (auto &table_filter : table_filters.filters) {
+		for (auto &predicate_constant : table_filter.second) {
+			auto column = column_ids[predicate_constant.column_index];
+			if (column == COLUMN_IDENTIFIER_ROW_ID) {
+				continue;
+			}
+			auto segment = (ColumnSegment *)columns[column]->data.GetSegment(row);
+			idx_t end = segment->start + segment->count;
+			if (!segment->stats.CheckZonemap(predicate_constant)) {
+				// none of the rows in this segment can pass the filter
+				segment_end = end;
+				return false;
+			}
+			segment_end = MinValue<idx_t>(segment_end, end);
+		}
+	}
+	return true;
+}
+
 bool DataTable::ScanBaseTable(Transaction &transaction, DataChunk &result, TableScanState &state,
                               const vector<column_t> &column_ids, idx_t &current_row, idx_t max_row) {
 	if (current_row >= max_row) {
@@ -438,6 +618,7 @@ bool DataTable::ScanBaseTable(Transaction &transaction, DataChunk &result, Table
 //===--------------------------------------------------------------------===//
 void DataTable::Fetch(Transaction &transaction, DataChunk &result, vector<column_t> &column_ids,
                       Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state) {
+	LoadPersistentData();
 	// first figure out which row identifiers we should use for this transaction by looking at the VersionManagers
 	row_t rows[STANDARD_VECTOR_SIZE];
 	idx_t count = FetchRows(transaction, row_identifiers, fetch_count, rows);
@@ -458,10 +639,14 @@ void DataTable::Fetch(Transaction &transaction, DataChunk &result, vector<column
 				data[i] = rows[i];
 			}
 		} else {
-			// regular column: fetch data from the base column
+			// regular column: fetch data from the base column or the transaction-local storage
 			for (idx_t i = 0; i < count; i++) {
 				auto row_id = rows[i];
-				columns[column]->FetchRow(state, transaction, row_id, result.data[col_idx], i);
+				if (row_id >= MAX_ROW_ID) {
+					transaction.storage.FetchRow(this, row_id, column, result.data[col_idx], i);
+				} else {
+					columns[column]->FetchRow(state, transaction, row_id, result.data[col_idx], i);
+				}
 			}
 		}
 	}
@@ -476,6 +661,13 @@ idx_t DataTable::FetchRows(Transaction &transaction, Vector &row_identifiers, id
 	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
 	for (idx_t i = 0; i < fetch_count; i++) {
 		auto row_id = row_ids[i];
+		if (row_id >= MAX_ROW_ID) {
+			// transaction-local row: visible to the transaction that created it, unless it deleted it again
+			if (!transaction.storage.IsDeleted(this, row_id)) {
+				result_rows[count++] = row_id;
+			}
+			continue;
+		}
 		auto segment = (MorselInfo *)versions->GetSegment(row_id);
 		bool use_row = segment->Fetch(transaction, row_id - segment->start);
 		if (use_row) {
@@ -546,6 +738,7 @@ void DataTable::VerifyAppendConstraints(TableCatalogEntry &table, DataChunk &chu
 }
 
 void DataTable::Append(TableCatalogEntry &table, ClientContext &context, DataChunk &chunk) {
+	LoadPersistentData();
 	if (chunk.size() == 0) {
 		return;
 	}
@@ -566,7 +759,21 @@ void DataTable::Append(TableCatalogEntry &table, ClientContext &context, DataChu
 	transaction.storage.Append(this, chunk);
 }
 
+void DataTable::LocalAppend(ClientContext &context, ChunkCollection &collection) {
+	LoadPersistentData();
+	if (collection.Count() == 0) {
+		return;
+	}
+	if (!is_root) {
+		throw TransactionException("Transaction conflict: adding entries to a table that has been altered!");
+	}
+	// append to the transaction local data
+	auto &transaction = Transaction::GetTransaction(context);
+	transaction.storage.Append(this, collection);
+}
+
 void DataTable::InitializeAppend(Transaction &transaction, TableAppendState &state, idx_t append_count) {
+	LoadPersistentData();
 	// obtain the append lock for this table
 	state.append_lock = std::unique_lock<mutex>(append_lock);
 	if (!is_root) {
@@ -626,6 +833,17 @@ void DataTable::Append(Transaction &transaction, DataChunk &chunk, TableAppendSt
 	state.current_row += chunk.size();
 }
 
+void DataTable::InitializeColumnAppend(TableAppendState &state, idx_t column_idx) {
+	D_ASSERT(!state.states[column_idx].lock);
+	columns[column_idx]->InitializeAppend(state.states[column_idx]);
+}
+
+void DataTable::AppendColumn(TableAppendState &state, idx_t column_idx, Vector &vector, idx_t count) {
+	D_ASSERT(is_root);
+	D_ASSERT(vector.type == types[column_idx]);
+	columns[column_idx]->Append(state.states[column_idx], vector, count);
+}
+
 void DataTable::ScanTableSegment(idx_t row_start, idx_t count, std::function<void(DataChunk &chunk)> function) {
 	idx_t end = row_start + count;
 
@@ -829,6 +1047,7 @@ void DataTable::RemoveFromIndexes(Vector &row_identifiers, idx_t count) {
 // Delete
 //===--------------------------------------------------------------------===//
 void DataTable::Delete(TableCatalogEntry &table, ClientContext &context, Vector &row_identifiers, idx_t count) {
+	LoadPersistentData();
 	D_ASSERT(row_identifiers.type.InternalType() == ROW_TYPE);
 	if (count == 0) {
 		return;
@@ -928,6 +1147,7 @@ void DataTable::VerifyUpdateConstraints(TableCatalogEntry &table, DataChunk &chu
 
 void DataTable::Update(TableCatalogEntry &table, ClientContext &context, Vector &row_ids, vector<column_t> &column_ids,
                        DataChunk &updates) {
+	LoadPersistentData();
 	D_ASSERT(row_ids.type.InternalType() == ROW_TYPE);
 
 	updates.Verify();
@@ -962,6 +1182,7 @@ void DataTable::Update(TableCatalogEntry &table, ClientContext &context, Vector
 // Create Index Scan
 //===--------------------------------------------------------------------===//
 void DataTable::InitializeCreateIndexScan(CreateIndexScanState &state, const vector<column_t> &column_ids) {
+	LoadPersistentData();
 	// we grab the append lock to make sure nothing is appended until AFTER we finish the index scan
 	state.append_lock = std::unique_lock<mutex>(append_lock);
 	state.delete_lock = std::unique_lock<mutex>(versions->node_lock);
@@ -1004,6 +1225,14 @@ bool DataTable::ScanCreateIndex(CreateIndexScanState &state, const vector<column
 }
 
 void DataTable::AddIndex(unique_ptr<Index> index, vector<unique_ptr<Expression>> &expressions) {
+	if (!persistent_data_loaded) {
+		lock_guard<mutex> lock(load_lock);
+		if (!persistent_data_loaded) {
+			// the index is filled when the persistent data of the table is read
+			info->indexes.push_back(move(index));
+			return;
+		}
+	}
 	DataChunk result;
 	result.Initialize(index->logical_types);
 
@@ -1049,7 +1278,32 @@ void DataTable::AddIndex(unique_ptr<Index> index, vector<unique_ptr<Expression>>
 	info->indexes.push_back(move(index));
 }
 
+//===--------------------------------------------------------------------===//
+// Vacuum
+//===--------------------------------------------------------------------===//
+idx_t DataTable::CountDeletedRows(Transaction &transaction) {
+	vector<column_t> column_ids{COLUMN_IDENTIFIER_ROW_ID};
+	vector<LogicalType> scan_types{LOGICAL_ROW_TYPE};
+	DataChunk chunk;
+	chunk.Initialize(scan_types);
+
+	TableScanState state;
+	InitializeScan(transaction, state, column_ids);
+	idx_t visible_rows = 0;
+	while (true) {
+		chunk.Reset();
+		Scan(transaction, chunk, state, column_ids);
+		if (chunk.size() == 0) {
+			break;
+		}
+		visible_rows += chunk.size();
+	}
+	D_ASSERT(visible_rows <= total_rows);
+	return total_rows - visible_rows;
+}
+
 unique_ptr<BaseStatistics> DataTable::GetStatistics(ClientContext &context, column_t column_id) {
+	LoadPersistentData();
 	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
 		return nullptr;
 	}
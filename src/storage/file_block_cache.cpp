@@ -0,0 +1,295 @@
+#include "duckdb/storage/file_block_cache.hpp"
+
+#include "duckdb/common/checksum.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/common/to_string.hpp"
+
+#include <cstring>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+FileBlockCache::FileBlockCache()
+    : hits(0), misses(0), memory_limit(0), memory_usage(0), next_generation(0), spill_id(0) {
+	// the spill files of different processes (and databases) can end up in the same directory
+	RandomEngine random(-1);
+#ifdef _WIN32
+	auto pid = _getpid();
+#else
+	auto pid = getpid();
+#endif
+	spill_prefix = "block_cache_" + to_string(pid) + "_" + to_string(random.NextRandomInteger()) + "_";
+}
+
+FileBlockCache::~FileBlockCache() {
+	ClearInternal();
+}
+
+static string CacheBlockKey(const string &path, idx_t generation, idx_t block_start) {
+	string key = path;
+	key += '\0';
+	key += to_string(generation);
+	key += '\0';
+	key += to_string(block_start);
+	return key;
+}
+
+void FileBlockCache::Read(FileSystem &fs, FileHandle &handle, void *buffer, idx_t nr_bytes, idx_t location) {
+	if (!IsEnabled()) {
+		fs.Read(handle, buffer, nr_bytes, location);
+		return;
+	}
+	auto last_modified = fs.GetLastModifiedTime(handle);
+	auto file_size = fs.GetFileSize(handle);
+	if (file_size < 0 || location + nr_bytes > (idx_t)file_size) {
+		// let the file system report the failed read
+		fs.Read(handle, buffer, nr_bytes, location);
+		return;
+	}
+	idx_t generation;
+	{
+		lock_guard<mutex> guard(lock);
+		generation = GetGeneration(handle.path, last_modified, file_size);
+	}
+	auto result = (data_ptr_t)buffer;
+	idx_t end = location + nr_bytes;
+	for (idx_t block_start = location - location % CACHE_BLOCK_SIZE; block_start < end;
+	     block_start += CACHE_BLOCK_SIZE) {
+		// the part of the block that is read
+		idx_t read_start = MaxValue<idx_t>(block_start, location);
+		idx_t read_end = MinValue<idx_t>(block_start + CACHE_BLOCK_SIZE, end);
+		auto target = result + (read_start - location);
+		auto key = CacheBlockKey(handle.path, generation, block_start);
+		SpilledBlock spilled;
+		bool is_spilled = false;
+		{
+			lock_guard<mutex> guard(lock);
+			if (ReadCachedBlock(key, read_start - block_start, target, read_end - read_start)) {
+				hits++;
+				continue;
+			}
+			auto spilled_entry = spilled_blocks.find(key);
+			if (spilled_entry != spilled_blocks.end()) {
+				// the block is read back from the spill directory below
+				spilled = move(spilled_entry->second);
+				spilled_blocks.erase(spilled_entry);
+				is_spilled = true;
+			}
+		}
+		// read the block from the spill directory or from the file without holding the lock
+		idx_t size = MinValue<idx_t>(CACHE_BLOCK_SIZE, file_size - block_start);
+		unique_ptr<data_t[]> data;
+		if (is_spilled) {
+			data = ReadSpilledBlock(spilled);
+		}
+		if (data) {
+			hits++;
+		} else {
+			misses++;
+			data = unique_ptr<data_t[]>(new data_t[size]);
+			fs.Read(handle, data.get(), size, block_start);
+		}
+		memcpy(target, data.get() + (read_start - block_start), read_end - read_start);
+
+		vector<CacheBlock> evicted;
+		string directory;
+		{
+			lock_guard<mutex> guard(lock);
+			if (block_map.find(key) == block_map.end()) {
+				AddBlock(move(key), move(data), size, evicted);
+			}
+			directory = spill_directory;
+		}
+		SpillBlocks(directory, evicted);
+	}
+}
+
+idx_t FileBlockCache::GetGeneration(const string &path, time_t last_modified, int64_t file_size) {
+	auto entry = files.find(path);
+	if (entry != files.end() && entry->second.last_modified == last_modified &&
+	    entry->second.file_size == file_size) {
+		return entry->second.generation;
+	}
+	// the file is new or it was changed: the blocks of the previous generation are no longer read
+	CachedFile file;
+	file.generation = next_generation++;
+	file.last_modified = last_modified;
+	file.file_size = file_size;
+	files[path] = file;
+	return file.generation;
+}
+
+void FileBlockCache::Invalidate(const string &path) {
+	lock_guard<mutex> guard(lock);
+	auto entry = files.find(path);
+	if (entry == files.end()) {
+		return;
+	}
+	auto key_prefix = CacheBlockKey(path, entry->second.generation, 0);
+	key_prefix.resize(key_prefix.size() - 1);
+	files.erase(entry);
+	// remove the blocks of the file, the next read starts a new generation
+	for (auto it = blocks.begin(); it != blocks.end();) {
+		if (it->key.compare(0, key_prefix.size(), key_prefix) == 0) {
+			memory_usage -= it->size;
+			block_map.erase(it->key);
+			it = blocks.erase(it);
+		} else {
+			it++;
+		}
+	}
+	for (auto it = spilled_blocks.begin(); it != spilled_blocks.end();) {
+		if (it->first.compare(0, key_prefix.size(), key_prefix) == 0) {
+			if (spill_fs.FileExists(it->second.path)) {
+				spill_fs.RemoveFile(it->second.path);
+			}
+			it = spilled_blocks.erase(it);
+		} else {
+			it++;
+		}
+	}
+}
+
+bool FileBlockCache::ReadCachedBlock(const string &key, idx_t block_offset, data_ptr_t target, idx_t count) {
+	auto entry = block_map.find(key);
+	if (entry == block_map.end()) {
+		return false;
+	}
+	memcpy(target, entry->second->data.get() + block_offset, count);
+	// move the block to the front of the LRU list
+	blocks.splice(blocks.begin(), blocks, entry->second);
+	return true;
+}
+
+unique_ptr<data_t[]> FileBlockCache::ReadSpilledBlock(const SpilledBlock &spilled) {
+	if (!spill_fs.FileExists(spilled.path)) {
+		return nullptr;
+	}
+	auto data = unique_ptr<data_t[]>(new data_t[spilled.size]);
+	{
+		auto handle = spill_fs.OpenFile(spilled.path.c_str(), FileFlags::FILE_FLAGS_READ);
+		if (spill_fs.GetFileSize(*handle) != (int64_t)spilled.size) {
+			data.reset();
+		} else {
+			handle->Read(data.get(), spilled.size, 0);
+		}
+	}
+	spill_fs.RemoveFile(spilled.path);
+	if (data && Checksum(data.get(), spilled.size) != spilled.checksum) {
+		// the spill file was modified: the block is read from the file again
+		data.reset();
+	}
+	return data;
+}
+
+void FileBlockCache::AddBlock(string key, unique_ptr<data_t[]> data, idx_t size, vector<CacheBlock> &evicted) {
+	CacheBlock block;
+	block.key = key;
+	block.size = size;
+	block.data = move(data);
+	blocks.push_front(move(block));
+	block_map[move(key)] = blocks.begin();
+	memory_usage += size;
+	EvictBlocks(evicted);
+}
+
+void FileBlockCache::EvictBlocks(vector<CacheBlock> &evicted) {
+	while (memory_usage > memory_limit && !blocks.empty()) {
+		auto &block = blocks.back();
+		memory_usage -= block.size;
+		block_map.erase(block.key);
+		if (!spill_directory.empty()) {
+			// the block is written to the spill directory after the lock is released
+			evicted.push_back(move(block));
+		}
+		blocks.pop_back();
+	}
+}
+
+void FileBlockCache::SpillBlocks(const string &directory, vector<CacheBlock> &evicted) {
+	for (auto &block : evicted) {
+		SpilledBlock spilled;
+		spilled.path = spill_fs.JoinPath(directory, spill_prefix + to_string(spill_id++) + ".block");
+		spilled.size = block.size;
+		spilled.checksum = Checksum(block.data.get(), block.size);
+		{
+			auto handle = spill_fs.OpenFile(spilled.path, FileFlags::FILE_FLAGS_WRITE |
+			                                                   FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+			handle->Write(block.data.get(), block.size, 0);
+		}
+		lock_guard<mutex> guard(lock);
+		if (spill_directory != directory || block_map.find(block.key) != block_map.end() ||
+		    spilled_blocks.find(block.key) != spilled_blocks.end()) {
+			// the spill directory was changed or the block was read again in the meantime
+			spill_fs.RemoveFile(spilled.path);
+			continue;
+		}
+		spilled_blocks[block.key] = move(spilled);
+	}
+	evicted.clear();
+}
+
+void FileBlockCache::SetLimit(idx_t limit) {
+	vector<CacheBlock> evicted;
+	string directory;
+	{
+		lock_guard<mutex> guard(lock);
+		memory_limit = limit;
+		if (limit == 0) {
+			ClearInternal();
+		} else {
+			EvictBlocks(evicted);
+		}
+		directory = spill_directory;
+	}
+	SpillBlocks(directory, evicted);
+}
+
+void FileBlockCache::SetSpillDirectory(const string &directory) {
+	lock_guard<mutex> guard(lock);
+	if (!directory.empty()) {
+		spill_fs.CreateDirectory(directory);
+	}
+	// blocks spilled to the previous directory are no longer used
+	RemoveSpilledBlocks();
+	spill_directory = directory;
+}
+
+void FileBlockCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	ClearInternal();
+}
+
+void FileBlockCache::ClearInternal() {
+	blocks.clear();
+	block_map.clear();
+	files.clear();
+	memory_usage = 0;
+	RemoveSpilledBlocks();
+}
+
+void FileBlockCache::RemoveSpilledBlocks() {
+	for (auto &entry : spilled_blocks) {
+		if (spill_fs.FileExists(entry.second.path)) {
+			spill_fs.RemoveFile(entry.second.path);
+		}
+	}
+	spilled_blocks.clear();
+}
+
+idx_t FileBlockCache::MemoryUsage() {
+	lock_guard<mutex> guard(lock);
+	return memory_usage;
+}
+
+idx_t FileBlockCache::SpilledBlocks() {
+	lock_guard<mutex> guard(lock);
+	return spilled_blocks.size();
+}
+
+} // namespace duckdb
@@ -7,10 +7,16 @@
 #include "duckdb/storage/table/morsel_info.hpp"
 #include "duckdb/transaction/transaction.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 
-LocalTableStorage::LocalTableStorage(DataTable &table) : table(table) {
+LocalTableStorage::LocalTableStorage(DataTable &table) : table(table), active_scans(0) {
 	Clear();
 }
 
@@ -18,16 +24,25 @@ LocalTableStorage::~LocalTableStorage() {
 }
 
 void LocalTableStorage::InitializeScan(LocalScanState &state, TableFilterSet *table_filters) {
-	if (collection.ChunkCount() == 0) {
+	InitializeScanWithOffset(state, table_filters, 0, NumericLimits<idx_t>::Maximum());
+}
+
+bool LocalTableStorage::InitializeScanWithOffset(LocalScanState &state, TableFilterSet *table_filters,
+                                                 idx_t start_chunk, idx_t end_chunk) {
+	lock_guard<mutex> lock(collection_lock);
+	end_chunk = MinValue<idx_t>(end_chunk, collection.ChunkCount());
+	if (start_chunk >= end_chunk) {
 		// nothing to scan
-		return;
+		state.SetStorage(nullptr);
+		return false;
 	}
 	state.SetStorage(this);
 
-	state.chunk_index = 0;
-	state.max_index = collection.ChunkCount() - 1;
-	state.last_chunk_count = collection.Chunks().back()->size();
+	state.chunk_index = start_chunk;
+	state.max_index = end_chunk - 1;
+	state.last_chunk_count = collection.GetChunk(state.max_index).size();
 	state.table_filters = table_filters;
+	return true;
 }
 
 LocalScanState::~LocalScanState() {
@@ -75,6 +90,27 @@ void LocalStorage::InitializeScan(DataTable *table, LocalScanState &state, Table
 	storage->InitializeScan(state, table_filters);
 }
 
+bool LocalStorage::NextParallelScan(LocalScanState &parallel_state, LocalScanState &state,
+                                    TableFilterSet *table_filters, idx_t &chunk_index, idx_t chunk_count) {
+	auto storage = parallel_state.GetStorage();
+	if (!storage || chunk_index > parallel_state.max_index) {
+		// no local data left to hand out
+		state.SetStorage(nullptr);
+		return false;
+	}
+	idx_t start_chunk = chunk_index;
+	idx_t end_chunk = MinValue<idx_t>(start_chunk + chunk_count, parallel_state.max_index + 1);
+	chunk_index = end_chunk;
+	if (!storage->InitializeScanWithOffset(state, table_filters, start_chunk, end_chunk)) {
+		return false;
+	}
+	if (state.max_index == parallel_state.max_index) {
+		// only scan the rows of the last chunk that were present when the parallel scan was initialized
+		state.last_chunk_count = parallel_state.last_chunk_count;
+	}
+	return true;
+}
+
 void LocalStorage::Scan(LocalScanState &state, const vector<column_t> &column_ids, DataChunk &result) {
 	auto storage = state.GetStorage();
 	if (!storage || state.chunk_index > state.max_index) {
@@ -82,6 +118,8 @@ void LocalStorage::Scan(LocalScanState &state, const vector<column_t> &column_id
 		result.Reset();
 		return;
 	}
+	// the last chunk can be appended to while we scan it: only look at it while holding the lock
+	std::unique_lock<mutex> lock(storage->collection_lock);
 	auto &chunk = storage->collection.GetChunk(state.chunk_index);
 	idx_t chunk_count = state.chunk_index == state.max_index ? state.last_chunk_count : chunk.size();
 	idx_t count = chunk_count;
@@ -100,6 +138,7 @@ void LocalStorage::Scan(LocalScanState &state, const vector<column_t> &column_id
 		}
 		if (new_count == 0 && count > 0) {
 			// all entries in this chunk were deleted: continue to next chunk
+			lock.unlock();
 			state.chunk_index++;
 			Scan(state, column_ids, result);
 			return;
@@ -136,6 +175,7 @@ void LocalStorage::Scan(LocalScanState &state, const vector<column_t> &column_id
 			}
 		}
 	}
+	lock.unlock();
 	if (count == 0) {
 		// all entries in this chunk were filtered:: Continue on next chunk
 		state.chunk_index++;
@@ -150,16 +190,19 @@ void LocalStorage::Scan(LocalScanState &state, const vector<column_t> &column_id
 	state.chunk_index++;
 }
 
-void LocalStorage::Append(DataTable *table, DataChunk &chunk) {
+LocalTableStorage *LocalStorage::GetOrCreateStorage(DataTable *table) {
 	auto entry = table_storage.find(table);
-	LocalTableStorage *storage;
-	if (entry == table_storage.end()) {
-		auto new_storage = make_unique<LocalTableStorage>(*table);
-		storage = new_storage.get();
-		table_storage.insert(make_pair(table, move(new_storage)));
-	} else {
-		storage = entry->second.get();
+	if (entry != table_storage.end()) {
+		return entry->second.get();
 	}
+	auto new_storage = make_unique<LocalTableStorage>(*table);
+	auto storage = new_storage.get();
+	table_storage.insert(make_pair(table, move(new_storage)));
+	return storage;
+}
+
+void LocalStorage::Append(DataTable *table, DataChunk &chunk) {
+	auto storage = GetOrCreateStorage(table);
 	// append to unique indices (if any)
 	if (storage->indexes.size() > 0) {
 		idx_t base_id = MAX_ROW_ID + storage->collection.Count();
@@ -176,19 +219,67 @@ void LocalStorage::Append(DataTable *table, DataChunk &chunk) {
 		}
 	}
 	//! Append to the chunk
-	storage->collection.Append(chunk);
+	{
+		lock_guard<mutex> lock(storage->collection_lock);
+		storage->collection.Append(chunk);
+	}
 	if (storage->active_scans == 0 && storage->collection.Count() >= MorselInfo::MORSEL_SIZE) {
 		// flush to base storage
 		Flush(*table, *storage);
 	}
 }
 
+void LocalStorage::Append(DataTable *table, ChunkCollection &collection) {
+	auto storage = GetOrCreateStorage(table);
+	auto &local = storage->collection;
+	// merging moves a partially filled last chunk: only allowed if no scans, deletes or index entries refer to it
+	bool can_merge = storage->indexes.empty() && storage->active_scans == 0;
+	if (can_merge && local.ChunkCount() > 0) {
+		idx_t last_chunk = local.ChunkCount() - 1;
+		can_merge = local.GetChunk(last_chunk).size() == STANDARD_VECTOR_SIZE ||
+		            storage->deleted_entries.find(last_chunk) == storage->deleted_entries.end();
+	}
+	if (!can_merge) {
+		for (auto &chunk : collection.Chunks()) {
+			Append(table, *chunk);
+		}
+		collection.Reset();
+		return;
+	}
+	// move the chunks into the local storage
+	local.Merge(collection);
+	collection.Reset();
+	if (local.Count() >= MorselInfo::MORSEL_SIZE) {
+		// flush to base storage
+		Flush(*table, *storage);
+	}
+}
+
 LocalTableStorage *LocalStorage::GetStorage(DataTable *table) {
 	auto entry = table_storage.find(table);
 	D_ASSERT(entry != table_storage.end());
 	return entry->second.get();
 }
 
+void LocalStorage::FetchRow(DataTable *table, row_t row_id, column_t column_id, Vector &result, idx_t result_idx) {
+	auto storage = GetStorage(table);
+	idx_t local_row = row_id - MAX_ROW_ID;
+	lock_guard<mutex> lock(storage->collection_lock);
+	auto &chunk = storage->collection.GetChunk(local_row / STANDARD_VECTOR_SIZE);
+	result.SetValue(result_idx, chunk.GetValue(column_id, local_row % STANDARD_VECTOR_SIZE));
+}
+
+bool LocalStorage::IsDeleted(DataTable *table, row_t row_id) {
+	auto storage = GetStorage(table);
+	idx_t local_row = row_id - MAX_ROW_ID;
+	lock_guard<mutex> lock(storage->collection_lock);
+	auto entry = storage->deleted_entries.find(local_row / STANDARD_VECTOR_SIZE);
+	if (entry == storage->deleted_entries.end()) {
+		return false;
+	}
+	return entry->second[local_row % STANDARD_VECTOR_SIZE];
+}
+
 static idx_t GetChunk(Vector &row_ids) {
 	auto ids = FlatVector::GetData<row_t>(row_ids);
 	auto first_id = ids[0] - MAX_ROW_ID;
@@ -203,6 +294,7 @@ void LocalStorage::Delete(DataTable *table, Vector &row_ids, idx_t count) {
 	D_ASSERT(chunk_idx < storage->collection.ChunkCount());
 
 	// get a pointer to the deleted entries for this chunk
+	lock_guard<mutex> lock(storage->collection_lock);
 	bool *deleted;
 	auto entry = storage->deleted_entries.find(chunk_idx);
 	if (entry == storage->deleted_entries.end()) {
@@ -282,6 +374,7 @@ void LocalStorage::Update(DataTable *table, Vector &row_ids, vector<column_t> &c
 	idx_t base_index = MAX_ROW_ID + chunk_idx * STANDARD_VECTOR_SIZE;
 
 	// now perform the actual update
+	lock_guard<mutex> lock(storage->collection_lock);
 	auto &chunk = storage->collection.GetChunk(chunk_idx);
 	for (idx_t i = 0; i < column_ids.size(); i++) {
 		auto col_idx = column_ids[i];
@@ -313,6 +406,64 @@ template <class T> bool LocalStorage::ScanTableStorage(DataTable &table, LocalTa
 	}
 }
 
+//! The state shared by the tasks that append the columns of the transaction-local data to the base table
+struct LocalStorageAppendState {
+	LocalStorageAppendState(LocalStorage &local_storage, DataTable &table, LocalTableStorage &storage,
+	                        TableAppendState &append_state)
+	    : local_storage(local_storage), table(table), storage(storage), append_state(append_state),
+	      finished_tasks(0) {
+	}
+
+	LocalStorage &local_storage;
+	DataTable &table;
+	LocalTableStorage &storage;
+	TableAppendState &append_state;
+	mutex lock;
+	//! Signaled when a task is finished
+	std::condition_variable task_finished;
+	idx_t finished_tasks;
+	string error;
+};
+
+//! Appends a single column of the transaction-local data to the base table
+class LocalStorageAppendTask : public Task {
+public:
+	LocalStorageAppendTask(LocalStorageAppendState &state, idx_t column_idx) : state(state), column_idx(column_idx) {
+	}
+
+	void Execute() override {
+		try {
+			// the segment lock of the column is held by the thread that appends to it
+			state.table.InitializeColumnAppend(state.append_state, column_idx);
+			vector<column_t> column_ids {column_idx};
+			vector<LogicalType> types {state.table.types[column_idx]};
+			DataChunk chunk;
+			chunk.Initialize(types);
+			LocalScanState scan_state;
+			state.storage.InitializeScan(scan_state);
+			while (true) {
+				state.local_storage.Scan(scan_state, column_ids, chunk);
+				if (chunk.size() == 0) {
+					break;
+				}
+				state.table.AppendColumn(state.append_state, column_idx, chunk.data[0], chunk.size());
+			}
+		} catch (std::exception &ex) {
+			lock_guard<mutex> guard(state.lock);
+			state.error = ex.what();
+		}
+		state.append_state.states[column_idx].lock.reset();
+		// notify while holding the lock: the state is destroyed as soon as the waiting thread sees the last task finish
+		lock_guard<mutex> guard(state.lock);
+		state.finished_tasks++;
+		state.task_finished.notify_one();
+	}
+
+private:
+	LocalStorageAppendState &state;
+	column_t column_idx;
+};
+
 void LocalStorage::Flush(DataTable &table, LocalTableStorage &storage) {
 	if (storage.collection.Count() <= storage.deleted_rows) {
 		return;
@@ -321,36 +472,70 @@ void LocalStorage::Flush(DataTable &table, LocalTableStorage &storage) {
 	TableAppendState append_state;
 	table.InitializeAppend(transaction, append_state, append_count);
 
+	// append the rows to the indexes of the table (if any)
 	bool constraint_violated = false;
-	ScanTableStorage(table, storage, [&](DataChunk &chunk) -> bool {
-		// append this chunk to the indexes of the table
-		if (!table.AppendToIndexes(append_state, chunk, append_state.current_row)) {
-			constraint_violated = true;
-			return false;
+	row_t index_row = append_state.row_start;
+	if (!table.info->indexes.empty()) {
+		ScanTableStorage(table, storage, [&](DataChunk &chunk) -> bool {
+			if (!table.AppendToIndexes(append_state, chunk, index_row)) {
+				constraint_violated = true;
+				return false;
+			}
+			index_row += chunk.size();
+			return true;
+		});
+	}
+
+	// append to the base table: the columns are independent, so large appends are split into one task per column
+	// that are executed in parallel by the task scheduler
+	LocalStorageAppendState state(*this, table, storage, append_state);
+	if (!constraint_violated) {
+		vector<unique_ptr<Task>> tasks;
+		for (idx_t i = 0; i < table.types.size(); i++) {
+			append_state.states[i].lock.reset();
+			tasks.push_back(make_unique<LocalStorageAppendTask>(state, i));
+		}
+		auto &scheduler = TaskScheduler::GetScheduler(table.storage.GetDatabase());
+		if (tasks.size() > 1 && append_count >= MorselInfo::MORSEL_SIZE && scheduler.NumberOfThreads() > 1) {
+			// schedule the tasks, help executing them and wait for the tasks that are executed by other threads
+			auto producer = scheduler.CreateProducer();
+			for (auto &task : tasks) {
+				scheduler.ScheduleTask(*producer, move(task));
+			}
+			unique_ptr<Task> task;
+			while (scheduler.GetTaskFromProducer(*producer, task)) {
+				task->Execute();
+				task.reset();
+			}
+			std::unique_lock<mutex> guard(state.lock);
+			state.task_finished.wait(guard, [&] { return state.finished_tasks == table.types.size(); });
+		} else {
+			for (auto &task : tasks) {
+				task->Execute();
+			}
 		}
-		// append to base table
-		table.Append(transaction, chunk, append_state);
-		return true;
-	});
-	if (constraint_violated) {
+	}
+	if (constraint_violated || !state.error.empty()) {
 		// need to revert the append
 		row_t current_row = append_state.row_start;
 		// remove the data from the indexes, if there are any indexes
 		ScanTableStorage(table, storage, [&](DataChunk &chunk) -> bool {
-			// append this chunk to the indexes of the table
-			table.RemoveFromIndexes(append_state, chunk, current_row);
-
-			current_row += chunk.size();
-			if (current_row >= append_state.current_row) {
+			if (current_row >= index_row) {
 				// finished deleting all rows from the index: abort now
 				return false;
 			}
+			table.RemoveFromIndexes(append_state, chunk, current_row);
+			current_row += chunk.size();
 			return true;
 		});
 		table.RevertAppendInternal(append_state.row_start, append_count);
 		storage.Clear();
-		throw ConstraintException("PRIMARY KEY or UNIQUE constraint violated: duplicated key");
+		if (constraint_violated) {
+			throw ConstraintException("PRIMARY KEY or UNIQUE constraint violated: duplicated key");
+		}
+		throw Exception(state.error);
 	}
+	append_state.current_row += append_count;
 	storage.Clear();
 	transaction.PushAppend(&table, append_state.row_start, append_count);
 }
@@ -408,7 +408,7 @@ void NumericSegment::FetchRow(ColumnFetchState &state, Transaction &transaction,
 
 	FlatVector::SetNull(result, result_idx, nullmask[id_in_vector]);
 	memcpy(FlatVector::GetData(result) + result_idx * type_size, vector_ptr + id_in_vector * type_size, type_size);
-	if (versions && versions[vector_index]) {
+	if (HasUpdatesForTransaction(transaction, vector_index)) {
 		// version information: follow the version chain to find out if we need to load this tuple data from any other
 		// version
 		append_from_update_info(transaction, versions[vector_index], id_in_vector, result, result_idx);
@@ -787,17 +787,11 @@ static void update_info_append(Transaction &transaction, UpdateInfo *info, idx_t
 	auto &result_mask = FlatVector::Nullmask(result);
 	UpdateInfo::UpdatesForTransaction(info, transaction, [&](UpdateInfo *current) {
 		auto info_data = (T *)current->tuple_data;
-		// loop over the tuples in this UpdateInfo
-		for (idx_t i = 0; i < current->N; i++) {
-			if (current->tuples[i] == row_id) {
-				// found the relevant tuple
-				result_data[result_idx] = info_data[i];
-				result_mask[result_idx] = current->nullmask[current->tuples[i]];
-				break;
-			} else if (current->tuples[i] > row_id) {
-				// tuples are sorted: so if the current tuple is > row_id we will not find it anymore
-				break;
-			}
+		auto tuple_idx = current->FindTuple(row_id);
+		if (tuple_idx != INVALID_INDEX) {
+			// found the relevant tuple
+			result_data[result_idx] = info_data[tuple_idx];
+			result_mask[result_idx] = current->nullmask[row_id];
 		}
 	});
 }
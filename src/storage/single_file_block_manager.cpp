@@ -64,9 +64,9 @@ template <class T> T DeserializeHeaderStructure(data_ptr_t ptr) {
 }
 
 SingleFileBlockManager::SingleFileBlockManager(FileSystem &fs, string path, bool read_only, bool create_new,
-                                               bool use_direct_io)
+                                               bool use_direct_io, bool use_mmap)
     : path(path), header_buffer(FileBufferType::MANAGED_BUFFER, Storage::FILE_HEADER_SIZE), read_only(read_only),
-      use_direct_io(use_direct_io) {
+      use_direct_io(use_direct_io), mapping(nullptr), mapping_size(0) {
 
 	uint8_t flags;
 	FileLockType lock;
@@ -157,6 +157,21 @@ SingleFileBlockManager::SingleFileBlockManager(FileSystem &fs, string path, bool
 			active_header = 1;
 			Initialize(h2);
 		}
+		if (read_only && use_mmap && !use_direct_io) {
+			// the file does not change while it is opened in read-only mode: the blocks can be used directly from a
+			// memory mapping of the file, if the file system supports it
+			auto file_size = fs.GetFileSize(*handle);
+			if (file_size > 0) {
+				mapping = fs.MapFile(*handle, file_size);
+				mapping_size = mapping ? file_size : 0;
+			}
+		}
+	}
+}
+
+SingleFileBlockManager::~SingleFileBlockManager() {
+	if (mapping) {
+		handle->file_system.UnmapFile(mapping, mapping_size);
 	}
 }
 
@@ -218,6 +233,15 @@ void SingleFileBlockManager::Read(Block &block) {
 	block.Read(*handle, BLOCK_START + block.id * Storage::BLOCK_ALLOC_SIZE);
 }
 
+data_ptr_t SingleFileBlockManager::GetMappedBlock(block_id_t block_id) {
+	D_ASSERT(block_id >= 0);
+	idx_t location = BLOCK_START + block_id * Storage::BLOCK_ALLOC_SIZE;
+	if (!mapping || location + Storage::BLOCK_ALLOC_SIZE > mapping_size) {
+		return nullptr;
+	}
+	return mapping + location;
+}
+
 void SingleFileBlockManager::Write(FileBuffer &buffer, block_id_t block_id) {
 	D_ASSERT(block_id >= 0);
 	buffer.Write(*handle, BLOCK_START + block_id * Storage::BLOCK_ALLOC_SIZE);
@@ -226,10 +250,17 @@ void SingleFileBlockManager::Write(FileBuffer &buffer, block_id_t block_id) {
 void SingleFileBlockManager::WriteHeader(DatabaseHeader header) {
 	// set the iteration count
 	header.iteration = ++iteration_count;
-	header.block_count = max_block;
+	// the blocks after the last block used by this checkpoint are cut off from the file once the header is written
+	block_id_t block_count = 0;
+	for (auto &block_id : used_blocks) {
+		block_count = MaxValue<block_id_t>(block_count, block_id + 1);
+	}
+	header.block_count = block_count;
 	// now handle the free list
+	// the free list is stored in descending order, so the blocks at the start of the file are given away first and the
+	// blocks at the end of the file can be truncated by the next checkpoint
 	free_list.clear();
-	for (block_id_t i = 0; i < max_block; i++) {
+	for (block_id_t i = block_count - 1; i >= 0; i--) {
 		if (used_blocks.find(i) == used_blocks.end()) {
 			free_list.push_back(i);
 		}
@@ -268,6 +299,11 @@ void SingleFileBlockManager::WriteHeader(DatabaseHeader header) {
 	active_header = 1 - active_header;
 	//! Ensure the header write ends up on disk
 	handle->Sync();
+	if (block_count < max_block) {
+		// the new header no longer refers to the blocks at the end of the file: truncate them
+		handle->Truncate(BLOCK_START + block_count * Storage::BLOCK_ALLOC_SIZE);
+		max_block = block_count;
+	}
 
 	// the free list is now equal to the blocks that were used by the previous iteration
 	free_list.clear();
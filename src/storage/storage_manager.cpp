@@ -80,12 +80,14 @@ void StorageManager::Checkpoint(string wal_path) {
 		return;
 	}
 	// check the size of the WAL
+	bool wal_too_small;
 	{
 		BufferedFileReader reader(fs, wal_path.c_str());
-		if (reader.FileSize() <= database.config.checkpoint_wal_size) {
-			// WAL is too small
-			return;
-		}
+		wal_too_small = reader.FileSize() <= database.config.checkpoint_wal_size;
+	}
+	if (wal_too_small && !WriteAheadLog::CheckpointRequested(database, wal_path)) {
+		// WAL is too small, and no checkpoint was requested (e.g. by VACUUM)
+		return;
 	}
 
 	// checkpoint the database
@@ -121,7 +123,8 @@ void StorageManager::LoadDatabase() {
 			Checkpoint(wal_path);
 		}
 		// initialize the block manager while loading the current db file
-		auto sf = make_unique<SingleFileBlockManager>(fs, path, read_only, false, config.use_direct_io);
+		auto sf = make_unique<SingleFileBlockManager>(fs, path, read_only, false, config.use_direct_io,
+		                                             config.use_mmap);
 		buffer_manager = make_unique<BufferManager>(fs, *sf, config.temporary_directory, config.maximum_memory);
 		sf->LoadFreeList(*buffer_manager);
 		block_manager = move(sf);
@@ -7,6 +7,7 @@
 #include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/storage/statistics/string_statistics.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/hash.hpp"
 
 namespace duckdb {
 
@@ -73,6 +74,7 @@ void StringSegment::ExpandStringSegment(data_ptr_t baseptr) {
 void StringSegment::InitializeScan(ColumnScanState &state) {
 	// pin the primary buffer
 	state.primary_handle = manager.Pin(block);
+	state.scan_dictionary = true;
 }
 
 //===--------------------------------------------------------------------===//
@@ -211,6 +213,64 @@ void StringSegment::FetchBaseData(ColumnScanState &state, data_ptr_t baseptr, id
 	FlatVector::SetNullmask(result, base_nullmask);
 }
 
+void StringSegment::ScanBaseData(ColumnScanState &state, idx_t vector_index, Vector &result) {
+	if (!state.scan_dictionary || (string_updates && string_updates[vector_index])) {
+		FetchBaseData(state, vector_index, result);
+		return;
+	}
+	auto handle = state.primary_handle.get();
+	auto baseptr = handle->node->buffer;
+	auto base = baseptr + vector_index * vector_size;
+
+	auto &base_nullmask = *((nullmask_t *)base);
+	auto base_data = (int32_t *)(base + sizeof(nullmask_t));
+	idx_t count = GetVectorCount(vector_index);
+
+	// find the distinct dictionary offsets of this vector using a small linear probing hash table
+	// the table is at least twice as big as the maximum amount of distinct entries, so the probing always terminates
+	idx_t max_entries = count / DICTIONARY_SCAN_RATIO;
+	idx_t table_mask = NextPowerOfTwo(MaxValue<idx_t>(count, 1)) - 1;
+	int32_t table_offsets[STANDARD_VECTOR_SIZE];
+	sel_t table_entries[STANDARD_VECTOR_SIZE];
+	std::fill_n(table_offsets, table_mask + 1, -1);
+
+	int32_t entry_offsets[STANDARD_VECTOR_SIZE];
+	idx_t entry_count = 0;
+	SelectionVector sel(count);
+	for (idx_t i = 0; i < count; i++) {
+		int32_t dict_offset = base_nullmask[i] ? 0 : base_data[i];
+		idx_t slot = duckdb::Hash<int32_t>(dict_offset) & table_mask;
+		while (table_offsets[slot] >= 0 && table_offsets[slot] != dict_offset) {
+			slot = (slot + 1) & table_mask;
+		}
+		if (table_offsets[slot] < 0) {
+			// new distinct string
+			if (entry_count >= max_entries) {
+				// too many distinct strings: the dictionary would not pay off, fall back to a flat scan
+				state.scan_dictionary = false;
+				FetchBaseData(state, vector_index, result);
+				return;
+			}
+			table_offsets[slot] = dict_offset;
+			table_entries[slot] = entry_count;
+			entry_offsets[entry_count++] = dict_offset;
+		}
+		sel.set_index(i, table_entries[slot]);
+	}
+	// fetch every distinct string only once
+	Vector dictionary(result.type);
+	auto dict_data = FlatVector::GetData<string_t>(dictionary);
+	auto &dict_nullmask = FlatVector::Nullmask(dictionary);
+	for (idx_t i = 0; i < entry_count; i++) {
+		if (entry_offsets[i] == 0) {
+			dict_nullmask[i] = true;
+		}
+		dict_data[i] = FetchStringFromDict(dictionary, baseptr, entry_offsets[i]);
+	}
+	result.Slice(dictionary, sel, count);
+	DictionaryVector::SetDictionarySize(result, entry_count);
+}
+
 void StringSegment::FilterFetchBaseData(ColumnScanState &state, Vector &result, SelectionVector &sel,
                                         idx_t &approved_tuple_count) {
 	// clear any previously locked buffers and get the primary buffer handle
@@ -375,21 +435,15 @@ void StringSegment::FetchRow(ColumnFetchState &state, Transaction &transaction,
 
 	bool found_data = false;
 	// first see if there is any updated version of this tuple we must fetch
-	if (versions && versions[vector_index]) {
+	if (HasUpdatesForTransaction(transaction, vector_index)) {
 		UpdateInfo::UpdatesForTransaction(versions[vector_index], transaction, [&](UpdateInfo *current) {
 			auto info_data = (string_location_t *)current->tuple_data;
-			// loop over the tuples in this UpdateInfo
-			for (idx_t i = 0; i < current->N; i++) {
-				if (current->tuples[i] == row_id) {
-					// found the relevant tuple
-					found_data = true;
-					result_data[result_idx] = FetchString(result, baseptr, info_data[i]);
-					result_mask[result_idx] = current->nullmask[current->tuples[i]];
-					break;
-				} else if (current->tuples[i] > row_id) {
-					// tuples are sorted: so if the current tuple is > row_id we will not find it anymore
-					break;
-				}
+			auto tuple_idx = current->FindTuple(id_in_vector);
+			if (tuple_idx != INVALID_INDEX) {
+				// found the relevant tuple
+				found_data = true;
+				result_data[result_idx] = FetchString(result, baseptr, info_data[tuple_idx]);
+				result_mask[result_idx] = current->nullmask[id_in_vector];
 			}
 		});
 	}
@@ -487,6 +541,27 @@ void StringSegment::AppendData(BufferHandle &handle, SegmentStatistics &stats, d
 
 			update_string_stats(stats, sdata[source_idx]);
 
+			bool deduplicate = deduplicate_strings && total_length < STRING_BLOCK_LIMIT;
+			hash_t string_hash = 0;
+			if (deduplicate) {
+				// check if the string is already present in the dictionary
+				dictionary_lookups++;
+				string_hash = Hash<string_t>(sdata[source_idx]);
+				auto entry = dictionary_entries.find(string_hash);
+				if (entry != dictionary_entries.end()) {
+					auto dict_pos = end - entry->second;
+					if (Load<uint16_t>(dict_pos) == string_length &&
+					    memcmp(dict_pos + sizeof(uint16_t), sdata[source_idx].GetDataUnsafe(), string_length) == 0) {
+						// it is: point to the existing dictionary entry
+						result_data[target_idx] = entry->second;
+						remaining_strings--;
+						continue;
+					}
+					// hash collision with a different string: the entry is kept
+					deduplicate = false;
+				}
+			}
+
 			// determine whether or not the string needs to be stored in an overflow block
 			// we never place small strings in the overflow blocks: the pointer would take more space than the
 			// string itself we always place big strings (>= STRING_BLOCK_LIMIT) in the overflow blocks we also have
@@ -505,6 +580,8 @@ void StringSegment::AppendData(BufferHandle &handle, SegmentStatistics &stats, d
 
 				// write a big string marker into the dictionary
 				WriteStringMarker(dict_pos, block, offset);
+				// the string itself is not stored in the dictionary: it cannot be compared against
+				deduplicate = false;
 			} else {
 				// string fits in block, append to dictionary and increment dictionary position
 				D_ASSERT(string_length < NumericLimits<uint16_t>::Maximum());
@@ -519,9 +596,18 @@ void StringSegment::AppendData(BufferHandle &handle, SegmentStatistics &stats, d
 			D_ASSERT(dictionary_offset <= Storage::BLOCK_SIZE);
 			result_data[target_idx] = dictionary_offset;
 			SetDictionaryOffset(handle, dictionary_offset);
+			if (deduplicate) {
+				dictionary_entries[string_hash] = dictionary_offset;
+			}
 		}
 		remaining_strings--;
 	}
+	if (deduplicate_strings && dictionary_lookups >= STANDARD_VECTOR_SIZE &&
+	    dictionary_entries.size() * DEDUPLICATION_RATIO > dictionary_lookups) {
+		// most of the appended strings are distinct: deduplication does not pay off for this segment
+		deduplicate_strings = false;
+		dictionary_entries.clear();
+	}
 }
 
 void StringSegment::WriteString(string_t string, block_id_t &result_block, int32_t &result_offset) {
@@ -30,6 +30,22 @@ void ChunkConstantInfo::CommitAppend(transaction_t commit_id, idx_t start, idx_t
 	insert_id = commit_id;
 }
 
+void ChunkConstantInfo::Delete(Transaction &transaction) {
+	if (delete_id != NOT_DELETED_ID) {
+		// the chunk was already deleted by another transaction
+		throw TransactionException("Conflict on tuple deletion!");
+	}
+	if (insert_id >= TRANSACTION_ID_START) {
+		throw TransactionException("Deleting non-committed tuples is not supported (for now...)");
+	}
+	delete_id = transaction.transaction_id;
+}
+
+void ChunkConstantInfo::CommitDelete(transaction_t commit_id, row_t rows[], idx_t count) {
+	D_ASSERT(count == STANDARD_VECTOR_SIZE);
+	delete_id = commit_id;
+}
+
 //===--------------------------------------------------------------------===//
 // Vector info
 //===--------------------------------------------------------------------===//
@@ -108,14 +108,13 @@ void MorselInfo::RevertAppend(idx_t morsel_start) {
 class VersionDeleteState {
 public:
 	VersionDeleteState(MorselInfo &info, Transaction &transaction, DataTable *table, idx_t base_row)
-	    : info(info), transaction(transaction), table(table), current_info(nullptr), current_chunk(INVALID_INDEX),
-	      count(0), base_row(base_row) {
+	    : info(info), transaction(transaction), table(table), current_chunk(INVALID_INDEX), count(0),
+	      base_row(base_row) {
 	}
 
 	MorselInfo &info;
 	Transaction &transaction;
 	DataTable *table;
-	ChunkVectorInfo *current_info;
 	idx_t current_chunk;
 	row_t rows[STANDARD_VECTOR_SIZE];
 	idx_t count;
@@ -125,6 +124,10 @@ public:
 public:
 	void Delete(row_t row_id);
 	void Flush();
+
+private:
+	//! Whether or not the buffered rows are all the rows of the current chunk
+	bool DeletesEntireChunk();
 };
 
 void MorselInfo::Delete(Transaction &transaction, DataTable *table, Vector &row_ids, idx_t count) {
@@ -148,36 +151,63 @@ void VersionDeleteState::Delete(row_t row_id) {
 	if (current_chunk != vector_idx) {
 		Flush();
 
-		if (!info.root) {
-			info.root = make_unique<VersionNode>();
-		}
-
-		if (!info.root->info[vector_idx]) {
-			// no info yet: create it
-			info.root->info[vector_idx] =
-			    make_unique<ChunkVectorInfo>(info.start + vector_idx * STANDARD_VECTOR_SIZE, info);
-		} else if (info.root->info[vector_idx]->type == ChunkInfoType::CONSTANT_INFO) {
-			auto &constant = (ChunkConstantInfo &)*info.root->info[vector_idx];
-			// info exists but it's a constant info: convert to a vector info
-			auto new_info = make_unique<ChunkVectorInfo>(info.start + vector_idx * STANDARD_VECTOR_SIZE, info);
-			new_info->insert_id = constant.insert_id;
-			for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
-				new_info->inserted[i] = constant.insert_id;
-			}
-			info.root->info[vector_idx] = move(new_info);
-		}
-		D_ASSERT(info.root->info[vector_idx]->type == ChunkInfoType::VECTOR_INFO);
-		current_info = (ChunkVectorInfo *)info.root->info[vector_idx].get();
 		current_chunk = vector_idx;
 		chunk_row = vector_idx * STANDARD_VECTOR_SIZE;
 	}
 	rows[count++] = idx_in_vector;
 }
 
+bool VersionDeleteState::DeletesEntireChunk() {
+	if (count != STANDARD_VECTOR_SIZE) {
+		return false;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		if (rows[i] != row_t(i)) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void VersionDeleteState::Flush() {
 	if (count == 0) {
 		return;
 	}
+	if (!info.root) {
+		info.root = make_unique<VersionNode>();
+	}
+	auto &chunk_info = info.root->info[current_chunk];
+	if (DeletesEntireChunk() && (!chunk_info || chunk_info->type == ChunkInfoType::CONSTANT_INFO)) {
+		// the entire chunk is deleted: mark it as deleted in a constant info instead of per row
+		if (!chunk_info) {
+			chunk_info = make_unique<ChunkConstantInfo>(info.start + chunk_row, info);
+		}
+		auto &constant = (ChunkConstantInfo &)*chunk_info;
+		constant.Delete(transaction);
+		transaction.PushDelete(table, &constant, nullptr, count, base_row + chunk_row);
+		count = 0;
+		return;
+	}
+	if (!chunk_info) {
+		// no info yet: create it
+		chunk_info = make_unique<ChunkVectorInfo>(info.start + chunk_row, info);
+	} else if (chunk_info->type == ChunkInfoType::CONSTANT_INFO) {
+		auto &constant = (ChunkConstantInfo &)*chunk_info;
+		if (constant.delete_id != NOT_DELETED_ID) {
+			// the entire chunk was already deleted by another transaction
+			// note that we cannot convert the info: the delete in the undo buffer of that transaction refers to it
+			throw TransactionException("Conflict on tuple deletion!");
+		}
+		// info exists but it's a constant info: convert to a vector info
+		auto new_info = make_unique<ChunkVectorInfo>(info.start + chunk_row, info);
+		new_info->insert_id = constant.insert_id;
+		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+			new_info->inserted[i] = constant.insert_id;
+		}
+		chunk_info = move(new_info);
+	}
+	D_ASSERT(chunk_info->type == ChunkInfoType::VECTOR_INFO);
+	auto current_info = (ChunkVectorInfo *)chunk_info.get();
 	// delete in the current info
 	current_info->Delete(transaction, rows, count);
 	// now push the delete into the undo buffer
@@ -4,7 +4,7 @@
 
 namespace duckdb {
 
-PersistentTableData::PersistentTableData(idx_t column_count) {
+PersistentTableData::PersistentTableData(idx_t column_count) : block_id(INVALID_BLOCK), offset(0) {
 	column_stats.resize(column_count);
 	table_data.resize(column_count);
 }
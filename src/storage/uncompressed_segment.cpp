@@ -117,8 +117,10 @@ UpdateInfo *UncompressedSegment::CreateUpdateInfo(ColumnData &column_data, Trans
 	node->vector_index = vector_index;
 	node->prev = nullptr;
 	node->next = versions[vector_index];
+	node->newest_version = transaction.transaction_id;
 	if (node->next) {
 		node->next->prev = node;
+		node->newest_version = MaxValue<transaction_t>(node->newest_version, node->next->newest_version);
 	}
 	versions[vector_index] = node;
 
@@ -282,9 +284,10 @@ void UncompressedSegment::filterSelection(SelectionVector &sel, Vector &result,
 void UncompressedSegment::Select(Transaction &transaction, Vector &result, vector<TableFilter> &tableFilters,
                                  SelectionVector &sel, idx_t &approved_tuple_count, ColumnScanState &state) {
 	auto read_lock = lock.GetSharedLock();
-	if (versions && versions[state.vector_index]) {
-		Scan(transaction, state, state.vector_index, result, false);
+	if (HasUpdatesForTransaction(transaction, state.vector_index)) {
 		auto vector_index = state.vector_index;
+		FetchBaseData(state, vector_index, result);
+		FetchUpdateData(state, transaction, versions[vector_index], result);
 		// pin the buffer for this segment
 		auto handle = manager.Pin(block);
 		auto data = handle->node->buffer;
@@ -308,20 +311,31 @@ void UncompressedSegment::Scan(Transaction &transaction, ColumnScanState &state,
 	if (get_lock) {
 		read_lock = lock.GetSharedLock();
 	}
-	// first fetch the data from the base table
-	FetchBaseData(state, vector_index, result);
-	if (versions && versions[vector_index]) {
-		// if there are any versions, check if we need to overwrite the data with the versioned data
+	if (HasUpdatesForTransaction(transaction, vector_index)) {
+		// first fetch the data from the base table
+		FetchBaseData(state, vector_index, result);
+		// there are versions this transaction cannot see yet: overwrite the data with the versioned data
 		FetchUpdateData(state, transaction, versions[vector_index], result);
+	} else {
+		// no relevant versions: scan the base table data directly
+		ScanBaseData(state, vector_index, result);
+	}
+}
+
+bool UncompressedSegment::HasUpdatesForTransaction(Transaction &transaction, idx_t vector_index) {
+	if (!versions) {
+		return false;
 	}
+	return UpdateInfo::HasUpdatesForTransaction(versions[vector_index], transaction);
 }
 
 void UncompressedSegment::FilterScan(Transaction &transaction, ColumnScanState &state, Vector &result,
                                      SelectionVector &sel, idx_t &approved_tuple_count) {
 	auto read_lock = lock.GetSharedLock();
-	if (versions && versions[state.vector_index]) {
-		// if there are any versions, we do a regular scan
-		Scan(transaction, state, state.vector_index, result, false);
+	if (HasUpdatesForTransaction(transaction, state.vector_index)) {
+		// if there are any relevant versions, we do a regular scan
+		FetchBaseData(state, state.vector_index, result);
+		FetchUpdateData(state, transaction, versions[state.vector_index], result);
 		result.Slice(sel, approved_tuple_count);
 	} else {
 		FilterFetchBaseData(state, result, sel, approved_tuple_count);
@@ -20,14 +20,19 @@
 namespace duckdb {
 class ReplayState {
 public:
-	ReplayState(DatabaseInstance &db, ClientContext &context, Deserializer &source)
-	    : db(db), context(context), source(source), current_table(nullptr) {
+	ReplayState(DatabaseInstance &db, ClientContext &context, Deserializer &source, bool deserialize_only = false)
+	    : db(db), context(context), source(source), current_table(nullptr), deserialize_only(deserialize_only),
+	      checkpoint_requested(false) {
 	}
 
 	DatabaseInstance &db;
 	ClientContext &context;
 	Deserializer &source;
 	TableCatalogEntry *current_table;
+	//! If true, the entries are only read and not applied to the database
+	bool deserialize_only;
+	//! Whether or not a CHECKPOINT_REQUEST entry was read
+	bool checkpoint_requested;
 
 public:
 	void ReplayEntry(WALType entry_type);
@@ -100,6 +105,33 @@ void WriteAheadLog::Replay(DatabaseInstance &database, string &path) {
 	}
 }
 
+bool WriteAheadLog::CheckpointRequested(DatabaseInstance &database, string &path) {
+	BufferedFileReader reader(database.GetFileSystem(), path.c_str());
+	if (reader.Finished()) {
+		return false;
+	}
+	Connection con(database);
+	ReplayState state(database, *con.context, reader, true);
+	// only requests of transactions that were completely written to the WAL count
+	bool checkpoint_requested = false;
+	try {
+		while (true) {
+			WALType entry_type = reader.Read<WALType>();
+			if (entry_type == WALType::WAL_FLUSH) {
+				checkpoint_requested = checkpoint_requested || state.checkpoint_requested;
+				if (reader.Finished()) {
+					break;
+				}
+			} else {
+				state.ReplayEntry(entry_type);
+			}
+		}
+	} catch (std::exception &ex) {
+		// the rest of the WAL cannot be read: it is not replayed either
+	}
+	return checkpoint_requested;
+}
+
 //===--------------------------------------------------------------------===//
 // Replay Entries
 //===--------------------------------------------------------------------===//
@@ -153,6 +185,10 @@ void ReplayState::ReplayEntry(WALType entry_type) {
 	case WALType::UPDATE_TUPLE:
 		ReplayUpdate();
 		break;
+	case WALType::CHECKPOINT_REQUEST:
+		// the request is handled before the WAL is replayed (see WriteAheadLog::CheckpointRequested)
+		checkpoint_requested = true;
+		break;
 	default:
 		throw Exception("Invalid WAL entry type!");
 	}
@@ -163,6 +199,9 @@ void ReplayState::ReplayEntry(WALType entry_type) {
 //===--------------------------------------------------------------------===//
 void ReplayState::ReplayCreateTable() {
 	auto info = TableCatalogEntry::Deserialize(source);
+	if (deserialize_only) {
+		return;
+	}
 
 	// bind the constraints to the table again
 	Binder binder(context);
@@ -178,6 +217,9 @@ void ReplayState::ReplayDropTable() {
 	info.type = CatalogType::TABLE_ENTRY;
 	info.schema = source.Read<string>();
 	info.name = source.Read<string>();
+	if (deserialize_only) {
+		return;
+	}
 
 	auto &catalog = Catalog::GetCatalog(context);
 	catalog.DropEntry(context, &info);
@@ -185,6 +227,9 @@ void ReplayState::ReplayDropTable() {
 
 void ReplayState::ReplayAlter() {
 	auto info = AlterInfo::Deserialize(source);
+	if (deserialize_only) {
+		return;
+	}
 	auto &catalog = Catalog::GetCatalog(context);
 	catalog.Alter(context, info.get());
 }
@@ -194,6 +239,9 @@ void ReplayState::ReplayAlter() {
 //===--------------------------------------------------------------------===//
 void ReplayState::ReplayCreateView() {
 	auto entry = ViewCatalogEntry::Deserialize(source);
+	if (deserialize_only) {
+		return;
+	}
 
 	auto &catalog = Catalog::GetCatalog(context);
 	catalog.CreateView(context, entry.get());
@@ -204,6 +252,9 @@ void ReplayState::ReplayDropView() {
 	info.type = CatalogType::VIEW_ENTRY;
 	info.schema = source.Read<string>();
 	info.name = source.Read<string>();
+	if (deserialize_only) {
+		return;
+	}
 	auto &catalog = Catalog::GetCatalog(context);
 	catalog.DropEntry(context, &info);
 }
@@ -214,6 +265,9 @@ void ReplayState::ReplayDropView() {
 void ReplayState::ReplayCreateSchema() {
 	CreateSchemaInfo info;
 	info.schema = source.Read<string>();
+	if (deserialize_only) {
+		return;
+	}
 
 	auto &catalog = Catalog::GetCatalog(context);
 	catalog.CreateSchema(context, &info);
@@ -224,6 +278,9 @@ void ReplayState::ReplayDropSchema() {
 
 	info.type = CatalogType::SCHEMA_ENTRY;
 	info.name = source.Read<string>();
+	if (deserialize_only) {
+		return;
+	}
 
 	auto &catalog = Catalog::GetCatalog(context);
 	catalog.DropEntry(context, &info);
@@ -234,6 +291,9 @@ void ReplayState::ReplayDropSchema() {
 //===--------------------------------------------------------------------===//
 void ReplayState::ReplayCreateSequence() {
 	auto entry = SequenceCatalogEntry::Deserialize(source);
+	if (deserialize_only) {
+		return;
+	}
 
 	auto &catalog = Catalog::GetCatalog(context);
 	catalog.CreateSequence(context, entry.get());
@@ -244,6 +304,9 @@ void ReplayState::ReplayDropSequence() {
 	info.type = CatalogType::SEQUENCE_ENTRY;
 	info.schema = source.Read<string>();
 	info.name = source.Read<string>();
+	if (deserialize_only) {
+		return;
+	}
 
 	auto &catalog = Catalog::GetCatalog(context);
 	catalog.DropEntry(context, &info);
@@ -254,6 +317,9 @@ void ReplayState::ReplaySequenceValue() {
 	auto name = source.Read<string>();
 	auto usage_count = source.Read<uint64_t>();
 	auto counter = source.Read<int64_t>();
+	if (deserialize_only) {
+		return;
+	}
 
 	// fetch the sequence from the catalog
 	auto &catalog = Catalog::GetCatalog(context);
@@ -269,6 +335,9 @@ void ReplayState::ReplaySequenceValue() {
 //===--------------------------------------------------------------------===//
 void ReplayState::ReplayCreateMacro() {
 	auto entry = MacroCatalogEntry::Deserialize(source);
+	if (deserialize_only) {
+		return;
+	}
 
 	auto &catalog = Catalog::GetCatalog(context);
 	catalog.CreateFunction(context, entry.get());
@@ -279,6 +348,9 @@ void ReplayState::ReplayDropMacro() {
 	info.type = CatalogType::MACRO_ENTRY;
 	info.schema = source.Read<string>();
 	info.name = source.Read<string>();
+	if (deserialize_only) {
+		return;
+	}
 
 	auto &catalog = Catalog::GetCatalog(context);
 	catalog.DropEntry(context, &info);
@@ -290,27 +362,36 @@ void ReplayState::ReplayDropMacro() {
 void ReplayState::ReplayUseTable() {
 	auto schema_name = source.Read<string>();
 	auto table_name = source.Read<string>();
+	if (deserialize_only) {
+		return;
+	}
 	auto &catalog = Catalog::GetCatalog(context);
 	current_table = catalog.GetEntry<TableCatalogEntry>(context, schema_name, table_name);
 }
 
 void ReplayState::ReplayInsert() {
+	DataChunk chunk;
+	chunk.Deserialize(source);
+	if (deserialize_only) {
+		return;
+	}
 	if (!current_table) {
 		throw Exception("Corrupt WAL: insert without table");
 	}
-	DataChunk chunk;
-	chunk.Deserialize(source);
 
 	// append to the current table
 	current_table->storage->Append(*current_table, context, chunk);
 }
 
 void ReplayState::ReplayDelete() {
+	DataChunk chunk;
+	chunk.Deserialize(source);
+	if (deserialize_only) {
+		return;
+	}
 	if (!current_table) {
 		throw Exception("Corrupt WAL: delete without table");
 	}
-	DataChunk chunk;
-	chunk.Deserialize(source);
 
 	D_ASSERT(chunk.ColumnCount() == 1 && chunk.data[0].type == LOGICAL_ROW_TYPE);
 	row_t row_ids[1];
@@ -325,14 +406,16 @@ void ReplayState::ReplayDelete() {
 }
 
 void ReplayState::ReplayUpdate() {
-	if (!current_table) {
-		throw Exception("Corrupt WAL: update without table");
-	}
-
 	idx_t column_index = source.Read<column_t>();
 
 	DataChunk chunk;
 	chunk.Deserialize(source);
+	if (deserialize_only) {
+		return;
+	}
+	if (!current_table) {
+		throw Exception("Corrupt WAL: update without table");
+	}
 
 	vector<column_t> column_ids{column_index};
 	if (column_index >= current_table->columns.size()) {
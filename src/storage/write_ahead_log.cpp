@@ -149,6 +149,10 @@ void WriteAheadLog::WriteUpdate(DataChunk &chunk, column_t col_idx) {
 	chunk.Serialize(*writer);
 }
 
+void WriteAheadLog::WriteCheckpointRequest() {
+	writer->Write<WALType>(WALType::CHECKPOINT_REQUEST);
+}
+
 //===--------------------------------------------------------------------===//
 // Write ALTER Statement
 //===--------------------------------------------------------------------===//
@@ -66,12 +66,15 @@ void CleanupState::CleanupDelete(DeleteInfo *info) {
 		// table for this entry differs from previous table: flush and switch to the new table
 		Flush();
 		current_table = version_table;
+	} else if (count > 0 && row_numbers[0] / STANDARD_VECTOR_SIZE != info->vinfo->start / STANDARD_VECTOR_SIZE) {
+		// the rows that are removed from the indexes at once have to belong to the same vector
+		Flush();
 	}
 	for (idx_t i = 0; i < info->count; i++) {
 		if (count == STANDARD_VECTOR_SIZE) {
 			Flush();
 		}
-		row_numbers[count++] = info->vinfo->start + info->rows[i];
+		row_numbers[count++] = info->vinfo->start + (info->is_consecutive ? i : info->rows[i]);
 	}
 }
 
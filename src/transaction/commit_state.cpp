@@ -6,6 +6,7 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/storage/uncompressed_segment.hpp"
+#include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/catalog_set.hpp"
 #include "duckdb/common/serializer/buffered_deserializer.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
@@ -120,8 +121,14 @@ void CommitState::WriteDelete(DeleteInfo *info) {
 		delete_chunk->Initialize(delete_types);
 	}
 	auto rows = FlatVector::GetData<row_t>(delete_chunk->data[0]);
-	for (idx_t i = 0; i < info->count; i++) {
-		rows[i] = info->base_row + info->rows[i];
+	if (info->is_consecutive) {
+		for (idx_t i = 0; i < info->count; i++) {
+			rows[i] = info->base_row + i;
+		}
+	} else {
+		for (idx_t i = 0; i < info->count; i++) {
+			rows[i] = info->base_row + info->rows[i];
+		}
 	}
 	delete_chunk->SetCardinality(info->count);
 	log->WriteDelete(*delete_chunk);
@@ -163,6 +170,8 @@ template <bool HAS_LOG> void CommitState::CommitEntry(UndoFlags type, data_ptr_t
 		if (catalog_entry->name != catalog_entry->parent->name) {
 			catalog_entry->set->UpdateTimestamp(catalog_entry, commit_id);
 		}
+		// the change is now visible to other transactions: plans bound against the old catalog have to be rebound
+		catalog_entry->catalog->ModifyCatalog();
 		if (HAS_LOG) {
 			// push the catalog update to the WAL
 			WriteCatalogEntry(catalog_entry, data + sizeof(CatalogEntry *));
@@ -177,6 +186,7 @@ template <bool HAS_LOG> void CommitState::CommitEntry(UndoFlags type, data_ptr_t
 		}
 		// mark the tuples as committed
 		info->table->CommitAppend(commit_id, info->start_row, info->count);
+		info->table->info->last_commit_id = commit_id;
 		break;
 	}
 	case UndoFlags::DELETE_TUPLE: {
@@ -187,6 +197,7 @@ template <bool HAS_LOG> void CommitState::CommitEntry(UndoFlags type, data_ptr_t
 		}
 		// mark the tuples as committed
 		info->vinfo->CommitDelete(commit_id, info->rows, info->count);
+		info->table->info->last_commit_id = commit_id;
 		break;
 	}
 	case UndoFlags::UPDATE_TUPLE: {
@@ -196,6 +207,7 @@ template <bool HAS_LOG> void CommitState::CommitEntry(UndoFlags type, data_ptr_t
 			WriteUpdate(info);
 		}
 		info->version_number = commit_id;
+		info->column_data->table_info.last_commit_id = commit_id;
 		break;
 	}
 	default:
@@ -234,6 +246,12 @@ void CommitState::RevertCommit(UndoFlags type, data_ptr_t data) {
 		// update:
 		auto info = (UpdateInfo *)data;
 		info->version_number = transaction_id;
+		// the version is newer again: raise the bound at the front of the chain
+		auto head = info;
+		while (head->prev) {
+			head = head->prev;
+		}
+		head->newest_version = MaxValue<transaction_t>(head->newest_version, transaction_id);
 		break;
 	}
 	default:
@@ -38,14 +38,18 @@ void Transaction::PushCatalogEntry(CatalogEntry *entry, data_ptr_t extra_data, i
 	}
 }
 
-void Transaction::PushDelete(DataTable *table, ChunkVectorInfo *vinfo, row_t rows[], idx_t count, idx_t base_row) {
-	auto delete_info =
-	    (DeleteInfo *)undo_buffer.CreateEntry(UndoFlags::DELETE_TUPLE, sizeof(DeleteInfo) + sizeof(row_t) * count);
+void Transaction::PushDelete(DataTable *table, ChunkInfo *vinfo, row_t rows[], idx_t count, idx_t base_row) {
+	bool is_consecutive = !rows;
+	auto delete_info = (DeleteInfo *)undo_buffer.CreateEntry(
+	    UndoFlags::DELETE_TUPLE, sizeof(DeleteInfo) + (is_consecutive ? 0 : sizeof(row_t) * count));
 	delete_info->vinfo = vinfo;
 	delete_info->table = table;
 	delete_info->count = count;
 	delete_info->base_row = base_row;
-	memcpy(delete_info->rows, rows, sizeof(row_t) * count);
+	delete_info->is_consecutive = is_consecutive;
+	if (!is_consecutive) {
+		memcpy(delete_info->rows, rows, sizeof(row_t) * count);
+	}
 }
 
 void Transaction::PushAppend(DataTable *table, idx_t start_row, idx_t row_count) {
@@ -75,7 +79,8 @@ string Transaction::Commit(WriteAheadLog *log, transaction_t commit_id) noexcept
 	if (log) {
 		initial_wal_size = log->GetWALSize();
 	}
-	bool changes_made = undo_buffer.ChangesMade() || storage.ChangesMade() || sequence_usage.size() > 0;
+	bool changes_made =
+	    undo_buffer.ChangesMade() || storage.ChangesMade() || sequence_usage.size() > 0 || checkpoint_requested;
 	try {
 		// commit the undo buffer
 		storage.Commit(commit_state, *this, log, commit_id);
@@ -85,6 +90,9 @@ string Transaction::Commit(WriteAheadLog *log, transaction_t commit_id) noexcept
 			for (auto &entry : sequence_usage) {
 				log->WriteSequenceValue(entry.first, entry.second);
 			}
+			if (checkpoint_requested) {
+				log->WriteCheckpointRequest();
+			}
 			// flush the WAL
 			if (changes_made) {
 				log->Flush();
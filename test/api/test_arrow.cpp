@@ -1,75 +1,19 @@
 #include "catch.hpp"
 #include "test_helpers.hpp"
-#include "duckdb/common/arrow.hpp"
+#include "duckdb/common/arrow_wrapper.hpp"
 
 using namespace duckdb;
 using namespace std;
 
-struct MyArrowArrayStream {
-	MyArrowArrayStream(unique_ptr<QueryResult> duckdb_result) : duckdb_result(move(duckdb_result)) {
-		stream.get_schema = MyArrowArrayStream::my_stream_getschema;
-		stream.get_next = MyArrowArrayStream::my_stream_getnext;
-		stream.release = MyArrowArrayStream::my_stream_release;
-		stream.get_last_error = MyArrowArrayStream::my_stream_getlasterror;
-		stream.private_data = this;
-	}
-
-	static int my_stream_getschema(struct ArrowArrayStream *stream, struct ArrowSchema *out) {
-		D_ASSERT(stream->private_data);
-		auto my_stream = (MyArrowArrayStream *)stream->private_data;
-		if (!stream->release) {
-			my_stream->last_error = "stream was released";
-			return -1;
-		}
-		my_stream->duckdb_result->ToArrowSchema(out);
-		return 0;
-	}
-
-	static int my_stream_getnext(struct ArrowArrayStream *stream, struct ArrowArray *out) {
-		D_ASSERT(stream->private_data);
-		auto my_stream = (MyArrowArrayStream *)stream->private_data;
-		if (!stream->release) {
-			my_stream->last_error = "stream was released";
-			return -1;
-		}
-		auto chunk = my_stream->duckdb_result->Fetch();
-		if (!chunk || chunk->size() == 0) {
-			return 0;
-		}
-		chunk->ToArrowArray(out);
-		return 0;
-	}
-
-	static void my_stream_release(struct ArrowArrayStream *stream) {
-		if (!stream->release) {
-			return;
-		}
-		stream->release = nullptr;
-		delete (MyArrowArrayStream *)stream->private_data;
-	}
-
-	static const char *my_stream_getlasterror(struct ArrowArrayStream *stream) {
-		if (!stream->release) {
-			return "stream was released";
-		}
-		D_ASSERT(stream->private_data);
-		auto my_stream = (MyArrowArrayStream *)stream->private_data;
-		return my_stream->last_error.c_str();
-	}
-
-	unique_ptr<QueryResult> duckdb_result;
-	ArrowArrayStream stream;
-	string last_error;
-};
-
-static void test_arrow_round_trip(string q) {
+static void test_arrow_round_trip(string q, bool stream_result = false) {
 	DuckDB db(nullptr);
 	Connection con(db);
+	Connection con2(db);
 
 	// query that creates a bunch of values across the types
-	auto result = con.Query(q);
+	auto result = stream_result ? con2.SendQuery(q) : con.Query(q);
 	REQUIRE(result->success);
-	auto my_stream = new MyArrowArrayStream(move(result));
+	auto my_stream = new ResultArrowArrayStreamWrapper(move(result));
 	auto result2 = con.TableFunction("arrow_scan", {Value::POINTER((uintptr_t)&my_stream->stream)})->Execute();
 
 	idx_t column_count = result2->ColumnCount();
@@ -102,5 +46,227 @@ TEST_CASE("Test Arrow API round trip", "[arrow]") {
 	    "from (select case when range % 2 == 0 then range else null end as c from range(-10, 10)) sq");
 	// big result set
 	test_arrow_round_trip("select i from range(0, 2000) sq(i)");
+	// streaming result
+	test_arrow_round_trip("select i, i::varchar s, case when i % 3 = 0 then null else i end n from range(0, 5000) sq(i)",
+	                      true);
+}
+
+TEST_CASE("Test Arrow chunk conversion", "[arrow]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	string q = "select i, i::varchar s, case when i % 3 = 0 then null else i end n, timestamp '1992-01-01 12:00:00' "
+	           "t from range(0, 100000) sq(i)";
+	for (auto stream_result : {false, true}) {
+		auto result = stream_result ? con.SendQuery(q) : con.Query(q);
+		REQUIRE(result->success);
+		int64_t row = 0;
+		bool correct = true;
+		while (true) {
+			auto chunk = result->Fetch();
+			if (!chunk || chunk->size() == 0) {
+				break;
+			}
+			ArrowArray array;
+			chunk->ToArrowArray(&array);
+			REQUIRE(array.release);
+			REQUIRE(array.n_children == 4);
+			auto &i_array = *array.children[0];
+			auto &n_array = *array.children[2];
+			// columns without NULLs do not have a validity buffer
+			REQUIRE(i_array.null_count == 0);
+			REQUIRE(!i_array.buffers[0]);
+			REQUIRE(n_array.buffers[0]);
+			auto i_data = (int64_t *)i_array.buffers[1];
+			auto t_data = (int64_t *)array.children[3]->buffers[1];
+			for (int64_t r = 0; r < array.length; r++) {
+				if (i_data[r] != row + r || t_data[r] != 694267200000000000LL) {
+					correct = false;
+				}
+			}
+			row += array.length;
+			// releasing the root array releases its children
+			array.release(&array);
+		}
+		REQUIRE(correct);
+		REQUIRE(row == 100000);
+	}
 }
 // TODO interval decimal
+
+//! A stream of record batches with an integer column and a dictionary-encoded string column
+struct DictionaryArrowArrayStream {
+	static constexpr idx_t BATCH_SIZE = 3000;
+
+	struct Batch {
+		ArrowArray root;
+		ArrowArray children[2];
+		ArrowArray dictionary;
+		ArrowArray *child_pointers[2];
+		const void *root_buffers[1];
+		const void *child_buffers[2][2];
+		const void *dictionary_buffers[3];
+		vector<int32_t> values;
+		vector<int8_t> indices;
+		vector<uint8_t> validity;
+	};
+
+	DictionaryArrowArrayStream(idx_t batch_count) : batch_count(batch_count) {
+		stream.get_schema = get_schema;
+		stream.get_next = get_next;
+		stream.release = release;
+		stream.get_last_error = get_last_error;
+		stream.private_data = this;
+	}
+
+	static void release_schema(ArrowSchema *schema) {
+		schema->release = nullptr;
+	}
+
+	static void release_array(ArrowArray *array) {
+		array->release = nullptr;
+	}
+
+	static void release_batch(ArrowArray *array) {
+		array->release = nullptr;
+		delete (Batch *)array->private_data;
+	}
+
+	static int get_schema(ArrowArrayStream *stream, ArrowSchema *out) {
+		auto &my_stream = *(DictionaryArrowArrayStream *)stream->private_data;
+		auto init_schema = [](ArrowSchema &schema, const char *format, const char *name) {
+			schema.format = format;
+			schema.name = name;
+			schema.metadata = nullptr;
+			schema.flags = ARROW_FLAG_NULLABLE;
+			schema.n_children = 0;
+			schema.children = nullptr;
+			schema.dictionary = nullptr;
+			schema.release = release_schema;
+			schema.private_data = nullptr;
+		};
+		init_schema(my_stream.schemas[0], "i", "i");
+		init_schema(my_stream.schemas[1], "c", "d");
+		init_schema(my_stream.dictionary_schema, "u", "");
+		my_stream.schemas[1].dictionary = &my_stream.dictionary_schema;
+		my_stream.schema_pointers[0] = &my_stream.schemas[0];
+		my_stream.schema_pointers[1] = &my_stream.schemas[1];
+		init_schema(*out, "+s", "");
+		out->n_children = 2;
+		out->children = my_stream.schema_pointers;
+		return 0;
+	}
+
+	static int get_next(ArrowArrayStream *stream, ArrowArray *out) {
+		auto &my_stream = *(DictionaryArrowArrayStream *)stream->private_data;
+		if (my_stream.batch_idx >= my_stream.batch_count) {
+			out->release = nullptr;
+			return 0;
+		}
+		auto batch = new Batch();
+		auto init_array = [](ArrowArray &array, int64_t length, const void **buffers, int64_t n_buffers) {
+			array.length = length;
+			array.null_count = 0;
+			array.offset = 0;
+			array.n_buffers = n_buffers;
+			array.n_children = 0;
+			array.buffers = buffers;
+			array.children = nullptr;
+			array.dictionary = nullptr;
+			array.release = release_array;
+			array.private_data = nullptr;
+		};
+		auto start = my_stream.batch_idx * BATCH_SIZE;
+		batch->validity.resize((BATCH_SIZE + 7) / 8, 0);
+		for (idx_t i = 0; i < BATCH_SIZE; i++) {
+			batch->values.push_back(int32_t(start + i));
+			// every seventh index is NULL
+			batch->indices.push_back(int8_t((start + i) % 3));
+			if ((start + i) % 7 != 0) {
+				batch->validity[i / 8] |= 1 << (i % 8);
+			}
+		}
+		batch->root_buffers[0] = nullptr;
+		batch->child_buffers[0][0] = nullptr;
+		batch->child_buffers[0][1] = batch->values.data();
+		batch->child_buffers[1][0] = batch->validity.data();
+		batch->child_buffers[1][1] = batch->indices.data();
+		batch->dictionary_buffers[0] = &my_stream.dictionary_validity;
+		batch->dictionary_buffers[1] = my_stream.dictionary_offsets;
+		batch->dictionary_buffers[2] = my_stream.dictionary_data;
+		init_array(batch->children[0], BATCH_SIZE, batch->child_buffers[0], 2);
+		init_array(batch->children[1], BATCH_SIZE, batch->child_buffers[1], 2);
+		batch->children[1].null_count = -1;
+		init_array(batch->dictionary, 4, batch->dictionary_buffers, 3);
+		batch->dictionary.null_count = 1;
+		batch->children[1].dictionary = &batch->dictionary;
+		batch->child_pointers[0] = &batch->children[0];
+		batch->child_pointers[1] = &batch->children[1];
+
+		init_array(*out, BATCH_SIZE, batch->root_buffers, 1);
+		out->n_children = 2;
+		out->children = batch->child_pointers;
+		out->release = release_batch;
+		out->private_data = batch;
+		my_stream.batch_idx++;
+		return 0;
+	}
+
+	static void release(ArrowArrayStream *stream) {
+		stream->release = nullptr;
+	}
+
+	static const char *get_last_error(ArrowArrayStream *stream) {
+		return "";
+	}
+
+	ArrowArrayStream stream;
+	ArrowSchema schemas[2];
+	ArrowSchema *schema_pointers[2];
+	ArrowSchema dictionary_schema;
+	// the last dictionary entry is NULL, and the bytes under it are not valid UTF-8
+	uint8_t dictionary_validity = 0x07;
+	int32_t dictionary_offsets[5] = {0, 5, 10, 30, 32};
+	const char *dictionary_data = "quackcrowda much longer string\xff\xfe";
+	idx_t batch_count;
+	idx_t batch_idx = 0;
+};
+
+TEST_CASE("Test parallel Arrow scan with dictionaries", "[arrow]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+
+	// 20 batches of 3000 rows
+	idx_t batch_count = 20;
+	int64_t row_count = batch_count * DictionaryArrowArrayStream::BATCH_SIZE;
+	DictionaryArrowArrayStream stream(batch_count);
+	auto result =
+	    con.TableFunction("arrow_scan", {Value::POINTER((uintptr_t)&stream.stream)})->Aggregate("d, count(*), sum(i)");
+	auto materialized = result->Order("1")->Execute();
+	REQUIRE(materialized->success);
+
+	// compute the expected groups
+	vector<int64_t> counts(4, 0), sums(4, 0);
+	for (int64_t i = 0; i < row_count; i++) {
+		auto group = i % 7 == 0 ? 3 : i % 3;
+		counts[group]++;
+		sums[group] += i;
+	}
+	// NULL sorts first, then "a much longer string", "crowd", "quack"
+	REQUIRE(CHECK_COLUMN(materialized, 0, {Value(), "a much longer string", "crowd", "quack"}));
+	REQUIRE(CHECK_COLUMN(materialized, 1,
+	                     {Value::BIGINT(counts[3]), Value::BIGINT(counts[2]), Value::BIGINT(counts[1]),
+	                      Value::BIGINT(counts[0])}));
+	REQUIRE(CHECK_COLUMN(
+	    materialized, 2,
+	    {Value::HUGEINT(sums[3]), Value::HUGEINT(sums[2]), Value::HUGEINT(sums[1]), Value::HUGEINT(sums[0])}));
+
+	// projection pushdown: only the integer column is read
+	DictionaryArrowArrayStream stream2(batch_count);
+	result = con.TableFunction("arrow_scan", {Value::POINTER((uintptr_t)&stream2.stream)})
+	             ->Filter("i % 2 = 0")
+	             ->Aggregate("count(*)");
+	auto count_result = result->Execute();
+	REQUIRE(CHECK_COLUMN(count_result, 0, {Value::BIGINT(row_count / 2)}));
+}
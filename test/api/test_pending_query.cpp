@@ -0,0 +1,105 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test executing a pending query", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT i FROM range(0, 1000000) tbl(i)"));
+
+	auto pending = con.PendingQuery("SELECT SUM(i), COUNT(*) FROM integers");
+	REQUIRE(pending->success);
+	REQUIRE(pending->GetTypes().size() == 2);
+	REQUIRE(pending->GetProgress() >= 0);
+	REQUIRE(pending->GetPipelineProgress().size() > 0);
+
+	// drive the execution from this thread until the result is ready
+	double last_progress = 0;
+	PendingExecutionResult execution_result;
+	do {
+		execution_result = pending->ExecuteTask();
+		auto progress = pending->GetProgress();
+		REQUIRE(progress >= last_progress);
+		last_progress = progress;
+	} while (execution_result == PendingExecutionResult::RESULT_NOT_READY);
+	REQUIRE(execution_result == PendingExecutionResult::RESULT_READY);
+	REQUIRE(pending->GetProgress() == 100);
+
+	auto result = pending->Execute();
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(499999500000)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {1000000}));
+	// a pending query can only be executed once
+	REQUIRE_THROWS(pending->Execute());
+
+	// execute without calling ExecuteTask
+	pending = con.PendingQuery("SELECT COUNT(*) FROM integers WHERE i % 2 = 0");
+	REQUIRE(pending->success);
+	result = pending->Execute();
+	REQUIRE(CHECK_COLUMN(result, 0, {500000}));
+
+	// errors are reported by the pending query
+	pending = con.PendingQuery("SELECT * FROM nonexisting_table");
+	REQUIRE(!pending->success);
+	pending = con.PendingQuery("SELECT 42; SELECT 84");
+	REQUIRE(!pending->success);
+	pending = con.PendingQuery("SELECT i::TINYINT FROM integers");
+	REQUIRE(pending->success);
+	result = pending->Execute();
+	REQUIRE_FAIL(result);
+	REQUIRE(!pending->success);
+}
+
+TEST_CASE("Test cancelling and abandoning pending queries", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT i FROM range(0, 1000000) tbl(i)"));
+
+	// cancel a running query
+	auto pending = con.PendingQuery("SELECT i, COUNT(*) FROM integers GROUP BY i ORDER BY i");
+	REQUIRE(pending->success);
+	pending->ExecuteTask();
+	pending->Cancel();
+	PendingExecutionResult execution_result;
+	do {
+		execution_result = pending->ExecuteTask();
+	} while (execution_result == PendingExecutionResult::RESULT_NOT_READY);
+	REQUIRE(execution_result == PendingExecutionResult::EXECUTION_ERROR);
+	REQUIRE(!pending->success);
+	REQUIRE_THROWS(pending->Execute());
+
+	// the connection can be used again afterwards
+	auto result = con.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+
+	// a pending query is abandoned when a new query is issued
+	pending = con.PendingQuery("SELECT i, COUNT(*) FROM integers GROUP BY i ORDER BY i");
+	REQUIRE(pending->success);
+	result = con.Query("SELECT MIN(i), MAX(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {0}));
+	REQUIRE(CHECK_COLUMN(result, 1, {999999}));
+	REQUIRE_THROWS(pending->ExecuteTask());
+
+	// abandoned modifications are rolled back
+	pending = con.PendingQuery("DELETE FROM integers WHERE i < 500000");
+	REQUIRE(pending->success);
+	pending->ExecuteTask();
+	pending.reset();
+	result = con.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+
+	// inside a transaction, abandoning a modification invalidates the transaction
+	REQUIRE_NO_FAIL(con.Query("BEGIN TRANSACTION"));
+	pending = con.PendingQuery("DELETE FROM integers WHERE i < 500000");
+	REQUIRE(pending->success);
+	pending.reset();
+	REQUIRE_FAIL(con.Query("SELECT COUNT(*) FROM integers"));
+	REQUIRE_NO_FAIL(con.Query("ROLLBACK"));
+	result = con.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1000000}));
+}
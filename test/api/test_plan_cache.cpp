@@ -0,0 +1,126 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+#include "duckdb/main/plan_cache.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test the plan cache", "[api]") {
+	unique_ptr<QueryResult> result;
+	DBConfig config;
+	config.plan_cache_size = 4;
+	DuckDB db(nullptr, &config);
+	Connection con(db);
+	auto &plan_cache = PlanCache::GetPlanCache(*con.context);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT i, i::VARCHAR AS s FROM range(0, 1000) tbl(i)"));
+
+	// queries that only differ in their literals share a plan
+	idx_t hits = plan_cache.hits;
+	result = con.Query("SELECT s FROM integers WHERE i + 1=42");
+	REQUIRE(CHECK_COLUMN(result, 0, {"41"}));
+	result = con.Query("SELECT s FROM integers WHERE i + 1=  43");
+	REQUIRE(CHECK_COLUMN(result, 0, {"42"}));
+	result = con.Query("SELECT s FROM integers WHERE i + 1=44");
+	REQUIRE(CHECK_COLUMN(result, 0, {"43"}));
+	REQUIRE(plan_cache.hits == hits + 2);
+	REQUIRE(plan_cache.Count() == 1);
+
+	// literals of a different type result in a different plan
+	result = con.Query("SELECT s FROM integers WHERE i + 1=42.0");
+	REQUIRE(CHECK_COLUMN(result, 0, {"41"}));
+	result = con.Query("SELECT i FROM integers WHERE s || 'x'='42x'");
+	REQUIRE(CHECK_COLUMN(result, 0, {42}));
+	result = con.Query("SELECT i FROM integers WHERE s || 'x'='43x'");
+	REQUIRE(CHECK_COLUMN(result, 0, {43}));
+	REQUIRE(plan_cache.hits == hits + 3);
+	REQUIRE(plan_cache.Count() == 3);
+
+	// IN lists and streaming results
+	result = con.SendQuery("SELECT i FROM integers WHERE i % 500 IN (1, 3, 5) ORDER BY i");
+	REQUIRE(CHECK_COLUMN(result, 0, {1, 3, 5, 501, 503, 505}));
+	result = con.SendQuery("SELECT i FROM integers WHERE i % 500 IN (2, 4, 6) ORDER BY i");
+	REQUIRE(CHECK_COLUMN(result, 0, {2, 4, 6, 502, 504, 506}));
+	REQUIRE(plan_cache.hits == hits + 4);
+
+	// the cache is bounded
+	result = con.Query("SELECT COUNT(*) FROM integers WHERE i - 1>500");
+	REQUIRE(CHECK_COLUMN(result, 0, {498}));
+	result = con.Query("SELECT MIN(i) FROM integers WHERE i - 1>500");
+	REQUIRE(CHECK_COLUMN(result, 0, {502}));
+	REQUIRE(plan_cache.Count() == 4);
+
+	// the plans are shared between connections
+	Connection con2(db);
+	hits = plan_cache.hits;
+	result = con2.Query("SELECT MIN(i) FROM integers WHERE i - 1>600");
+	REQUIRE(CHECK_COLUMN(result, 0, {602}));
+	REQUIRE(plan_cache.hits == hits + 1);
+
+	// literals compared against a column are part of the key: the cached plan keeps the filter pushed into the scan
+	con.EnableProfiling();
+	result = con.Query("SELECT s FROM integers WHERE i=42");
+	REQUIRE(CHECK_COLUMN(result, 0, {"42"}));
+	hits = plan_cache.hits;
+	result = con.Query("SELECT s FROM integers WHERE i=42");
+	REQUIRE(CHECK_COLUMN(result, 0, {"42"}));
+	REQUIRE(plan_cache.hits == hits + 1);
+	auto profile = con.GetProfilingInformation();
+	REQUIRE(profile.find("Filters:") != string::npos);
+	REQUIRE(profile.find("i=42") != string::npos);
+	REQUIRE(profile.find("FILTER") == string::npos);
+	result = con.Query("SELECT s FROM integers WHERE i=43");
+	REQUIRE(CHECK_COLUMN(result, 0, {"43"}));
+	REQUIRE(plan_cache.hits == hits + 1);
+	con.DisableProfiling();
+
+	// catalog changes invalidate the cached plans
+	result = con2.Query("SELECT MIN(s) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {"0"}));
+	REQUIRE_NO_FAIL(con.Query("DROP TABLE integers"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT i::VARCHAR AS i, i AS s FROM range(0, 10) tbl(i)"));
+	hits = plan_cache.hits;
+	result = con2.Query("SELECT MIN(s) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {0}));
+	REQUIRE(plan_cache.hits == hits);
+
+	// inserted data is visible to a cached plan
+	result = con.Query("SELECT COUNT(*) FROM integers WHERE s IS NULL OR s=5");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES ('x', NULL)"));
+	hits = plan_cache.hits;
+	result = con.Query("SELECT COUNT(*) FROM integers WHERE s IS NULL OR s=5");
+	REQUIRE(CHECK_COLUMN(result, 0, {2}));
+	REQUIRE(plan_cache.hits == hits + 1);
+
+	// disabling the cache removes all plans
+	REQUIRE_NO_FAIL(con.Query("PRAGMA plan_cache_size=0"));
+	REQUIRE(plan_cache.Count() == 0);
+	hits = plan_cache.hits;
+	result = con.Query("SELECT COUNT(*) FROM integers WHERE s IS NULL OR s=6");
+	REQUIRE(CHECK_COLUMN(result, 0, {2}));
+	REQUIRE(plan_cache.hits == hits);
+}
+
+TEST_CASE("Test the plan cache with temporary tables", "[api]") {
+	unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+	Connection con2(db);
+
+	REQUIRE_NO_FAIL(con.Query("PRAGMA plan_cache_size=10"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE t AS SELECT 1 AS i"));
+	result = con.Query("SELECT i FROM t WHERE i=1");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+
+	// plans bound in a connection with temporary objects are private to that connection
+	REQUIRE_NO_FAIL(con2.Query("CREATE TEMPORARY TABLE tmp AS SELECT 2 AS i"));
+	result = con2.Query("SELECT i FROM tmp WHERE i=2");
+	REQUIRE(CHECK_COLUMN(result, 0, {2}));
+	result = con2.Query("SELECT i FROM tmp WHERE i=2");
+	REQUIRE(CHECK_COLUMN(result, 0, {2}));
+	result = con.Query("SELECT i FROM t WHERE i=1");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	result = con2.Query("SELECT i FROM t WHERE i=1");
+	REQUIRE(CHECK_COLUMN(result, 0, {1}));
+}
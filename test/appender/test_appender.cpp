@@ -267,3 +267,105 @@ TEST_CASE("Test appender with string lengths", "[appender]") {
 	result = con.Query("SELECT * FROM my_table");
 	REQUIRE(CHECK_COLUMN(result, 0, {"asd"}));
 }
+
+TEST_CASE("Test appending data chunks and raw columns", "[appender]") {
+	unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER, s VARCHAR)"));
+	{
+		Appender appender(con, "integers");
+		// rows appended through the row interface are flushed before the chunk
+		appender.AppendRow(-1, "first");
+
+		DataChunk chunk;
+		vector<LogicalType> types{LogicalType::INTEGER, LogicalType::VARCHAR};
+		chunk.Initialize(types);
+		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+			chunk.SetValue(0, i, Value::INTEGER(i));
+			chunk.SetValue(1, i, i % 2 == 0 ? Value("a long string value " + to_string(i)) : Value());
+		}
+		chunk.SetCardinality(STANDARD_VECTOR_SIZE);
+		appender.AppendDataChunk(chunk);
+
+		// chunks with mismatching types are rejected
+		DataChunk wrong_chunk;
+		vector<LogicalType> wrong_types{LogicalType::BIGINT, LogicalType::VARCHAR};
+		wrong_chunk.Initialize(wrong_types);
+		REQUIRE_THROWS(appender.AppendDataChunk(wrong_chunk));
+
+		// raw arrays, spanning multiple vectors, with a validity mask on the first column
+		idx_t count = 3000;
+		vector<int32_t> ints;
+		vector<string_t> strings;
+		vector<uint8_t> validity((count + 7) / 8, 0xFF);
+		for (idx_t i = 0; i < count; i++) {
+			ints.push_back((int32_t)i);
+			strings.push_back(string_t("raw"));
+			if (i % 3 == 0) {
+				validity[i / 8] &= ~(1 << (i % 8));
+			}
+		}
+		appender.AppendColumns(count, {(const_data_ptr_t)ints.data(), (const_data_ptr_t)strings.data()},
+		                       {validity.data(), nullptr});
+		appender.Close();
+	}
+	result = con.Query("SELECT COUNT(*), COUNT(i), COUNT(s) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {1 + STANDARD_VECTOR_SIZE + 3000}));
+	REQUIRE(CHECK_COLUMN(result, 1, {1 + STANDARD_VECTOR_SIZE + 2000}));
+	REQUIRE(CHECK_COLUMN(result, 2, {1 + STANDARD_VECTOR_SIZE / 2 + 3000}));
+
+	result = con.Query("SELECT i, s FROM integers WHERE s NOT IN ('raw') ORDER BY i LIMIT 3");
+	REQUIRE(CHECK_COLUMN(result, 0, {-1, 0, 2}));
+	REQUIRE(CHECK_COLUMN(result, 1, {"first", "a long string value 0", "a long string value 2"}));
+
+	result = con.Query("SELECT SUM(i) FROM integers WHERE s = 'raw'");
+	REQUIRE(CHECK_COLUMN(result, 0, {3000000}));
+}
+
+TEST_CASE("Test the automatic flush of the appender", "[appender]") {
+	unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+	{
+		// by default the appender is flushed after every STANDARD_VECTOR_SIZE rows
+		Appender appender(con, "integers");
+		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE + 1; i++) {
+			appender.AppendRow((int32_t)i);
+		}
+		result = con.Query("SELECT COUNT(*) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {STANDARD_VECTOR_SIZE}));
+		appender.Close();
+	}
+	REQUIRE_NO_FAIL(con.Query("DELETE FROM integers"));
+	{
+		// a larger flush count keeps more rows buffered
+		Appender appender(con, "integers");
+		appender.SetFlushCount(3 * STANDARD_VECTOR_SIZE);
+		for (idx_t i = 0; i < 2 * STANDARD_VECTOR_SIZE; i++) {
+			appender.AppendRow((int32_t)i);
+		}
+		result = con.Query("SELECT COUNT(*) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {0}));
+		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+			appender.AppendRow((int32_t)i);
+		}
+		result = con.Query("SELECT COUNT(*) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {3 * STANDARD_VECTOR_SIZE}));
+
+		// a smaller flush count flushes before the internal chunk is full
+		appender.SetFlushCount(10);
+		for (idx_t i = 0; i < 25; i++) {
+			appender.AppendRow((int32_t)i);
+		}
+		result = con.Query("SELECT COUNT(*) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {3 * STANDARD_VECTOR_SIZE + 20}));
+		REQUIRE_THROWS(appender.SetFlushCount(0));
+		appender.Close();
+	}
+	result = con.Query("SELECT COUNT(*) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {3 * STANDARD_VECTOR_SIZE + 25}));
+}
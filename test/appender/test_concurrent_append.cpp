@@ -52,3 +52,35 @@ TEST_CASE("Test concurrent appends", "[appender][.]") {
 	result = con.Query("SELECT COUNT(*) FROM integers");
 	REQUIRE(CHECK_COLUMN(result, 0, {THREAD_COUNT * INSERT_ELEMENTS}));
 }
+
+static void append_chunks_to_integers(DuckDB *db, size_t threadnr) {
+	REQUIRE(db);
+	Connection con(*db);
+
+	Appender appender(con, "integers");
+	vector<int32_t> values(INSERT_ELEMENTS, threadnr);
+	vector<const uint8_t *> validity{nullptr};
+	for (size_t i = 0; i < 100; i++) {
+		appender.AppendColumns(INSERT_ELEMENTS, {(const_data_ptr_t)values.data()}, validity);
+	}
+	appender.Close();
+}
+
+TEST_CASE("Test concurrent column appends", "[appender]") {
+	unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+
+	thread threads[THREAD_COUNT];
+	for (size_t i = 0; i < THREAD_COUNT; i++) {
+		threads[i] = thread(append_chunks_to_integers, &db, i);
+	}
+	for (size_t i = 0; i < THREAD_COUNT; i++) {
+		threads[i].join();
+	}
+	result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {THREAD_COUNT * INSERT_ELEMENTS * 100}));
+	REQUIRE(CHECK_COLUMN(result, 1, {INSERT_ELEMENTS * 100 * (THREAD_COUNT * (THREAD_COUNT - 1) / 2)}));
+}
@@ -2,6 +2,7 @@
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/fstream_util.hpp"
 #include "duckdb/common/gzip_stream.hpp"
+#include "miniz.hpp"
 #include "test_helpers.hpp"
 
 using namespace duckdb;
@@ -34,3 +35,77 @@ TEST_CASE("Test basic stream read from GZIP files", "[gzip_stream]") {
 	GzipStream gz3("XXX_THIS_DOES_NOT_EXIST");
 	REQUIRE_THROWS(s = string(std::istreambuf_iterator<char>(gz3), {}));
 }
+
+static string GenerateTestData(idx_t lines) {
+	string data;
+	for (idx_t i = 0; i < lines; i++) {
+		data += to_string(i) + "|" + to_string(i * 2654435761 % 1000003) + "|hello world " + to_string(i % 13) + "\n";
+	}
+	return data;
+}
+
+//! Compresses the data into a gzip member; a BGZF member stores its size in the extra field of the header
+static string CompressGzipMember(const string &data, bool bgzf) {
+	duckdb_miniz::mz_stream stream;
+	memset(&stream, 0, sizeof(stream));
+	REQUIRE(duckdb_miniz::mz_deflateInit2(&stream, duckdb_miniz::MZ_DEFAULT_LEVEL, MZ_DEFLATED,
+	                                      -MZ_DEFAULT_WINDOW_BITS, 9, duckdb_miniz::MZ_DEFAULT_STRATEGY) ==
+	        duckdb_miniz::MZ_OK);
+	string compressed(data.size() + data.size() / 10 + 1024, '\0');
+	stream.next_in = (const unsigned char *)data.c_str();
+	stream.avail_in = data.size();
+	stream.next_out = (unsigned char *)&compressed[0];
+	stream.avail_out = compressed.size();
+	REQUIRE(duckdb_miniz::mz_deflate(&stream, duckdb_miniz::MZ_FINISH) == duckdb_miniz::MZ_STREAM_END);
+	compressed.resize(stream.total_out);
+	duckdb_miniz::mz_deflateEnd(&stream);
+
+	string result = {'\x1f', '\x8b', '\x08', bgzf ? '\x04' : '\x00', 0, 0, 0, 0, 0, '\xff'};
+	if (bgzf) {
+		idx_t member_size = 18 + compressed.size() + 8 - 1;
+		result += string({6, 0, 'B', 'C', 2, 0, char(member_size & 0xFF), char(member_size >> 8)});
+	}
+	result += compressed;
+	uint32_t footer[2];
+	footer[0] = duckdb_miniz::mz_crc32(MZ_CRC32_INIT, (const unsigned char *)data.c_str(), data.size());
+	footer[1] = data.size();
+	result += string((char *)footer, sizeof(footer));
+	return result;
+}
+
+static void WriteTestFile(const string &path, const string &contents) {
+	ofstream ofp(path, ios::out | ios::binary);
+	ofp.write(contents.c_str(), contents.size());
+	ofp.close();
+}
+
+TEST_CASE("Test reading multi-member GZIP files", "[gzip_stream]") {
+	string gzip_file_path = TestCreatePath("multi_member.txt.gz");
+	auto data = GenerateTestData(200000);
+
+	for (auto bgzf : {false, true}) {
+		// BGZF members are limited to 64KB
+		idx_t member_size = bgzf ? 32768 : 500000;
+		string compressed;
+		for (idx_t i = 0; i < data.size(); i += member_size) {
+			compressed += CompressGzipMember(data.substr(i, member_size), bgzf);
+		}
+		WriteTestFile(gzip_file_path, compressed);
+		for (idx_t thread_count : {0, 1, 4}) {
+			GzipStream gz(gzip_file_path, thread_count);
+			std::string s(istreambuf_iterator<char>(gz), {});
+			REQUIRE(s == data);
+		}
+
+		// data that follows the last member is ignored
+		WriteTestFile(gzip_file_path, compressed + string(100, '\0'));
+		GzipStream gz(gzip_file_path, 4);
+		std::string s(istreambuf_iterator<char>(gz), {});
+		REQUIRE(s == data);
+
+		// a truncated member is an error
+		WriteTestFile(gzip_file_path, compressed.substr(0, compressed.size() - 100));
+		GzipStream gz2(gzip_file_path, 4);
+		REQUIRE_THROWS(s = string(std::istreambuf_iterator<char>(gz2), {}));
+	}
+}
@@ -0,0 +1,70 @@
+#include "catch.hpp"
+#include "duckdb/common/zstd_stream.hpp"
+#include "test_helpers.hpp"
+#include "zstd.h"
+
+#include <fstream>
+
+using namespace duckdb;
+using namespace std;
+
+static string CompressZstdFrame(const string &data) {
+	string compressed(duckdb_zstd::ZSTD_compressBound(data.size()), '\0');
+	auto compressed_size = duckdb_zstd::ZSTD_compress(&compressed[0], compressed.size(), data.c_str(), data.size(), 1);
+	REQUIRE(!duckdb_zstd::ZSTD_isError(compressed_size));
+	compressed.resize(compressed_size);
+	return compressed;
+}
+
+static void WriteZstdTestFile(const string &path, const string &contents) {
+	ofstream ofp(path, ios::out | ios::binary);
+	ofp.write(contents.c_str(), contents.size());
+	ofp.close();
+}
+
+TEST_CASE("Test reading ZSTD files", "[zstd_stream]") {
+	string zstd_file_path = TestCreatePath("test.txt.zst");
+
+	string data;
+	for (idx_t i = 0; i < 200000; i++) {
+		data += to_string(i) + "|" + to_string(i * 2654435761 % 1000003) + "|hello world " + to_string(i % 13) + "\n";
+	}
+	// a file with many frames, which are decompressed in parallel
+	string compressed;
+	for (idx_t i = 0; i < data.size(); i += 100000) {
+		compressed += CompressZstdFrame(data.substr(i, 100000));
+	}
+	WriteZstdTestFile(zstd_file_path, compressed);
+	for (idx_t thread_count : {0, 1, 4}) {
+		ZstdStream zstd(zstd_file_path, thread_count);
+		std::string s(istreambuf_iterator<char>(zstd), {});
+		REQUIRE(s == data);
+	}
+
+	// a frame that is too large to be buffered is decompressed in order
+	string random_data;
+	uint64_t state = 42;
+	while (random_data.size() < DecompressionStreamBuf::MAXIMUM_UNIT_SIZE + 1000000) {
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		random_data += char(state >> 56);
+	}
+	auto large_frame = CompressZstdFrame(random_data);
+	REQUIRE(large_frame.size() > DecompressionStreamBuf::MAXIMUM_UNIT_SIZE);
+	WriteZstdTestFile(zstd_file_path, compressed + large_frame + compressed);
+	{
+		ZstdStream zstd(zstd_file_path, 4);
+		std::string s(istreambuf_iterator<char>(zstd), {});
+		REQUIRE(s == data + random_data + data);
+	}
+
+	// a truncated frame is an error
+	WriteZstdTestFile(zstd_file_path, compressed.substr(0, compressed.size() - 100));
+	ZstdStream zstd2(zstd_file_path, 4);
+	string s;
+	REQUIRE_THROWS(s = string(std::istreambuf_iterator<char>(zstd2), {}));
+
+	// a file that is not compressed with zstd
+	WriteZstdTestFile(zstd_file_path, data);
+	ZstdStream zstd3(zstd_file_path, 4);
+	REQUIRE_THROWS(s = string(std::istreambuf_iterator<char>(zstd3), {}));
+}
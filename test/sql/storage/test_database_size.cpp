@@ -71,3 +71,98 @@ TEST_CASE("Test that database size does not grow after many checkpoints", "[stor
 	REQUIRE(new_size <= size * 3);
 	DeleteDatabase(storage_database);
 }
+
+TEST_CASE("Test that the database file shrinks after deleting rows", "[storage]") {
+	FileSystem fs;
+	auto config = GetTestConfig();
+	unique_ptr<QueryResult> result;
+	auto storage_database = TestCreatePath("dbsize_shrink_test");
+
+	// make sure the database does not exist
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE test AS SELECT i AS a, i % 7 AS b FROM range(0, 1000000, 1) t1(i)"));
+	}
+	// force a checkpoint by reloading
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+	}
+	int64_t size;
+	{
+		auto handle = fs.OpenFile(storage_database, FileFlags::FILE_FLAGS_READ);
+		size = fs.GetFileSize(*handle);
+		REQUIRE(size >= 0);
+	}
+	// delete most of the rows
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("DELETE FROM test WHERE a >= 50000"));
+		REQUIRE_NO_FAIL(con.Query("VACUUM"));
+	}
+	// the first checkpoint writes the remaining rows after the blocks of the previous checkpoint, the second one
+	// writes them to the start of the file and truncates the blocks after them
+	for (idx_t i = 0; i < 2; i++) {
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO test VALUES (-1, -1)"));
+	}
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), SUM(a) FROM test");
+		REQUIRE(CHECK_COLUMN(result, 0, {50002}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(1249974998)}));
+	}
+	int64_t new_size;
+	{
+		auto handle = fs.OpenFile(storage_database, FileFlags::FILE_FLAGS_READ);
+		new_size = fs.GetFileSize(*handle);
+		REQUIRE(new_size >= 0);
+	}
+	REQUIRE(new_size * 4 < size);
+	DeleteDatabase(storage_database);
+}
+
+TEST_CASE("Test that VACUUM checkpoints the database on the next startup", "[storage]") {
+	auto config = GetTestConfig();
+	// the WAL never grows large enough to be checkpointed on its own
+	config->checkpoint_wal_size = 1 << 30;
+	unique_ptr<QueryResult> result;
+	auto storage_database = TestCreatePath("vacuum_checkpoint_test");
+
+	// make sure the database does not exist
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE test AS SELECT i FROM range(0, 1000, 1) t1(i)"));
+		REQUIRE_NO_FAIL(con.Query("DELETE FROM test WHERE i % 2 = 0"));
+		// a VACUUM that is rolled back does not request a checkpoint
+		REQUIRE_NO_FAIL(con.Query("BEGIN TRANSACTION"));
+		REQUIRE_NO_FAIL(con.Query("VACUUM"));
+		REQUIRE_NO_FAIL(con.Query("ROLLBACK"));
+	}
+	{
+		// the WAL was replayed without a checkpoint: the row ids are unchanged
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), MAX(rowid) FROM test");
+		REQUIRE(CHECK_COLUMN(result, 0, {500}));
+		REQUIRE(CHECK_COLUMN(result, 1, {999}));
+		REQUIRE_NO_FAIL(con.Query("VACUUM"));
+	}
+	{
+		// the checkpoint only wrote the remaining rows
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), SUM(i), MAX(rowid) FROM test");
+		REQUIRE(CHECK_COLUMN(result, 0, {500}));
+		REQUIRE(CHECK_COLUMN(result, 1, {250000}));
+		REQUIRE(CHECK_COLUMN(result, 2, {499}));
+	}
+	DeleteDatabase(storage_database);
+}
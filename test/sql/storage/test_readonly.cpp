@@ -6,7 +6,7 @@ using namespace std;
 
 namespace duckdb {
 
-class ReadOnlyFileSystem : public FileSystem {
+class ReadOnlyFileSystem : public LocalFileSystem {
 	unique_ptr<FileHandle> OpenFile(const char *path, uint8_t flags, FileLockType lock_type) override {
 		if (flags & FileFlags::FILE_FLAGS_WRITE) {
 			throw Exception("RO file system");
@@ -28,6 +28,31 @@ class ReadOnlyFileSystem : public FileSystem {
 	}
 };
 
+class BlockReadCountingFileSystem : public ReadOnlyFileSystem {
+public:
+	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override {
+		if (nr_bytes == Storage::BLOCK_ALLOC_SIZE) {
+			block_reads++;
+		}
+		ReadOnlyFileSystem::Read(handle, buffer, nr_bytes, location);
+	}
+
+	idx_t block_reads = 0;
+};
+
+//! A file system that only implements the generic FileSystem interface, and therefore cannot memory map files
+class UnmappedFileSystem : public FileSystem {
+public:
+	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override {
+		if (nr_bytes == Storage::BLOCK_ALLOC_SIZE) {
+			block_reads++;
+		}
+		FileSystem::Read(handle, buffer, nr_bytes, location);
+	}
+
+	idx_t block_reads = 0;
+};
+
 TEST_CASE("Test read only storage", "[storage]") {
 	unique_ptr<QueryResult> result;
 	auto storage_database = TestCreatePath("storage_test");
@@ -64,4 +89,85 @@ TEST_CASE("Test read only storage", "[storage]") {
 	DeleteDatabase(storage_database);
 }
 
+TEST_CASE("Test memory mapped read only storage", "[storage]") {
+	unique_ptr<QueryResult> result;
+	auto storage_database = TestCreatePath("storage_test");
+	DeleteDatabase(storage_database);
+
+	{
+		DuckDB db(storage_database);
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE test (a INTEGER, b VARCHAR)"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO test SELECT i, 'string' || i FROM range(0, 100000, 1) t1(i)"));
+		REQUIRE_NO_FAIL(con.Query("DELETE FROM test WHERE a % 10 = 0"));
+	}
+	// force a checkpoint by reloading, the update remains in the WAL and is replayed on top of the mapped blocks
+	{
+		DuckDB db(storage_database);
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("UPDATE test SET b = 'updated' WHERE a = 1"));
+	}
+	for (auto use_mmap : {true, false}) {
+		auto fs = make_unique<BlockReadCountingFileSystem>();
+		auto &counting_fs = *fs;
+		DBConfig config;
+		config.file_system = move(fs);
+		config.access_mode = AccessMode::READ_ONLY;
+		config.use_temporary_directory = false;
+		config.use_mmap = use_mmap;
+		DuckDB db(storage_database, &config);
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), SUM(a), MIN(b), MAX(b) FROM test");
+		REQUIRE(CHECK_COLUMN(result, 0, {90000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {4500000000}));
+		REQUIRE(CHECK_COLUMN(result, 2, {"string10001"}));
+		REQUIRE(CHECK_COLUMN(result, 3, {"updated"}));
+		result = con.Query("SELECT b FROM test WHERE a = 99999");
+		REQUIRE(CHECK_COLUMN(result, 0, {"string99999"}));
+		// with a memory mapped file no blocks are read into buffers
+		if (use_mmap) {
+			REQUIRE(counting_fs.block_reads == 0);
+		} else {
+			REQUIRE(counting_fs.block_reads > 0);
+		}
+	}
+	DeleteDatabase(storage_database);
+}
+
+TEST_CASE("Test read only storage on a file system that cannot memory map files", "[storage]") {
+	unique_ptr<QueryResult> result;
+	auto storage_database = TestCreatePath("storage_test");
+	DeleteDatabase(storage_database);
+
+	{
+		DuckDB db(storage_database);
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE test (a INTEGER)"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO test SELECT i FROM range(0, 100000, 1) t1(i)"));
+	}
+	// reload to checkpoint the data into the database file
+	{
+		DBConfig config;
+		config.checkpoint_wal_size = 0;
+		DuckDB db(storage_database, &config);
+	}
+	{
+		auto fs = make_unique<UnmappedFileSystem>();
+		auto &unmapped_fs = *fs;
+		DBConfig config;
+		config.file_system = move(fs);
+		config.access_mode = AccessMode::READ_ONLY;
+		config.use_temporary_directory = false;
+		config.use_mmap = true;
+		DuckDB db(storage_database, &config);
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), SUM(a) FROM test");
+		REQUIRE(CHECK_COLUMN(result, 0, {100000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {4999950000}));
+		// the blocks are read instead
+		REQUIRE(unmapped_fs.block_reads > 0);
+	}
+	DeleteDatabase(storage_database);
+}
+
 } // namespace duckdb
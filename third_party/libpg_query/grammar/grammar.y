@@ -92,8 +92,10 @@
  * precedence as LIKE; otherwise they'd effectively have the same precedence
  * as NOT, at least with respect to their left-hand subexpression.
  * NULLS_LA and WITH_LA are needed to make the grammar LALR(1).
+ * ASOF_LA is needed so that ASOF can remain an unreserved keyword: a table
+ * alias named asof can otherwise not be distinguished from ASOF JOIN.
  */
-%token		NOT_LA NULLS_LA WITH_LA
+%token		NOT_LA NULLS_LA WITH_LA ASOF_LA
 
 
 /* Precedence: lowest to highest */
@@ -155,7 +157,7 @@
  * They wouldn't be given a precedence at all, were it not that we need
  * left-associativity among the JOIN rules themselves.
  */
-%left		JOIN CROSS LEFT FULL RIGHT INNER_P NATURAL
+%left		JOIN CROSS LEFT FULL RIGHT INNER_P NATURAL ASOF_LA
 /* kluge to keep from causing shift/reduce conflicts */
 %right		PRESERVE STRIP_P
 
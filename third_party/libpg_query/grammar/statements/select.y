@@ -888,6 +888,37 @@ joined_table:
 					n->location = @2;
 					$$ = n;
 				}
+			| table_ref ASOF_LA join_type JOIN table_ref join_qual
+				{
+					PGJoinExpr *n = makeNode(PGJoinExpr);
+					n->jointype = $3;
+					n->isNatural = false;
+					n->isAsof = true;
+					n->larg = $1;
+					n->rarg = $5;
+					if ($6 != NULL && IsA($6, PGList))
+						n->usingClause = (PGList *) $6; /* USING clause */
+					else
+						n->quals = $6; /* ON clause */
+					n->location = @2;
+					$$ = n;
+				}
+			| table_ref ASOF_LA JOIN table_ref join_qual
+				{
+					/* letting join_type reduce to empty doesn't work */
+					PGJoinExpr *n = makeNode(PGJoinExpr);
+					n->jointype = PG_JOIN_INNER;
+					n->isNatural = false;
+					n->isAsof = true;
+					n->larg = $1;
+					n->rarg = $4;
+					if ($5 != NULL && IsA($5, PGList))
+						n->usingClause = (PGList *) $5; /* USING clause */
+					else
+						n->quals = $5; /* ON clause */
+					n->location = @2;
+					$$ = n;
+				}
 			| table_ref NATURAL join_type JOIN table_ref
 				{
 					PGJoinExpr *n = makeNode(PGJoinExpr);
@@ -189,6 +189,9 @@ int base_yylex(YYSTYPE *lvalp, YYLTYPE *llocp, core_yyscan_t yyscanner) {
 	case WITH:
 		cur_token_length = 4;
 		break;
+	case ASOF:
+		cur_token_length = 4;
+		break;
 	default:
 		return cur_token;
 	}
@@ -257,6 +260,17 @@ int base_yylex(YYSTYPE *lvalp, YYLTYPE *llocp, core_yyscan_t yyscanner) {
 			break;
 		}
 		break;
+
+	case ASOF:
+		/* Replace ASOF by ASOF_LA if it's followed by JOIN, LEFT or INNER */
+		switch (next_token) {
+		case JOIN:
+		case LEFT:
+		case INNER_P:
+			cur_token = ASOF_LA;
+			break;
+		}
+		break;
 	}
 
 	return cur_token;
@@ -17,8 +17,12 @@
 #include "duckdb/parser/parser.hpp"
 #include "extension/extension_helper.hpp"
 #include "duckdb/parallel/parallel_state.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/string_heap.hpp"
 #include "utf8proc_wrapper.hpp"
 
+#include <condition_variable>
 #include <random>
 #include <stdlib.h>
 
@@ -214,16 +218,15 @@ static bool ConvertColumn(idx_t target_offset, data_ptr_t target_data, bool *tar
 				out_ptr[offset] = CONVERT::template null_value<NUMPY_T>();
 			} else {
 				out_ptr[offset] = CONVERT::template convert_value<DUCKDB_T, NUMPY_T>(src_ptr[src_idx]);
-				target_mask[offset] = false;
 			}
 		}
 		return true;
 	} else {
+		// the mask is zero-initialized: nothing to mark
 		for (idx_t i = 0; i < count; i++) {
 			idx_t src_idx = idata.sel->get_index(i);
 			idx_t offset = target_offset + i;
 			out_ptr[offset] = CONVERT::template convert_value<DUCKDB_T, NUMPY_T>(src_ptr[src_idx]);
-			target_mask[offset] = false;
 		}
 		return false;
 	}
@@ -251,7 +254,6 @@ static bool ConvertDecimalInternal(idx_t target_offset, data_ptr_t target_data,
 			} else {
 				out_ptr[offset] =
 				    duckdb_py_convert::IntegralConvert::convert_value<DUCKDB_T, double>(src_ptr[src_idx]) / division;
-				target_mask[offset] = false;
 			}
 		}
 		return true;
@@ -261,7 +263,6 @@ static bool ConvertDecimalInternal(idx_t target_offset, data_ptr_t target_data,
 			idx_t offset = target_offset + i;
 			out_ptr[offset] =
 			    duckdb_py_convert::IntegralConvert::convert_value<DUCKDB_T, double>(src_ptr[src_idx]) / division;
-			target_mask[offset] = false;
 		}
 		return false;
 	}
@@ -285,6 +286,59 @@ static bool ConvertDecimal(LogicalType &decimal_type, idx_t target_offset, data_
 	}
 }
 
+struct StringInternHash {
+	size_t operator()(const string_t &val) const {
+		return Hash(val.GetDataUnsafe(), val.GetSize());
+	}
+};
+
+struct StringInternEquality {
+	bool operator()(const string_t &a, const string_t &b) const {
+		return a.GetSize() == b.GetSize() && memcmp(a.GetDataUnsafe(), b.GetDataUnsafe(), a.GetSize()) == 0;
+	}
+};
+
+//! Interns the Python strings created for a column, so that repeated values share a single Python object
+struct StringInternTable {
+	//! The maximum amount of distinct strings that are interned per column
+	static constexpr idx_t MAX_INTERNED_STRINGS = 65536;
+
+	StringHeap heap;
+	//! Maps the strings to their Python objects; the references are owned by the NumPy array
+	unordered_map<string_t, PyObject *, StringInternHash, StringInternEquality> strings;
+
+	PyObject *Convert(string_t val) {
+		auto entry = strings.find(val);
+		if (entry != strings.end()) {
+			Py_INCREF(entry->second);
+			return entry->second;
+		}
+		auto result = duckdb_py_convert::StringConvert::convert_value<string_t, PyObject *>(val);
+		if (strings.size() < MAX_INTERNED_STRINGS) {
+			strings[heap.AddString(val)] = result;
+		}
+		return result;
+	}
+};
+
+static bool ConvertStrings(idx_t target_offset, data_ptr_t target_data, bool *target_mask, VectorData &idata,
+                           idx_t count, StringInternTable &intern_table) {
+	auto src_ptr = (string_t *)idata.data;
+	auto out_ptr = (PyObject **)target_data;
+	bool has_null = idata.nullmask && idata.nullmask->any();
+	for (idx_t i = 0; i < count; i++) {
+		idx_t src_idx = idata.sel->get_index(i);
+		idx_t offset = target_offset + i;
+		if (has_null && (*idata.nullmask)[src_idx]) {
+			target_mask[offset] = true;
+			out_ptr[offset] = nullptr;
+		} else {
+			out_ptr[offset] = intern_table.Convert(src_ptr[src_idx]);
+		}
+	}
+	return has_null;
+}
+
 struct RawArrayWrapper {
 	RawArrayWrapper(LogicalType type);
 
@@ -292,24 +346,29 @@ struct RawArrayWrapper {
 	data_ptr_t data;
 	LogicalType type;
 	idx_t type_width;
-	idx_t count;
 
 public:
 	void Initialize(idx_t capacity);
 	void Resize(idx_t new_capacity);
-	void Append(idx_t current_offset, Vector &input, idx_t count);
 };
 
 struct ArrayWrapper {
 	ArrayWrapper(LogicalType type);
 
 	unique_ptr<RawArrayWrapper> data;
+	//! The NULL mask of the array, which is only allocated once the column turns out to contain NULL values
 	unique_ptr<RawArrayWrapper> mask;
-	bool requires_mask;
+	idx_t capacity;
+	//! The interned strings of a VARCHAR column
+	unique_ptr<StringInternTable> intern_table;
 
 public:
 	void Initialize(idx_t capacity);
 	void Resize(idx_t new_capacity);
+	//! Allocates the (zero-initialized) NULL mask
+	void InitializeMask();
+	//! Whether or not the conversion of this column creates Python objects, which requires holding the GIL
+	bool CreatesPythonObjects();
 	void Append(idx_t current_offset, Vector &input, idx_t count);
 	py::object ToArray(idx_t count);
 };
@@ -319,6 +378,10 @@ public:
 	NumpyResultConversion(vector<LogicalType> &types, idx_t initial_capacity);
 
 	void Append(DataChunk &chunk);
+	//! Converts all chunks of a materialized result into the (pre-allocated) arrays. Columns that do not create Python
+	//! objects are converted in parallel on the task scheduler; the calling thread, which holds the GIL, creates the
+	//! Python objects of the remaining columns in the meantime.
+	void AppendParallel(ClientContext &context, ChunkCollection &collection);
 
 	py::object ToArray(idx_t col_idx) {
 		return owned_data[col_idx].ToArray(count);
@@ -333,7 +396,7 @@ private:
 	idx_t capacity;
 };
 
-RawArrayWrapper::RawArrayWrapper(LogicalType type) : data(nullptr), type(type), count(0) {
+RawArrayWrapper::RawArrayWrapper(LogicalType type) : data(nullptr), type(type) {
 	switch (type.id()) {
 	case LogicalTypeId::BOOLEAN:
 		type_width = sizeof(bool);
@@ -432,97 +495,120 @@ void RawArrayWrapper::Resize(idx_t new_capacity) {
 	data = (data_ptr_t)array.mutable_data();
 }
 
-ArrayWrapper::ArrayWrapper(LogicalType type) : requires_mask(false) {
+ArrayWrapper::ArrayWrapper(LogicalType type) : capacity(0) {
 	data = make_unique<RawArrayWrapper>(type);
-	mask = make_unique<RawArrayWrapper>(LogicalType::BOOLEAN);
+	if (type.id() == LogicalTypeId::VARCHAR) {
+		intern_table = make_unique<StringInternTable>();
+	}
 }
 
 void ArrayWrapper::Initialize(idx_t capacity) {
 	data->Initialize(capacity);
-	mask->Initialize(capacity);
+	this->capacity = capacity;
 }
 
 void ArrayWrapper::Resize(idx_t new_capacity) {
 	data->Resize(new_capacity);
-	mask->Resize(new_capacity);
+	if (mask) {
+		// NumPy fills the new entries with zeros
+		mask->Resize(new_capacity);
+	}
+	capacity = new_capacity;
+}
+
+void ArrayWrapper::InitializeMask() {
+	if (mask) {
+		return;
+	}
+	mask = make_unique<RawArrayWrapper>(LogicalType::BOOLEAN);
+	mask->Initialize(capacity);
+	memset(mask->data, 0, capacity * sizeof(bool));
+}
+
+bool ArrayWrapper::CreatesPythonObjects() {
+	switch (data->type.id()) {
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+		return true;
+	default:
+		return false;
+	}
 }
 
 void ArrayWrapper::Append(idx_t current_offset, Vector &input, idx_t count) {
 	auto dataptr = data->data;
-	auto maskptr = (bool *)mask->data;
 	D_ASSERT(dataptr);
-	D_ASSERT(maskptr);
 	D_ASSERT(input.type == data->type);
-	bool may_have_null;
 
 	VectorData idata;
 	input.Orrify(count, idata);
+	if (idata.nullmask && idata.nullmask->any()) {
+		// the column might contain NULL values: we need a mask
+		InitializeMask();
+	}
+	auto maskptr = mask ? (bool *)mask->data : nullptr;
 	switch (input.type.id()) {
 	case LogicalTypeId::BOOLEAN:
-		may_have_null = ConvertColumnRegular<bool>(current_offset, dataptr, maskptr, idata, count);
+		ConvertColumnRegular<bool>(current_offset, dataptr, maskptr, idata, count);
 		break;
 	case LogicalTypeId::TINYINT:
-		may_have_null = ConvertColumnRegular<int8_t>(current_offset, dataptr, maskptr, idata, count);
+		ConvertColumnRegular<int8_t>(current_offset, dataptr, maskptr, idata, count);
 		break;
 	case LogicalTypeId::SMALLINT:
-		may_have_null = ConvertColumnRegular<int16_t>(current_offset, dataptr, maskptr, idata, count);
+		ConvertColumnRegular<int16_t>(current_offset, dataptr, maskptr, idata, count);
 		break;
 	case LogicalTypeId::INTEGER:
-		may_have_null = ConvertColumnRegular<int32_t>(current_offset, dataptr, maskptr, idata, count);
+		ConvertColumnRegular<int32_t>(current_offset, dataptr, maskptr, idata, count);
 		break;
 	case LogicalTypeId::BIGINT:
-		may_have_null = ConvertColumnRegular<int64_t>(current_offset, dataptr, maskptr, idata, count);
+		ConvertColumnRegular<int64_t>(current_offset, dataptr, maskptr, idata, count);
 		break;
 	case LogicalTypeId::HUGEINT:
-		may_have_null = ConvertColumn<hugeint_t, double, duckdb_py_convert::IntegralConvert>(current_offset, dataptr,
-		                                                                                     maskptr, idata, count);
+		ConvertColumn<hugeint_t, double, duckdb_py_convert::IntegralConvert>(current_offset, dataptr, maskptr, idata,
+		                                                                     count);
 		break;
 	case LogicalTypeId::FLOAT:
-		may_have_null = ConvertColumnRegular<float>(current_offset, dataptr, maskptr, idata, count);
+		ConvertColumnRegular<float>(current_offset, dataptr, maskptr, idata, count);
 		break;
 	case LogicalTypeId::DOUBLE:
-		may_have_null = ConvertColumnRegular<double>(current_offset, dataptr, maskptr, idata, count);
+		ConvertColumnRegular<double>(current_offset, dataptr, maskptr, idata, count);
 		break;
 	case LogicalTypeId::DECIMAL:
-		may_have_null = ConvertDecimal(input.type, current_offset, dataptr, maskptr, idata, count);
+		ConvertDecimal(input.type, current_offset, dataptr, maskptr, idata, count);
 		break;
 	case LogicalTypeId::TIMESTAMP:
-		may_have_null = ConvertColumn<timestamp_t, int64_t, duckdb_py_convert::TimestampConvert>(
-		    current_offset, dataptr, maskptr, idata, count);
+		ConvertColumn<timestamp_t, int64_t, duckdb_py_convert::TimestampConvert>(current_offset, dataptr, maskptr,
+		                                                                         idata, count);
 		break;
 	case LogicalTypeId::DATE:
-		may_have_null = ConvertColumn<date_t, int64_t, duckdb_py_convert::DateConvert>(current_offset, dataptr, maskptr,
-		                                                                               idata, count);
+		ConvertColumn<date_t, int64_t, duckdb_py_convert::DateConvert>(current_offset, dataptr, maskptr, idata, count);
 		break;
 	case LogicalTypeId::TIME:
-		may_have_null = ConvertColumn<dtime_t, PyObject *, duckdb_py_convert::TimeConvert>(current_offset, dataptr,
-		                                                                                   maskptr, idata, count);
+		ConvertColumn<dtime_t, PyObject *, duckdb_py_convert::TimeConvert>(current_offset, dataptr, maskptr, idata,
+		                                                                   count);
 		break;
 	case LogicalTypeId::VARCHAR:
-		may_have_null = ConvertColumn<string_t, PyObject *, duckdb_py_convert::StringConvert>(current_offset, dataptr,
-		                                                                                      maskptr, idata, count);
+		ConvertStrings(current_offset, dataptr, maskptr, idata, count, *intern_table);
 		break;
 	case LogicalTypeId::BLOB:
-		may_have_null = ConvertColumn<string_t, PyObject *, duckdb_py_convert::BlobConvert>(current_offset, dataptr,
-		                                                                                    maskptr, idata, count);
+		ConvertColumn<string_t, PyObject *, duckdb_py_convert::BlobConvert>(current_offset, dataptr, maskptr, idata,
+		                                                                    count);
 		break;
 	default:
 		throw runtime_error("unsupported type " + input.type.ToString());
 	}
-	if (may_have_null) {
-		requires_mask = true;
-	}
-	data->count += count;
-	mask->count += count;
 }
 
 py::object ArrayWrapper::ToArray(idx_t count) {
-	D_ASSERT(data->array && mask->array);
-	data->Resize(data->count);
-	if (!requires_mask) {
+	D_ASSERT(data->array);
+	data->Resize(count);
+	intern_table.reset();
+	if (!mask) {
+		// no NULL values: no need for a masked array
 		return move(data->array);
 	}
-	mask->Resize(mask->count);
+	mask->Resize(count);
 	// construct numpy arrays from the data and the mask
 	auto values = move(data->array);
 	auto nullmask = move(mask->array);
@@ -556,16 +642,136 @@ void NumpyResultConversion::Resize(idx_t new_capacity) {
 
 void NumpyResultConversion::Append(DataChunk &chunk) {
 	if (count + chunk.size() > capacity) {
-		Resize(capacity * 2);
+		Resize(MaxValue<idx_t>(capacity * 2, count + chunk.size()));
 	}
 	for (idx_t col_idx = 0; col_idx < owned_data.size(); col_idx++) {
 		owned_data[col_idx].Append(count, chunk.data[col_idx], chunk.size());
 	}
 	count += chunk.size();
+}
+
+struct NumpyConversionState {
+	NumpyConversionState() : finished_tasks(0) {
+	}
+
+	mutex lock;
+	//! Signaled when a task is finished
+	std::condition_variable task_finished;
+	idx_t finished_tasks;
+	string error;
+};
+
+//! Converts the columns that do not create Python objects for a range of chunks
+class NumpyConversionTask : public Task {
+public:
+	NumpyConversionTask(NumpyConversionState &state, vector<ArrayWrapper> &arrays, ChunkCollection &collection,
+	                    vector<idx_t> &offsets, vector<idx_t> &columns, idx_t start, idx_t end)
+	    : state(state), arrays(arrays), collection(collection), offsets(offsets), columns(columns), start(start),
+	      end(end) {
+	}
+
+	void Execute() override {
+		try {
+			for (idx_t chunk_idx = start; chunk_idx < end; chunk_idx++) {
+				auto &chunk = collection.GetChunk(chunk_idx);
+				for (auto &col_idx : columns) {
+					arrays[col_idx].Append(offsets[chunk_idx], chunk.data[col_idx], chunk.size());
+				}
+			}
+		} catch (std::exception &ex) {
+			lock_guard<mutex> guard(state.lock);
+			state.error = ex.what();
+		}
+		// notify while holding the lock: the state is destroyed as soon as the waiting thread sees the last task finish
+		lock_guard<mutex> guard(state.lock);
+		state.finished_tasks++;
+		state.task_finished.notify_one();
+	}
+
+private:
+	NumpyConversionState &state;
+	vector<ArrayWrapper> &arrays;
+	ChunkCollection &collection;
+	vector<idx_t> &offsets;
+	vector<idx_t> &columns;
+	idx_t start;
+	idx_t end;
+};
+
+void NumpyResultConversion::AppendParallel(ClientContext &context, ChunkCollection &collection) {
+	static constexpr idx_t CHUNKS_PER_TASK = 16;
+	if (count + collection.Count() > capacity) {
+		Resize(count + collection.Count());
+	}
+	// compute the target offset of every chunk
+	vector<idx_t> offsets;
+	idx_t offset = count;
+	for (auto &chunk : collection.Chunks()) {
+		offsets.push_back(offset);
+		offset += chunk->size();
+	}
+	// the masks are NumPy arrays: allocate them up front while we hold the GIL
+	vector<idx_t> parallel_columns;
+	vector<idx_t> object_columns;
 	for (idx_t col_idx = 0; col_idx < owned_data.size(); col_idx++) {
-		D_ASSERT(owned_data[col_idx].data->count == count);
-		D_ASSERT(owned_data[col_idx].mask->count == count);
+		auto &array = owned_data[col_idx];
+		for (auto &chunk : collection.Chunks()) {
+			VectorData idata;
+			chunk->data[col_idx].Orrify(chunk->size(), idata);
+			if (idata.nullmask && idata.nullmask->any()) {
+				array.InitializeMask();
+				break;
+			}
+		}
+		if (array.CreatesPythonObjects()) {
+			object_columns.push_back(col_idx);
+		} else {
+			parallel_columns.push_back(col_idx);
+		}
+	}
+
+	// schedule the conversion of the columns that can be converted without the GIL
+	NumpyConversionState state;
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	auto producer = scheduler.CreateProducer();
+	idx_t task_count = 0;
+	if (!parallel_columns.empty()) {
+		for (idx_t start = 0; start < collection.ChunkCount(); start += CHUNKS_PER_TASK) {
+			auto end = MinValue<idx_t>(start + CHUNKS_PER_TASK, collection.ChunkCount());
+			auto task = make_unique<NumpyConversionTask>(state, owned_data, collection, offsets, parallel_columns,
+			                                             start, end);
+			scheduler.ScheduleTask(*producer, move(task));
+			task_count++;
+		}
+	}
+	// create the Python objects on this thread in the meantime
+	try {
+		for (idx_t chunk_idx = 0; chunk_idx < collection.ChunkCount(); chunk_idx++) {
+			auto &chunk = collection.GetChunk(chunk_idx);
+			for (auto &col_idx : object_columns) {
+				owned_data[col_idx].Append(offsets[chunk_idx], chunk.data[col_idx], chunk.size());
+			}
+		}
+	} catch (std::exception &ex) {
+		lock_guard<mutex> guard(state.lock);
+		state.error = ex.what();
+	}
+	{
+		// the remaining tasks do not touch Python objects: release the GIL so other Python threads can run, then help
+		// with the remaining tasks and wait for the tasks that are executed by other threads
+		py::gil_scoped_release release;
+		unique_ptr<Task> task;
+		while (scheduler.GetTaskFromProducer(*producer, task)) {
+			task->Execute();
+			task.reset();
+		}
+		std::unique_lock<mutex> guard(state.lock);
+		state.task_finished.wait(guard, [&] { return state.finished_tasks == task_count; });
 	}
+	if (!state.error.empty()) {
+		throw runtime_error(state.error);
+	}
+	count += collection.Count();
 }
 
 namespace random_string {
@@ -1125,8 +1331,12 @@ public:
 		NumpyResultConversion conversion(result->types, initial_capacity);
 		if (result->type == QueryResultType::MATERIALIZED_RESULT) {
 			auto &materialized = (MaterializedQueryResult &)*result;
-			for (auto &chunk : materialized.collection.Chunks()) {
-				conversion.Append(*chunk);
+			if (context) {
+				conversion.AppendParallel(*context, materialized.collection);
+			} else {
+				for (auto &chunk : materialized.collection.Chunks()) {
+					conversion.Append(*chunk);
+				}
 			}
 			materialized.collection.Reset();
 		} else {
@@ -1166,6 +1376,7 @@ public:
 		result->ToArrowSchema(&schema);
 		auto schema_obj = schema_import_func((uint64_t)&schema);
 
+		// convert the result one chunk at a time, so the chunks are released while the batches are created
 		py::list batches;
 		while (true) {
 			auto data_chunk = result->Fetch();
@@ -1176,7 +1387,15 @@ public:
 			data_chunk->ToArrowArray(&data);
 			ArrowSchema schema;
 			result->ToArrowSchema(&schema);
-			batches.append(batch_import_func((uint64_t)&data, (uint64_t)&schema));
+			try {
+				batches.append(batch_import_func((uint64_t)&data, (uint64_t)&schema));
+			} catch (...) {
+				// the array has not been moved into the batch: release it (and its children)
+				if (data.release) {
+					data.release(&data);
+				}
+				throw;
+			}
 		}
 		return from_batches_func(batches, schema_obj);
 	}
@@ -1360,7 +1579,25 @@ struct DuckDBPyConnection {
 			stream.get_last_error = PythonTableArrowArrayStream::my_stream_getlasterror;
 			stream.private_data = this;
 
-			batches = arrow_table.attr("to_batches")();
+			// export all batches up front: get_next can then be called from any thread without holding the GIL
+			py::list batches = arrow_table.attr("to_batches")();
+			arrays.resize(py::len(batches));
+			for (idx_t batch_idx = 0; batch_idx < arrays.size(); batch_idx++) {
+				arrays[batch_idx].release = nullptr;
+				batches[batch_idx].attr("_export_to_c")((uint64_t)&arrays[batch_idx]);
+			}
+		}
+
+		~PythonTableArrowArrayStream() {
+			ReleaseArrays();
+		}
+
+		void ReleaseArrays() {
+			for (; batch_idx < arrays.size(); batch_idx++) {
+				if (arrays[batch_idx].release) {
+					arrays[batch_idx].release(&arrays[batch_idx]);
+				}
+			}
 		}
 
 		static int my_stream_getschema(struct ArrowArrayStream *stream, struct ArrowSchema *out) {
@@ -1381,11 +1618,13 @@ struct DuckDBPyConnection {
 				my_stream->last_error = "stream was released";
 				return -1;
 			}
-			if (my_stream->batch_idx >= py::len(my_stream->batches)) {
+			if (my_stream->batch_idx >= my_stream->arrays.size()) {
 				out->release = nullptr;
 				return 0;
 			}
-			my_stream->batches[my_stream->batch_idx++].attr("_export_to_c")((uint64_t)out);
+			// move the exported batch into the output
+			*out = my_stream->arrays[my_stream->batch_idx];
+			my_stream->arrays[my_stream->batch_idx++].release = nullptr;
 			return 0;
 		}
 
@@ -1393,8 +1632,10 @@ struct DuckDBPyConnection {
 			if (!stream->release) {
 				return;
 			}
+			// the stream can be released by any thread of a parallel scan: only release the exported arrays here, the
+			// Python table itself is kept alive by the relations that scan it
 			stream->release = nullptr;
-			delete (PythonTableArrowArrayStream *)stream->private_data;
+			((PythonTableArrowArrayStream *)stream->private_data)->ReleaseArrays();
 		}
 
 		static const char *my_stream_getlasterror(struct ArrowArrayStream *stream) {
@@ -1409,7 +1650,7 @@ struct DuckDBPyConnection {
 		ArrowArrayStream stream;
 		string last_error;
 		py::object arrow_table;
-		py::list batches;
+		vector<ArrowArray> arrays;
 		idx_t batch_idx = 0;
 	};
 
@@ -1423,10 +1664,12 @@ struct DuckDBPyConnection {
 			throw runtime_error("Only arrow tables supported");
 		}
 
-		auto my_arrow_table = new PythonTableArrowArrayStream(table);
-		string name = "arrow_table_" + ptr_to_string((void *)my_arrow_table);
+		auto my_arrow_table = make_shared<PythonTableArrowArrayStream>(table);
+		auto stream_ptr = &my_arrow_table->stream;
+		string name = "arrow_table_" + ptr_to_string((void *)stream_ptr);
 		return make_unique<DuckDBPyRelation>(
-		    connection->TableFunction("arrow_scan", {Value::POINTER((uintptr_t)my_arrow_table)})->Alias(name));
+		    connection->TableFunction("arrow_scan", {Value::POINTER((uintptr_t)stream_ptr)})->Alias(name),
+		    move(my_arrow_table));
 	}
 
 	DuckDBPyConnection *unregister_df(string name) {
@@ -1607,6 +1850,19 @@ struct DuckDBPyRelation {
 	DuckDBPyRelation(shared_ptr<Relation> rel) : rel(rel) {
 	}
 
+	DuckDBPyRelation(shared_ptr<Relation> rel, shared_ptr<DuckDBPyConnection::PythonTableArrowArrayStream> stream)
+	    : rel(rel) {
+		arrow_streams.push_back(move(stream));
+	}
+
+	//! Create a relation on top of the given relations, keeping the Arrow streams they scan alive
+	DuckDBPyRelation(shared_ptr<Relation> rel, DuckDBPyRelation &left, DuckDBPyRelation *right = nullptr)
+	    : rel(rel), arrow_streams(left.arrow_streams) {
+		if (right) {
+			arrow_streams.insert(arrow_streams.end(), right->arrow_streams.begin(), right->arrow_streams.end());
+		}
+	}
+
 	static unique_ptr<DuckDBPyRelation> from_df(py::object df) {
 		return default_connection()->from_df(df);
 	}
@@ -1628,7 +1884,7 @@ struct DuckDBPyRelation {
 	}
 
 	unique_ptr<DuckDBPyRelation> project(string expr) {
-		return make_unique<DuckDBPyRelation>(rel->Project(expr));
+		return make_unique<DuckDBPyRelation>(rel->Project(expr), *this);
 	}
 
 	static unique_ptr<DuckDBPyRelation> project_df(py::object df, string expr) {
@@ -1636,7 +1892,7 @@ struct DuckDBPyRelation {
 	}
 
 	unique_ptr<DuckDBPyRelation> alias(string expr) {
-		return make_unique<DuckDBPyRelation>(rel->Alias(expr));
+		return make_unique<DuckDBPyRelation>(rel->Alias(expr), *this);
 	}
 
 	static unique_ptr<DuckDBPyRelation> alias_df(py::object df, string expr) {
@@ -1644,7 +1900,7 @@ struct DuckDBPyRelation {
 	}
 
 	unique_ptr<DuckDBPyRelation> filter(string expr) {
-		return make_unique<DuckDBPyRelation>(rel->Filter(expr));
+		return make_unique<DuckDBPyRelation>(rel->Filter(expr), *this);
 	}
 
 	static unique_ptr<DuckDBPyRelation> filter_df(py::object df, string expr) {
@@ -1652,7 +1908,7 @@ struct DuckDBPyRelation {
 	}
 
 	unique_ptr<DuckDBPyRelation> limit(int64_t n) {
-		return make_unique<DuckDBPyRelation>(rel->Limit(n));
+		return make_unique<DuckDBPyRelation>(rel->Limit(n), *this);
 	}
 
 	static unique_ptr<DuckDBPyRelation> limit_df(py::object df, int64_t n) {
@@ -1660,7 +1916,7 @@ struct DuckDBPyRelation {
 	}
 
 	unique_ptr<DuckDBPyRelation> order(string expr) {
-		return make_unique<DuckDBPyRelation>(rel->Order(expr));
+		return make_unique<DuckDBPyRelation>(rel->Order(expr), *this);
 	}
 
 	static unique_ptr<DuckDBPyRelation> order_df(py::object df, string expr) {
@@ -1669,9 +1925,9 @@ struct DuckDBPyRelation {
 
 	unique_ptr<DuckDBPyRelation> aggregate(string expr, string groups = "") {
 		if (groups.size() > 0) {
-			return make_unique<DuckDBPyRelation>(rel->Aggregate(expr, groups));
+			return make_unique<DuckDBPyRelation>(rel->Aggregate(expr, groups), *this);
 		}
-		return make_unique<DuckDBPyRelation>(rel->Aggregate(expr));
+		return make_unique<DuckDBPyRelation>(rel->Aggregate(expr), *this);
 	}
 
 	static unique_ptr<DuckDBPyRelation> aggregate_df(py::object df, string expr, string groups = "") {
@@ -1679,7 +1935,7 @@ struct DuckDBPyRelation {
 	}
 
 	unique_ptr<DuckDBPyRelation> distinct() {
-		return make_unique<DuckDBPyRelation>(rel->Distinct());
+		return make_unique<DuckDBPyRelation>(rel->Distinct(), *this);
 	}
 
 	static unique_ptr<DuckDBPyRelation> distinct_df(py::object df) {
@@ -1705,19 +1961,19 @@ struct DuckDBPyRelation {
 	}
 
 	unique_ptr<DuckDBPyRelation> union_(DuckDBPyRelation *other) {
-		return make_unique<DuckDBPyRelation>(rel->Union(other->rel));
+		return make_unique<DuckDBPyRelation>(rel->Union(other->rel), *this, other);
 	}
 
 	unique_ptr<DuckDBPyRelation> except(DuckDBPyRelation *other) {
-		return make_unique<DuckDBPyRelation>(rel->Except(other->rel));
+		return make_unique<DuckDBPyRelation>(rel->Except(other->rel), *this, other);
 	}
 
 	unique_ptr<DuckDBPyRelation> intersect(DuckDBPyRelation *other) {
-		return make_unique<DuckDBPyRelation>(rel->Intersect(other->rel));
+		return make_unique<DuckDBPyRelation>(rel->Intersect(other->rel), *this, other);
 	}
 
 	unique_ptr<DuckDBPyRelation> join(DuckDBPyRelation *other, string condition) {
-		return make_unique<DuckDBPyRelation>(rel->Join(other->rel, condition));
+		return make_unique<DuckDBPyRelation>(rel->Join(other->rel, condition), *this, other);
 	}
 
 	void write_csv(string file) {
@@ -1731,7 +1987,7 @@ struct DuckDBPyRelation {
 	// should this return a rel with the new view?
 	unique_ptr<DuckDBPyRelation> create_view(string view_name, bool replace = true) {
 		rel->CreateView(view_name, replace);
-		return make_unique<DuckDBPyRelation>(rel);
+		return make_unique<DuckDBPyRelation>(rel, *this);
 	}
 
 	static unique_ptr<DuckDBPyRelation> create_view_df(py::object df, string view_name, bool replace = true) {
@@ -1801,6 +2057,8 @@ struct DuckDBPyRelation {
 	}
 
 	shared_ptr<Relation> rel;
+	//! The Arrow streams scanned by this relation, these live as long as any relation that scans them
+	vector<shared_ptr<DuckDBPyConnection::PythonTableArrowArrayStream>> arrow_streams;
 };
 
 enum PySQLTokenType {
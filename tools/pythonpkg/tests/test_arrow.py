@@ -56,4 +56,25 @@ class TestArrow(object):
 
         assert round_tripping.equals(arrow_result, check_metadata=True)
 
-            
\ No newline at end of file
+            
+    def test_arrow_table_lifetime(self, duckdb_cursor):
+        if not can_run:
+            return
+
+        import gc
+        import sys
+
+        arrow_table = pyarrow.Table.from_pydict({'a': list(range(1000))})
+        base_refcount = sys.getrefcount(arrow_table)
+
+        con = duckdb.connect()
+        # the derived relation keeps the scanned Arrow table alive after the base relation is gone
+        rel = con.from_arrow_table(arrow_table).filter('a % 2 = 0')
+        gc.collect()
+        assert sys.getrefcount(arrow_table) > base_refcount
+        assert len(rel.to_arrow_table()) == 500
+
+        # dropping the last relation releases the Arrow table, even though the connection is still open
+        del rel
+        gc.collect()
+        assert sys.getrefcount(arrow_table) == base_refcount
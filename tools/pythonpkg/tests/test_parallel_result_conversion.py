@@ -0,0 +1,30 @@
+import duckdb
+import numpy
+
+class TestParallelResultConversion(object):
+    def test_parallel_fetchnumpy(self, duckdb_cursor):
+        conn = duckdb.connect()
+        conn.execute("PRAGMA threads=4")
+        conn.execute("CREATE TABLE tbl AS SELECT i, i::DOUBLE AS d, CASE WHEN i % 3 = 0 THEN NULL ELSE i END AS n, 'str' || (i % 10)::VARCHAR AS s FROM range(0, 100000) tbl(i)")
+        res = conn.execute("SELECT * FROM tbl ORDER BY i").fetchnumpy()
+        assert len(res['i']) == 100000
+        assert res['i'][99999] == 99999
+        assert res['d'][12345] == 12345.0
+        # columns without NULL values are returned as regular arrays
+        assert not isinstance(res['i'], numpy.ma.MaskedArray)
+        assert isinstance(res['n'], numpy.ma.MaskedArray)
+        assert res['n'].mask[3]
+        assert not res['n'].mask[4]
+        assert res['n'][4] == 4
+        assert res['s'][12345] == 'str5'
+        conn.close()
+
+    def test_parallel_fetchdf(self, duckdb_cursor):
+        conn = duckdb.connect()
+        conn.execute("PRAGMA threads=4")
+        df = conn.execute("SELECT i, i % 7 AS m, CASE WHEN i % 2 = 0 THEN 'even' ELSE NULL END AS s FROM range(0, 50000) tbl(i)").fetchdf()
+        assert len(df) == 50000
+        assert df['m'].sum() == sum(i % 7 for i in range(0, 50000))
+        assert df['s'][0] == 'even'
+        assert df['s'][1] is None or df['s'].isnull()[1]
+        conn.close()